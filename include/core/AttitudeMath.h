@@ -0,0 +1,58 @@
+#ifndef ATTITUDEMATH_H
+#define ATTITUDEMATH_H
+
+#include <cmath>
+
+/**
+ * @brief Unit quaternion, body to world (w, x, y, z), world z up.
+ */
+struct Quaternion {
+    float w = 1.0f, x = 0.0f, y = 0.0f, z = 0.0f;
+};
+
+// Accelerometer vector (g) that produces the given IIMU::getAccAngles() pair: the exact
+// inverse of roll = atan2(ay, √(ax²+az²)), pitch = -atan2(ax, √(ay²+az²)) for a 1 g reading.
+// Used by override/simulation paths that only know angles.
+inline void accelFromAccAngles(float rollDeg, float pitchDeg, float& ax, float& ay, float& az) {
+    constexpr float kDegToRad = 0.0174532925f;
+    ay = std::sin(rollDeg * kDegToRad);
+    ax = -std::sin(pitchDeg * kDegToRad);
+    const float zz = 1.0f - ax * ax - ay * ay;
+    az = zz > 0.0f ? std::sqrt(zz) : 0.0f;
+}
+
+// Inverse of the above for any reading: the IIMU::getAccAngles() convention, in deg.
+inline void accAnglesFromAccel(float ax, float ay, float az, float& rollDeg, float& pitchDeg) {
+    constexpr float kRadToDeg = 57.2957795f;
+    rollDeg  =  std::atan2(ay, std::sqrt(ax * ax + az * az)) * kRadToDeg;
+    pitchDeg = -std::atan2(ax, std::sqrt(ay * ay + az * az)) * kRadToDeg;
+}
+
+// ZYX Euler angles (deg) <-> quaternion. Trig: convert where angles are read, not per tick.
+inline void rollPitchDegFromQuaternion(const Quaternion& q, float& roll, float& pitch) {
+    constexpr float kRadToDeg = 57.2957795f;
+    roll = std::atan2(2.0f * (q.w * q.x + q.y * q.z), 1.0f - 2.0f * (q.x * q.x + q.y * q.y)) * kRadToDeg;
+    float s = 2.0f * (q.w * q.y - q.z * q.x);
+    s = s > 1.0f ? 1.0f : (s < -1.0f ? -1.0f : s);
+    pitch = std::asin(s) * kRadToDeg;
+}
+
+inline float yawDegFromQuaternion(const Quaternion& q) {
+    constexpr float kRadToDeg = 57.2957795f;
+    return std::atan2(2.0f * (q.w * q.z + q.x * q.y), 1.0f - 2.0f * (q.y * q.y + q.z * q.z)) * kRadToDeg;
+}
+
+inline Quaternion quaternionFromEulerDeg(float roll, float pitch, float yaw) {
+    constexpr float kHalfDegToRad = 0.00872664626f;
+    const float cr = std::cos(roll * kHalfDegToRad),  sr = std::sin(roll * kHalfDegToRad);
+    const float cp = std::cos(pitch * kHalfDegToRad), sp = std::sin(pitch * kHalfDegToRad);
+    const float cy = std::cos(yaw * kHalfDegToRad),   sy = std::sin(yaw * kHalfDegToRad);
+    Quaternion q;
+    q.w = cr * cp * cy + sr * sp * sy;
+    q.x = sr * cp * cy - cr * sp * sy;
+    q.y = cr * sp * cy + sr * cp * sy;
+    q.z = cr * cp * sy - sr * sp * cy;
+    return q;
+}
+
+#endif // ATTITUDEMATH_H
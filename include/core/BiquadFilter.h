@@ -0,0 +1,58 @@
+#ifndef BIQUADFILTER_H
+#define BIQUADFILTER_H
+
+#include <cstdint>
+
+/**
+ * @brief Second-order IIR section (RBJ cookbook), transposed direct form II.
+ * Coefficients can be retuned between samples without resetting state, so a notch
+ * can follow a moving peak without a transient.
+ */
+class BiquadFilter {
+public:
+    BiquadFilter() { setPassthrough(); }
+
+    void setNotch(float centerHz, float q, float sampleHz);
+    void setLowpass(float cutoffHz, float q, float sampleHz);
+    void setBandpass(float centerHz, float q, float sampleHz);   // 0 dB at centre
+    void setPassthrough();
+    // Takes another section's tuning but keeps this section's state (one design, many axes).
+    void copyCoefficients(const BiquadFilter& other) {
+        b0_ = other.b0_; b1_ = other.b1_; b2_ = other.b2_; a1_ = other.a1_; a2_ = other.a2_;
+    }
+
+    float apply(float x) {
+        const float y = b0_ * x + z1_;
+        z1_ = b1_ * x - a1_ * y + z2_;
+        z2_ = b2_ * x - a2_ * y;
+        return y;
+    }
+
+    void reset() { z1_ = z2_ = 0.0f; }
+
+private:
+    float b0_ = 1.0f, b1_ = 0.0f, b2_ = 0.0f, a1_ = 0.0f, a2_ = 0.0f;
+    float z1_ = 0.0f, z2_ = 0.0f;
+};
+
+enum class BiquadKind : uint8_t { Lowpass, Notch, Bandpass };
+
+/**
+ * @brief Biquad whose response type is part of the type, so FilterCascade stages
+ * all configure the same way and the choice costs nothing at run time.
+ */
+template <BiquadKind Kind>
+class BiquadStage : public BiquadFilter {
+public:
+    void configure(float hz, float q, float sampleHz) {
+        if constexpr (Kind == BiquadKind::Lowpass) setLowpass(hz, q, sampleHz);
+        else if constexpr (Kind == BiquadKind::Notch) setNotch(hz, q, sampleHz);
+        else setBandpass(hz, q, sampleHz);
+    }
+};
+
+using BiquadLowpass  = BiquadStage<BiquadKind::Lowpass>;
+using BiquadNotch    = BiquadStage<BiquadKind::Notch>;
+using BiquadBandpass = BiquadStage<BiquadKind::Bandpass>;
+
+#endif // BIQUADFILTER_H
@@ -0,0 +1,35 @@
+#ifndef BLACKBOXCODEC_H
+#define BLACKBOXCODEC_H
+
+#include "core/BlackboxFormat.h"
+
+/**
+ * @brief Keyframe + delta frame codec (see BlackboxFormat.h for the byte layout).
+ * Prediction: the loop counter extrapolates its last step (constant logging divider
+ * → residual 0); every other field predicts its previous value. Encoder and decoder
+ * run the same predictor, so both only need the last two frames of state.
+ */
+class BlackboxEncoder {
+public:
+    // Next frame is a keyframe (segment start, or after a dropped frame).
+    void restart() { havePrev_ = false; }
+    // Writes one frame to out (≥ kBlackboxMaxFrameBytes); returns bytes written.
+    size_t encode(const BlackboxFrame& frame, uint8_t* out);
+
+private:
+    BlackboxFrame prev_, prev2_;
+    bool havePrev_ = false;
+};
+
+class BlackboxDecoder {
+public:
+    void restart() { havePrev_ = false; }
+    // Decodes one frame; returns bytes consumed, 0 on end of data or a corrupt frame.
+    size_t decode(const uint8_t* in, size_t len, BlackboxFrame& frame);
+
+private:
+    BlackboxFrame prev_, prev2_;
+    bool havePrev_ = false;
+};
+
+#endif // BLACKBOXCODEC_H
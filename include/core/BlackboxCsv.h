@@ -0,0 +1,57 @@
+#ifndef BLACKBOXCSV_H
+#define BLACKBOXCSV_H
+
+#include "core/BlackboxLog.h"
+
+/**
+ * @brief CSV text for decoded blackbox frames, shared by the dashboard and the native
+ * decoder tool. Values print exactly from their integer units (no float rounding);
+ * time_us is reconstructed from the loop counter and the logged loop rate.
+ * Both return the characters written, or 0 if cap is too small.
+ */
+size_t blackboxCsvHeader(char* out, size_t cap);
+size_t blackboxCsvRow(const BlackboxFrame& frame, uint16_t loopHz, char* out, size_t cap);
+
+// Upper bound for one row, for sizing line buffers
+constexpr size_t kBlackboxCsvRowBytes = 24 + 13 * kBlackboxFieldCount;
+
+/**
+ * @brief Streams a BlackboxLog as CSV, pulled with read() or pushed through a sink in
+ * chunks of at most kChunkBytes. The segment range is fixed on the first read; each
+ * segment is copied out (the only time the recorder sees a reader) and formatted on
+ * demand, so nothing is held between reads and no heap is touched. Segments the
+ * flight task reuses before the stream reaches them are skipped and counted.
+ */
+class BlackboxCsvStream {
+public:
+    static constexpr size_t kChunkBytes = 1024;
+    using Sink = void (*)(void* ctx, const char* data, size_t len);
+
+    struct Result {
+        uint32_t rows = 0;
+        uint32_t segmentsLost = 0;
+    };
+
+    // segmentBuf holds BlackboxLog::kSegmentBytes; stepLoops > 1 keeps one frame per step.
+    BlackboxCsvStream(BlackboxLog& log, uint16_t loopHz, uint8_t* segmentBuf, uint32_t stepLoops = 1)
+        : log_(log), loopHz_(loopHz), segment_(segmentBuf), step_(stepLoops ? stepLoops : 1) {}
+
+    // Whole lines (header first) into out, cap ≥ kBlackboxCsvRowBytes; 0 once finished.
+    size_t read(char* out, size_t cap);
+    const Result& result() const { return result_; }
+    // read() in kChunkBytes chunks until finished
+    Result write(Sink sink, void* ctx);
+
+private:
+    BlackboxLog& log_;
+    uint16_t loopHz_;
+    uint8_t* segment_;
+    uint32_t step_;
+    BlackboxDecoder decoder_;
+    Result result_;
+    uint32_t seq_ = 0, last_ = 0, nextLoop_ = 0;
+    uint16_t len_ = 0, pos_ = 0;
+    bool started_ = false, haveNext_ = false;
+};
+
+#endif // BLACKBOXCSV_H
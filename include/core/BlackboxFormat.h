@@ -0,0 +1,81 @@
+#ifndef BLACKBOXFORMAT_H
+#define BLACKBOXFORMAT_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Blackbox frame layout and the byte-level primitives shared by recorder and decoder.
+ *
+ * Log file (GET /api/blackbox): "FCBB", version, field count, loop Hz (u16 LE), then
+ * segments as [u16 LE length][bytes]. Each segment opens with an 'I' keyframe (every
+ * field as an absolute zig-zag varint). A 'P' frame is a bitmap of fields whose value
+ * differs from the prediction (bit i of byte i/8), then a zig-zag varint residual per
+ * set bit, in field order. A segment decodes on its own, so the ring can drop its
+ * oldest segment without breaking the rest of the log.
+ */
+enum class BlackboxField : uint8_t {
+    Iteration,
+    AngleSpRoll, AngleRoll, AngleSpPitch, AnglePitch,
+    RateSpRoll, GyroRoll, RateSpPitch, GyroPitch, RateSpYaw, GyroYaw,
+    Throttle, Motor1, Motor2, Motor3, Motor4, Motor5, Motor6, Motor7, Motor8, // unused motors log 1000
+    VoltageMv,
+    Count
+};
+
+constexpr uint8_t kBlackboxFieldCount = static_cast<uint8_t>(BlackboxField::Count);
+
+// Integer units per field: angles in 0.01°, rates in 0.1°/s, motors in µs, voltage in mV
+constexpr float kBlackboxFieldScale[kBlackboxFieldCount] = {
+    1, 100, 100, 100, 100, 10, 10, 10, 10, 10, 10, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1000};
+
+constexpr const char* kBlackboxFieldName[kBlackboxFieldCount] = {
+    "loop", "angle_sp_roll", "angle_roll", "angle_sp_pitch", "angle_pitch",
+    "rate_sp_roll", "gyro_roll", "rate_sp_pitch", "gyro_pitch", "rate_sp_yaw", "gyro_yaw",
+    "throttle", "m1", "m2", "m3", "m4", "m5", "m6", "m7", "m8", "voltage"};
+
+struct BlackboxFrame {
+    int32_t v[kBlackboxFieldCount] = {};
+
+    int32_t& operator[](BlackboxField f) { return v[static_cast<uint8_t>(f)]; }
+    int32_t operator[](BlackboxField f) const { return v[static_cast<uint8_t>(f)]; }
+    // Stores a physical value in the field's integer unit
+    void set(BlackboxField f, float value) {
+        (*this)[f] = static_cast<int32_t>(std::lround(value * kBlackboxFieldScale[static_cast<uint8_t>(f)]));
+    }
+};
+
+constexpr uint8_t kBlackboxVersion = 2; // 2: eight motor fields
+constexpr uint8_t kBlackboxKeyframe = 'I';
+constexpr uint8_t kBlackboxDelta = 'P';
+constexpr size_t kBlackboxHeaderBytes = 8;
+constexpr size_t kBlackboxMaskBytes = (kBlackboxFieldCount + 7) / 8;
+constexpr size_t kBlackboxMaxFrameBytes = 1 + kBlackboxMaskBytes + 5 * kBlackboxFieldCount;
+
+inline uint32_t zigzagEncode(int32_t v) { return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31); }
+inline int32_t zigzagDecode(uint32_t u) { return static_cast<int32_t>(u >> 1) ^ -static_cast<int32_t>(u & 1); }
+
+// LEB128: 7 bits per byte, high bit = more bytes follow. Returns bytes written (1..5).
+inline size_t writeVarint(uint32_t u, uint8_t* out) {
+    size_t n = 0;
+    while (u >= 0x80) { out[n++] = static_cast<uint8_t>(u | 0x80); u >>= 7; }
+    out[n++] = static_cast<uint8_t>(u);
+    return n;
+}
+
+// Returns bytes consumed, 0 on truncated or over-long input.
+inline size_t readVarint(const uint8_t* in, size_t len, uint32_t& u) {
+    u = 0;
+    for (size_t i = 0; i < len && i < 5; ++i) {
+        u |= static_cast<uint32_t>(in[i] & 0x7F) << (7 * i);
+        if (!(in[i] & 0x80)) return i + 1;
+    }
+    return 0;
+}
+
+// Fixed-size file header; returns kBlackboxHeaderBytes, or 0 from the reader on mismatch.
+size_t writeBlackboxHeader(uint8_t* out, uint16_t loopHz);
+size_t readBlackboxHeader(const uint8_t* in, size_t len, uint16_t& loopHz);
+
+#endif // BLACKBOXFORMAT_H
@@ -0,0 +1,47 @@
+#ifndef BLACKBOXLOG_H
+#define BLACKBOXLOG_H
+
+#include "core/BlackboxCodec.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Full-rate flight recorder: encoded frames in a RAM ring of fixed segments.
+ * Segments are numbered by an ever-increasing sequence; a full ring reuses the oldest
+ * one, and each segment restarts on a keyframe so the survivors still decode.
+ *
+ * One writer (record()) and one reader (copySegment()) on any cores. The reader raises a
+ * flag and waits out a record() already in progress (a few µs); a record() that finds
+ * the flag set refuses the frame without side effects, so the caller can keep it queued
+ * (see drainTelemetry()) and retry. Copy a segment out, then format it.
+ */
+class BlackboxLog {
+public:
+    static constexpr uint16_t kSegmentBytes = 1024;
+    static constexpr uint8_t kSegments = 24; // same 24 KB the 500-entry CSV ring used
+
+    BlackboxLog();
+
+    // false: a reader is copying; nothing was written, retry later
+    bool record(const BlackboxFrame& frame);
+    // Writer side only (flight task stopped or disarmed).
+    void clear();
+
+    // Valid sequence range is [oldestSegment(), currentSegment()]; the current one is
+    // still filling. Returns bytes copied into dst (kSegmentBytes), 0 if seq was reused.
+    uint32_t oldestSegment() const;
+    uint32_t currentSegment() const { return head_.load(std::memory_order_acquire); }
+    uint16_t copySegment(uint32_t seq, uint8_t* dst);
+
+    uint32_t framesRecorded() const { return recorded_.load(std::memory_order_relaxed); }
+
+private:
+    uint8_t data_[kSegments][kSegmentBytes];
+    uint16_t used_[kSegments];
+    BlackboxEncoder encoder_;
+    std::atomic<uint32_t> head_{0};
+    std::atomic<bool> writing_{false}, reading_{false};
+    std::atomic<uint32_t> recorded_{0};
+};
+
+#endif // BLACKBOXLOG_H
@@ -0,0 +1,82 @@
+#ifndef DSHOT_H
+#define DSHOT_H
+
+#include <cstdint>
+
+enum class DShotRate : uint8_t { DShot150, DShot300, DShot600 };
+
+// Values 1..47 of the 11-bit field. ESCs act on them only while the motor is stopped.
+enum class DShotCommand : uint8_t {
+    MotorStop = 0,
+    Beacon1 = 1, Beacon2 = 2, Beacon3 = 3, Beacon4 = 4, Beacon5 = 5,
+    SpinDirection1 = 7, SpinDirection2 = 8,
+    Mode3dOff = 9, Mode3dOn = 10,
+    SaveSettings = 12,
+    SpinDirectionNormal = 20, SpinDirectionReversed = 21,
+};
+
+/**
+ * @brief DShot frame, sent MSB first: 11-bit value, telemetry-request bit, then the XOR of
+ * the three nibbles above as a 4-bit checksum, so XOR-ing all four nibbles gives 0.
+ *   vvvvvvvvvvv t cccc
+ * Value 0 stops the motor, 1..47 are commands, 48..2047 are throttle. Bidirectional DShot
+ * inverts the checksum, which tells the ESC to answer each frame with eRPM (DShotTelemetry.h).
+ */
+constexpr uint16_t kDShotThrottleMin = 48;
+constexpr uint16_t kDShotThrottleMax = 2047;
+
+constexpr uint16_t dshotFrame(uint16_t value, bool telemetry, bool bidirectional = false) {
+    const uint16_t packet = static_cast<uint16_t>((value & 0x7FF) << 1 | (telemetry ? 1 : 0));
+    const uint16_t crc = static_cast<uint16_t>(packet ^ (packet >> 4) ^ (packet >> 8));
+    return static_cast<uint16_t>(packet << 4 | ((bidirectional ? ~crc : crc) & 0xF));
+}
+
+// Commands go out with the telemetry bit set; settings commands must repeat before the ESC acts
+constexpr uint16_t dshotCommandFrame(DShotCommand c, bool bidirectional = false) {
+    return dshotFrame(static_cast<uint16_t>(c), true, bidirectional);
+}
+constexpr uint8_t dshotCommandRepeats(DShotCommand c) {
+    return static_cast<uint8_t>(c) >= static_cast<uint8_t>(DShotCommand::SpinDirection1) ? 10 : 1;
+}
+
+// ESC command µs → frame value: MOTOR_OFF_US and below stop, 1000..2000 spans 48..2047
+uint16_t dshotThrottle(int us);
+
+/**
+ * @brief Frame → RMT items from tables built once per rate. Each bit is one item: high for
+ * 75 % (1) or 37.5 % (0) of the bit period, low for the rest, in RMT ticks. Items use the
+ * ESP32 rmt_item32_t layout (duration0:15 level0:1 duration1:15 level1:1) so the driver
+ * copies them straight into channel RAM, and a zero item ends the transmission. The nibble
+ * table holds the four items of every 4-bit pattern: a frame is four 16-byte copies.
+ * Inverted (bidirectional DShot): the line idles high and each bit is a low pulse.
+ */
+class DShotEncoder {
+public:
+    static constexpr uint8_t kFrameBits = 16;
+    static constexpr uint8_t kItems = kFrameBits + 1; // + end marker
+    static constexpr uint8_t kClockDivider = 2;       // 80 MHz APB → 25 ns ticks
+    static constexpr uint32_t kTickHz = 80000000 / kClockDivider;
+
+    struct Timing { uint16_t bitTicks, oneHighTicks, zeroHighTicks; };
+    static const Timing& timing(DShotRate rate);
+
+    static constexpr uint32_t item(uint16_t highTicks, uint16_t lowTicks) {
+        return highTicks | 1u << 15 | static_cast<uint32_t>(lowTicks) << 16; // level1 = 0
+    }
+
+    explicit DShotEncoder(DShotRate rate = DShotRate::DShot600, bool inverted = false) { setRate(rate, inverted); }
+
+    void setRate(DShotRate rate, bool inverted = false);
+    DShotRate rate() const { return rate_; }
+    bool inverted() const { return inverted_; }
+    uint32_t bitItem(bool one) const { return nibbles_[one ? 1 : 0][3]; }
+
+    void encode(uint16_t frame, uint32_t items[kItems]) const;
+
+private:
+    DShotRate rate_ = DShotRate::DShot600;
+    bool inverted_ = false;
+    uint32_t nibbles_[16][4] = {};
+};
+
+#endif // DSHOT_H
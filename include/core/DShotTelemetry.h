@@ -0,0 +1,45 @@
+#ifndef DSHOTTELEMETRY_H
+#define DSHOTTELEMETRY_H
+
+#include "core/DShot.h"
+#include <cstdint>
+
+/**
+ * @brief Bidirectional DShot eRPM replies. About 30 µs after each inverted frame the ESC
+ * drives the line for 21 bits at 5/4 of the frame bit rate: a start edge, then 20 GCR bits
+ * sent as transitions (an edge is a 1; GCR keeps every run at 1..3 bits). The four GCR
+ * quintets carry eeem mmmm mmmm cccc: m << e is the µs per electrical revolution, the
+ * checksum makes all four nibbles XOR to 0xF, and 0xFFF means the motor is stopped.
+ *
+ * decode() works on edge timestamps, so a capture from any source (RMT RX runs, timer input
+ * capture, or a synthesised line in the tests) goes through the same code.
+ */
+class DShotTelemetry {
+public:
+    static constexpr uint8_t kLineBits = 21;
+    static constexpr uint8_t kMaxEdges = kLineBits + 1; // + the ESC releasing the line
+
+    // Reply bit period in DShotEncoder ticks
+    static float ticksPerBit(DShotRate rate);
+
+    // Edge timestamps of one reply (any origin, rising) → µs per electrical revolution, 0 when
+    // stopped. false on a malformed line, a non-GCR quintet or a bad checksum.
+    static bool decode(const uint32_t* edges, uint8_t count, float ticksPerBit, uint32_t& periodUs);
+
+    // The line an ESC sends for periodUs (0: stopped), MSB first, and its ideal edge times:
+    // synthesised replies for the tests and the closed-loop sim
+    static uint32_t encodeLine(uint32_t periodUs);
+    static uint8_t edgesFromLine(uint32_t line, float ticksPerBit, uint32_t edges[kMaxEdges]);
+
+    // RMT RX items (rmt_item32_t layout) → edge timestamps, the first at 0. Returns the count.
+    static uint8_t edgesFromItems(const uint32_t* items, uint8_t count, uint32_t edges[kMaxEdges]);
+
+    static float rpmFromPeriod(uint32_t periodUs, uint8_t motorPoles) {
+        return periodUs ? 60.0e6f / (static_cast<float>(periodUs) * (motorPoles / 2)) : 0.0f;
+    }
+    static uint32_t periodFromRpm(float rpm, uint8_t motorPoles) {
+        return rpm > 0.0f ? static_cast<uint32_t>(60.0e6f / (rpm * (motorPoles / 2)) + 0.5f) : 0;
+    }
+};
+
+#endif // DSHOTTELEMETRY_H
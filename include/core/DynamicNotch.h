@@ -0,0 +1,69 @@
+#ifndef DYNAMICNOTCH_H
+#define DYNAMICNOTCH_H
+
+#include "core/BiquadFilter.h"
+#include "core/Fft.h"
+#include <atomic>
+#include <cstdint>
+
+struct DynamicNotchConfig {
+    bool enabled = false;
+    float minHz = 80.0f;        // search band for motor noise peaks
+    float maxHz = 450.0f;
+    float q = 3.5f;             // notch width: -3 dB band ≈ centre / q
+    uint8_t notchCount = 2;     // notches per axis, ≤ DynamicNotch::kMaxNotches
+    float peakRatio = 4.0f;     // peak power must exceed band mean by this factor
+    float smoothing = 0.3f;     // EMA weight of a new peak estimate
+};
+
+/**
+ * @brief Per-axis bank of biquad notches that follow gyro noise peaks found by FFT.
+ * Split across two contexts so the expensive part stays off the flight core:
+ *  - apply() runs every gyro tick (flight task): stores the raw sample in a sliding
+ *    window, retunes notches when new peaks were published, and filters the rates.
+ *  - analyse() runs periodically in any other single task: Hann-windowed FFT of the
+ *    latest kSize samples per axis, peak pick + parabolic refinement, then publish.
+ * Shared state is relaxed atomics plus a release/acquire generation counter.
+ */
+class DynamicNotch {
+public:
+    static constexpr uint8_t kAxes = 3;
+    static constexpr uint8_t kMaxNotches = 3;
+    static constexpr uint16_t kWindow = Fft::kSize;
+
+    DynamicNotch();
+
+    // Call while the flight loop is stopped (init or disarmed).
+    void configure(const DynamicNotchConfig& config, float sampleHz);
+    const DynamicNotchConfig& config() const { return config_; }
+    void reset();
+
+    void apply(float& roll, float& pitch, float& yaw);
+    void analyse();
+
+    // Published centre frequency, 0 while the slot has not locked onto a peak.
+    float centerHz(uint8_t axis, uint8_t notch) const {
+        return centers_[axis][notch].load(std::memory_order_relaxed);
+    }
+
+private:
+    DynamicNotchConfig config_;
+    float sampleHz_ = 1000.0f;
+
+    std::atomic<float> window_[kAxes][kWindow];
+    std::atomic<uint16_t> head_{0};
+    std::atomic<float> centers_[kAxes][kMaxNotches];
+    std::atomic<uint32_t> generation_{0};
+    uint32_t appliedGeneration_ = 0;
+    BiquadFilter notches_[kAxes][kMaxNotches];
+
+    // Analysis scratch, touched only by analyse()
+    Fft fft_;
+    float hann_[kWindow];
+    float re_[kWindow], im_[kWindow];
+
+    void analyseAxis(uint8_t axis, uint16_t head);
+    void retune();
+};
+
+#endif // DYNAMICNOTCH_H
@@ -0,0 +1,26 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <cstdint>
+
+/**
+ * @brief In-place radix-2 complex FFT of fixed size with precomputed twiddles.
+ * No allocation and no trig at run time; a 128-point transform is ~450 butterflies.
+ */
+class Fft {
+public:
+    static constexpr uint16_t kSize = 128;
+    static constexpr uint8_t kLog2Size = 7;
+
+    Fft();
+
+    // Forward transform; re/im hold kSize samples in, spectrum out (bin k = k·fs/kSize).
+    void forward(float* re, float* im) const;
+
+private:
+    float cos_[kSize / 2];
+    float sin_[kSize / 2];
+    uint8_t bitrev_[kSize];
+};
+
+#endif // FFT_H
@@ -0,0 +1,71 @@
+#ifndef FILTERCASCADE_H
+#define FILTERCASCADE_H
+
+#include "core/BiquadFilter.h"
+#include "core/PtFilter.h"
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief Chain of filter stages whose order and types are fixed at compile time.
+ * apply() expands to the stages' inline apply() calls back to back: no virtual
+ * dispatch, no loop over a stage list, no type switch. Example gyro chain:
+ *   using GyroLpf = FilterCascade<Pt1Filter, BiquadNotch, BiquadLowpass>;
+ *   gyro.stage<0>().configure(250.0f, 1000.0f);
+ *   gyro.stage<1>().configure(180.0f, 4.0f, 1000.0f);
+ */
+template <typename... Stages>
+class FilterCascade {
+    static_assert(sizeof...(Stages) > 0, "FilterCascade needs at least one stage");
+
+public:
+    static constexpr std::size_t kStages = sizeof...(Stages);
+
+    template <std::size_t I>
+    auto& stage() { return std::get<I>(stages_); }
+
+    float apply(float x) { return applyAll(x, std::index_sequence_for<Stages...>{}); }
+
+    void reset() {
+        std::apply([](auto&... s) { (s.reset(), ...); }, stages_);
+    }
+
+private:
+    std::tuple<Stages...> stages_;
+
+    template <std::size_t... I>
+    float applyAll(float x, std::index_sequence<I...>) {
+        ((x = std::get<I>(stages_).apply(x)), ...);
+        return x;
+    }
+};
+
+/**
+ * @brief One independent copy of a filter (or cascade) per axis, e.g. gyro roll/pitch/yaw.
+ */
+template <typename Filter, uint8_t Axes = 3>
+class AxisFilters {
+public:
+    // fn(Filter&) is called once per axis, so every axis gets the same tuning
+    template <typename Fn>
+    void configure(Fn&& fn) {
+        for (Filter& f : axes_) fn(f);
+    }
+
+    void apply(float (&x)[Axes]) {
+        for (uint8_t i = 0; i < Axes; ++i) x[i] = axes_[i].apply(x[i]);
+    }
+
+    void reset() {
+        for (Filter& f : axes_) f.reset();
+    }
+
+    Filter& axis(uint8_t i) { return axes_[i]; }
+
+private:
+    Filter axes_[Axes];
+};
+
+#endif // FILTERCASCADE_H
@@ -0,0 +1,71 @@
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include <cstdint>
+
+/**
+ * @brief Saturating signed fixed-point number: int32 storage, FracBits fractional bits.
+ * Every operation clamps to the representable range instead of wrapping, so an
+ * overflowing PID term pins at the rail like the float path's explicit clamps do.
+ * Multiply and divide go through a 64-bit intermediate; products round to nearest.
+ * Constructing from float is implicit so gains and constants read the same in
+ * templated code; converting back needs static_cast<float>.
+ */
+template <int FracBits>
+class Fixed {
+    static_assert(FracBits > 0 && FracBits < 31, "Fixed needs 1..30 fractional bits");
+
+public:
+    static constexpr int32_t kOne = int32_t(1) << FracBits;
+
+    constexpr Fixed() = default;
+    constexpr Fixed(float v) : raw_(fromFloatRaw(v)) {}
+    static constexpr Fixed fromRaw(int32_t raw) { Fixed f; f.raw_ = raw; return f; }
+
+    constexpr int32_t raw() const { return raw_; }
+    explicit constexpr operator float() const { return static_cast<float>(raw_) / kOne; }
+    static constexpr Fixed max() { return fromRaw(INT32_MAX); }
+    static constexpr Fixed min() { return fromRaw(-INT32_MAX); }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return fromRaw(sat(int64_t(a.raw_) + b.raw_)); }
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return fromRaw(sat(int64_t(a.raw_) - b.raw_)); }
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        const int64_t p = int64_t(a.raw_) * b.raw_;
+        return fromRaw(sat((p + (int64_t(1) << (FracBits - 1))) >> FracBits));
+    }
+    // x/0 saturates towards the sign of x
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        if (b.raw_ == 0) return a.raw_ < 0 ? min() : max();
+        return fromRaw(sat((int64_t(a.raw_) << FracBits) / b.raw_));
+    }
+    constexpr Fixed operator-() const { return fromRaw(raw_ == INT32_MIN ? INT32_MAX : -raw_); }
+    Fixed& operator+=(Fixed b) { return *this = *this + b; }
+    Fixed& operator-=(Fixed b) { return *this = *this - b; }
+    Fixed& operator*=(Fixed b) { return *this = *this * b; }
+
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.raw_ < b.raw_; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.raw_ > b.raw_; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw_ <= b.raw_; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw_ >= b.raw_; }
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw_ == b.raw_; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw_ != b.raw_; }
+
+private:
+    int32_t raw_ = 0;
+
+    static constexpr int32_t sat(int64_t v) {
+        return v > INT32_MAX ? INT32_MAX : (v < -INT32_MAX ? -INT32_MAX : static_cast<int32_t>(v));
+    }
+    static constexpr int32_t fromFloatRaw(float v) {
+        const float scaled = v * kOne;
+        if (scaled >= 2147483520.0f) return INT32_MAX; // largest float below 2^31
+        if (scaled <= -2147483520.0f) return -INT32_MAX;
+        return static_cast<int32_t>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+    }
+};
+
+// Q15.16: ±32768 with 1.5e-5 resolution — covers deg/s rates, ±400 µs PID outputs and
+// gains without rescaling, which a pure-fraction Q15/Q31 format would need at every stage.
+using Q16 = Fixed<16>;
+
+#endif // FIXEDPOINT_H
@@ -0,0 +1,50 @@
+#ifndef FLIGHTCONTROLCONSTANTS_H
+#define FLIGHTCONTROLCONSTANTS_H
+
+/**
+ * @brief Tuning defaults, RC mapping and output limits shared by FlightController and the
+ * dashboard. FlightController inherits these so both FlightController::ARM_CHANNEL and
+ * unqualified use inside the controller keep working.
+ */
+struct FlightControlConstants {
+    // Default PID gains — single source of truth for firmware and web dashboard
+    static constexpr float kDefaultRateKp  = 0.7f;
+    static constexpr float kDefaultRateKi  = 0.0f;
+    static constexpr float kDefaultRateKd  = 0.01f;
+    static constexpr float kDefaultYawKp   = 2.0f;
+    static constexpr float kDefaultYawKi   = 12.0f;
+    static constexpr float kDefaultYawKd   = 0.0f;
+    static constexpr float kDefaultAngleKp = 1.5f;
+    static constexpr float kDefaultAngleKd = 0.0f; // D=0 on first flights to avoid noise
+    static constexpr float kDefaultItermRelax = 40.0f; // deg/s of fast setpoint that freezes I; 0 = off
+    static constexpr float kDefaultAntiWindup = 10.0f; // 1/s I bleed while the mixer saturates; 0 = off
+
+    // Exposed so dashboard can mirror the arm condition without magic numbers
+    static constexpr int ARM_CHANNEL   = 4;
+    static constexpr int ARM_THRESHOLD = 1500; // AUX1 above this = armed
+
+    // RC channel indices
+    static constexpr int ROLL_CHANNEL     = 0;
+    static constexpr int PITCH_CHANNEL    = 1;
+    static constexpr int THROTTLE_CHANNEL = 2;
+    static constexpr int YAW_CHANNEL      = 3;
+
+    // RC thresholds and stick scaling
+    static constexpr int   RC_CENTER          = 1500; // center stick µs
+    static constexpr int   THROTTLE_IDLE_LIMIT = 1050; // below = idle, above = flying
+    static constexpr float THROTTLE_MAX       = 1800.0f; // cap before motor mixing
+    static constexpr float ROLL_SENSITIVITY   = 0.10f; // deg per µs from center
+    static constexpr float PITCH_SENSITIVITY  = 0.10f;
+    static constexpr float YAW_SENSITIVITY    = 0.15f; // deg/s per µs from center
+
+    // Motor output limits and mixing
+    static constexpr int   MOTOR_OFF_US       = 1000; // disarmed / unused outputs
+    static constexpr int   MOTOR_MAX_US       = 2000;
+    static constexpr int   MOTOR_MIN_ARMED_US = 1180; // keeps ESCs spinning while armed
+    static constexpr float MIXING_SCALE       = 1.024f;
+
+    static constexpr float DTERM_CUTOFF_HZ    = 40.0f; // D-term LPF corner, rate independent
+    static constexpr float ITERM_RELAX_CUTOFF_HZ = 15.0f; // setpoint PT1 for I-term relax
+};
+
+#endif // FLIGHTCONTROLCONSTANTS_H
@@ -5,82 +5,96 @@
 #include "interfaces/IPPM.h"
 #include "interfaces/IMotors.h"
 #include "interfaces/IBattery.h"
+#include "interfaces/ICompass.h"
 #include "core/PIDController.h"
-#include "core/KalmanFilter.h"
-
-class FlightController {
+#include "core/NumericPolicy.h"
+#include "core/MahonyEstimator.h"
+#include "core/GyroFilterStage.h"
+#include "core/LoopTimingStats.h"
+#include "core/FlightTelemetry.h"
+#include "core/VehicleState.h"
+#include "core/FlightParams.h"
+#include "core/RelayAutotune.h"
+#include "core/MotorMixer.h"
+#include "core/LoopRateConfig.h"
+#include "core/FlightControlConstants.h"
+#include <cstdint>
+
+class FlightController : public FlightControlConstants {
 public:
     FlightController(IIMU& imu, IPPM& ppm, IMotors& motors, IBattery& battery);
 
     void init();
-    void update(float dt);
-    void reset();
+    void update(float dt); // one inner-loop tick; dt is the gyro period (LoopRateConfig::gyroDt())
+    void reset(bool writeOutputs = true); // false: the caller writes this tick's frame itself
+
+    // Re-times the sub-rate tasks and D-term filters; call before init() or while disarmed.
+    void setLoopRates(const LoopRateConfig& rates);
+    const LoopRateConfig& loopRates() const { return rates_; }
+
+    GyroFilterStage& gyroFilters() { return gyroFilters_; } // notch banks ahead of the PIDs
+    bool setFrame(FrameType frame); // disarmed only; false if armed or the driver has too few outputs
+    const MotorMixer& mixer() const { return mixer_; }
+    bool setThrustCompensation(const ThrustCompensationConfig& c) { return mixer_.setCompensation(c, rates_.gyroHz); } // disarmed
+
+    // Optional magnetometer for yaw; nullptr runs the estimator on gyro + accel only
+    void setCompass(ICompass* compass) { compass_ = compass; }
+    // One frame per rates.logDivider armed ticks is queued here; nullptr disables logging
+    void setTelemetry(TelemetryRing* ring) { telemetry_ = ring; }
+    void getAttitudeDeg(float& roll, float& pitch, float& yaw) const;
+    // Published at the end of every update(); other tasks read it instead of the drivers
+    const VehicleStateLock& vehicleState() const { return state_; }
 
-    // Calibration helper
     void calibrateGyro();
+    void loadPIDGains(); // NVS blob → params(), once at init; never from the flight loop
+    FlightParamsLock& params() { return params_; } // web task writes; live from the next tick
+    RelayAutotune& autotune() { return autotune_; } // relay test on one rate axis, while armed
 
-    // Load dynamic PID values from NVS memory
-    void loadPIDGains();
-
-    // Default PID gains — single source of truth for firmware and web dashboard
-    static constexpr float kDefaultRateKp  = 0.7f;
-    static constexpr float kDefaultRateKi  = 0.0f;
-    static constexpr float kDefaultRateKd  = 0.01f;
-    static constexpr float kDefaultYawKp   = 2.0f;
-    static constexpr float kDefaultYawKi   = 12.0f;
-    static constexpr float kDefaultYawKd   = 0.0f;
-    static constexpr float kDefaultAngleKp = 1.5f;
-    static constexpr float kDefaultAngleKd = 0.0f; // D=0 on first flights to avoid noise
-
-    // Exposed so dashboard can mirror the arm condition without magic numbers
-    static constexpr int ARM_CHANNEL   = 4;
-    static constexpr int ARM_THRESHOLD = 1500; // AUX1 above this = armed
+    using TimingClock = uint32_t (*)(); // µs clock profiling update() stages; nullptr: off
+    void setTimingClock(TimingClock clock) { clock_ = clock; }
+    LoopTimingStats& timingStats() { return timing_; }
 
 private:
-    // RC channel indices
-    static constexpr int ROLL_CHANNEL     = 0;
-    static constexpr int PITCH_CHANNEL    = 1;
-    static constexpr int THROTTLE_CHANNEL = 2;
-    static constexpr int YAW_CHANNEL      = 3;
-
-    // RC thresholds and stick scaling
-    static constexpr int   RC_CENTER          = 1500; // center stick µs
-    static constexpr int   THROTTLE_IDLE_LIMIT = 1050; // below = idle, above = flying
-    static constexpr float THROTTLE_MAX       = 1800.0f; // cap before motor mixing
-    static constexpr float ROLL_SENSITIVITY   = 0.10f; // deg per µs from center
-    static constexpr float PITCH_SENSITIVITY  = 0.10f;
-    static constexpr float YAW_SENSITIVITY    = 0.15f; // deg/s per µs from center
-
-    // Motor output limits and mixing
-    static constexpr int   MOTOR_MAX_US       = 2000;
-    static constexpr int   MOTOR_MIN_ARMED_US = 1180; // keeps ESCs spinning while armed
-    static constexpr float MIXING_SCALE       = 1.024f;
-
-    IIMU& imu_;
-    IPPM& ppm_;
-    IMotors& motors_;
-    IBattery& battery_;
-
-    // Filters
-    KalmanFilter rollKf_;
-    KalmanFilter pitchKf_;
-
-    // Inner Rate PIDs — dAlpha=0.5 ≈ 40Hz LPF on D-term at 250Hz loop rate
-    PIDController rollRatePid_{kDefaultRateKp,  kDefaultRateKi,  kDefaultRateKd,  0.5f};
-    PIDController pitchRatePid_{kDefaultRateKp, kDefaultRateKi,  kDefaultRateKd,  0.5f};
-    PIDController yawRatePid_{kDefaultYawKp,    kDefaultYawKi,   kDefaultYawKd};
-
+    IIMU& imu_; IPPM& ppm_;
+    IMotors& motors_; IBattery& battery_;
+    ICompass* compass_ = nullptr;
+    TelemetryRing* telemetry_ = nullptr;
+
+    MahonyEstimator attitude_;
+    GyroFilterStage gyroFilters_;
+
+    // Inner Rate PIDs — dAlpha=0.5 ≈ 40Hz LPF on D-term at 250Hz; setLoopRates() keeps DTERM_CUTOFF_HZ
+    using Pid = BasicPIDController<ControlScalar>;
+    Pid rollRatePid_{kDefaultRateKp,  kDefaultRateKi,  kDefaultRateKd,  0.5f};
+    Pid pitchRatePid_{kDefaultRateKp, kDefaultRateKi,  kDefaultRateKd,  0.5f};
+    Pid yawRatePid_{kDefaultYawKp,    kDefaultYawKi,   kDefaultYawKd};
     // Outer Angle PIDs — D-term starts at 0 to avoid noise amplification on first flights
-    PIDController rollAnglePid_{kDefaultAngleKp,  0.0f, kDefaultAngleKd, 0.5f};
-    PIDController pitchAnglePid_{kDefaultAngleKp, 0.0f, kDefaultAngleKd, 0.5f};
-
-    // Calibration Offsets
-    float calRollRate_ = 0.0f;
-    float calPitchRate_ = 0.0f;
-    float calYawRate_ = 0.0f;
-
-    bool wasArmed_ = false;
-    int logDiv_ = 0;
+    Pid rollAnglePid_{kDefaultAngleKp,  0.0f, kDefaultAngleKd, 0.5f};
+    Pid pitchAnglePid_{kDefaultAngleKp, 0.0f, kDefaultAngleKd, 0.5f};
+
+    float calRollRate_ = 0.0f, calPitchRate_ = 0.0f, calYawRate_ = 0.0f; // gyro bias
+    bool wasArmed_ = false, airmode_ = false, airmodeActive_ = false; // airmode latches at first throttle-up
+    // Multi-rate scheduling state; defaults reproduce the original single 250 Hz loop
+    LoopRateConfig rates_;
+    RateDivider attitudeDiv_, rcDiv_, logDiv_{5};
+    float gyroSum_[3] = {0.0f, 0.0f, 0.0f}; int gyroSamples_ = 0; // averaged for the estimator
+    uint32_t tickCount_ = 0;  // blackbox loop counter
+    float desiredAngleRoll_ = 0.0f, desiredAnglePitch_ = 0.0f, desiredRateRoll_ = 0.0f, desiredRatePitch_ = 0.0f;
+    float angleRoll_ = 0.0f, anglePitch_ = 0.0f;  // estimator output at the last attitude tick
+
+    TimingClock clock_ = nullptr; LoopTimingStats timing_;
+    VehicleStateLock state_;
+    FlightParamsLock params_; uint32_t appliedParams_ = 0; // params_.version() the PIDs run on
+    RelayAutotune autotune_;
+    MotorMixer mixer_;
+    int motorOut_[IMotors::kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000}; // last command
+
+    uint32_t stamp(LoopStage stage, uint32_t since); // records now - since; returns now
+    void swapGains(); // takes a newer params_ set if one can be read without waiting
+    // Sub-rate outer loop: estimator on the averaged gyro, then angle PIDs → desired rates.
+    uint32_t runAttitudeLoop(float dt, uint32_t t);
+    void logTick(const float rates[3], float desiredRateYaw, float throttle, const int* m);
+    void publishState(const float* rates); // nullptr rates: raw gyro minus bias (disarmed)
 };
 
 #endif // FLIGHTCONTROLLER_H
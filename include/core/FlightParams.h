@@ -0,0 +1,58 @@
+#ifndef FLIGHTPARAMS_H
+#define FLIGHTPARAMS_H
+
+#include "core/Seqlock.h"
+#include <cstddef>
+#include <cstdint>
+
+// Tunable parameters, in blob order. Append only: ids are the on-flash layout.
+enum class ParamId : uint8_t {
+    RollRateKp, RollRateKi, RollRateKd,
+    PitchRateKp, PitchRateKi, PitchRateKd,
+    YawRateKp, YawRateKi, YawRateKd,
+    RollAngleKp, RollAngleKd,
+    PitchAngleKp, PitchAngleKd,
+    Airmode, ItermRelax, AntiWindup,
+    Count
+};
+constexpr size_t kParamCount = static_cast<size_t>(ParamId::Count);
+
+struct ParamSpec {
+    const char* key; // dashboard form / JSON name, also the pre-blob NVS key
+    float min, max, def;
+};
+
+/**
+ * @brief Every tunable in one trivially copyable value: the flight task applies it from
+ * RAM, the web task edits it in batches, and it persists as a single versioned NVS blob.
+ * The schema (keys, ranges, defaults) lives in one table in FlightParams.cpp.
+ */
+struct FlightParams {
+    static constexpr uint8_t kVersion = 1;
+    static constexpr size_t kBlobBytes = 8 + 4 * kParamCount; // magic, version, count, values, crc
+
+    float values[kParamCount];
+
+    FlightParams(); // all defaults
+
+    float get(ParamId id) const { return values[static_cast<size_t>(id)]; }
+    // False (and unchanged) when v is outside the spec's range
+    bool set(ParamId id, float v);
+
+    static const ParamSpec& spec(ParamId id);
+    static bool find(const char* key, ParamId& id);
+};
+
+using FlightParamsLock = Seqlock<FlightParams>;
+
+// Little-endian blob with a CRC; decode rejects foreign, truncated or corrupt data, and
+// takes a shorter blob from an older version, keeping defaults for parameters it lacks.
+size_t encodeParams(const FlightParams& params, uint8_t* out, size_t cap);
+bool decodeParams(const uint8_t* in, size_t len, FlightParams& params);
+
+// NVS namespace "fc", key "params": one read, one write. A missing blob falls back to the
+// per-key "pid" namespace once and migrates it. Natively backed by RAM for tests.
+bool loadParams(FlightParams& params);
+bool saveParams(const FlightParams& params);
+
+#endif // FLIGHTPARAMS_H
@@ -0,0 +1,19 @@
+#ifndef FLIGHTTELEMETRY_H
+#define FLIGHTTELEMETRY_H
+
+#include "core/SpscRing.h"
+#include "core/BlackboxLog.h"
+
+/**
+ * @brief Flight-core → web-core frame queue.
+ * FlightController pushes one BlackboxFrame per log tick (wait-free, no encoding on the
+ * flight core); a core-0 task drains it into the BlackboxLog. 128 frames = 128 ms of
+ * slack at 1 kHz against a 5 ms drain period.
+ */
+using TelemetryRing = SpscRing<BlackboxFrame, 128>;
+
+// Moves queued frames into the log; a frame the log refuses (download copying a
+// segment) stays queued for the next call. Returns frames moved.
+uint32_t drainTelemetry(TelemetryRing& ring, BlackboxLog& log);
+
+#endif // FLIGHTTELEMETRY_H
@@ -0,0 +1,41 @@
+#ifndef GYROFIFODECIMATOR_H
+#define GYROFIFODECIMATOR_H
+
+#include <cstdint>
+
+/**
+ * @brief Platform-independent decimator for a burst of IMU FIFO gyro frames.
+ * Each frame is X/Y/Z as big-endian int16 (6 bytes); the whole batch is averaged
+ * into one rate sample for the control tick (boxcar low-pass + downsample).
+ */
+class GyroFifoDecimator {
+public:
+    static constexpr uint8_t kFrameBytes = 6;
+
+    /**
+     * @param lsbPerDegS Gyro sensitivity (e.g. 65.5 LSB per deg/s at ±500 dps).
+     */
+    explicit GyroFifoDecimator(float lsbPerDegS);
+
+    /**
+     * @brief Averages every whole frame in data; trailing partial bytes are ignored.
+     * An empty batch holds the previous rates.
+     * @return Number of frames consumed.
+     */
+    uint16_t consume(const uint8_t* data, uint16_t bytes);
+
+    // FIFO count rounded down to whole frames: what a drain may read without splitting one
+    static constexpr uint16_t wholeFrameBytes(uint16_t bytes) {
+        return static_cast<uint16_t>(bytes - bytes % kFrameBytes);
+    }
+
+    void getRates(float& rollRate, float& pitchRate, float& yawRate) const;
+    uint16_t lastFrames() const { return lastFrames_; }
+
+private:
+    float invScale_;
+    float rollRate_ = 0.0f, pitchRate_ = 0.0f, yawRate_ = 0.0f;
+    uint16_t lastFrames_ = 0;
+};
+
+#endif // GYROFIFODECIMATOR_H
@@ -0,0 +1,62 @@
+#ifndef GYROFILTERSTAGE_H
+#define GYROFILTERSTAGE_H
+
+#include "core/DynamicNotch.h"
+#include "core/FilterCascade.h"
+#include "core/HarmonicNotch.h"
+
+/**
+ * @brief Everything applied to calibrated gyro rates before the estimator and rate PIDs.
+ * Both notch banks and the static lowpass start disabled; FlightController keeps their
+ * sample rate on the gyro rate.
+ */
+class GyroFilterStage {
+public:
+    void setSampleRate(float sampleHz) {
+        sampleHz_ = sampleHz;
+        dynamic_.configure(dynamic_.config(), sampleHz);
+        harmonic_.configure(harmonic_.config(), sampleHz);
+        setLowpass(pt1Hz_, biquadHz_);
+    }
+
+    // FFT-tracked notches; DynamicNotch::analyse() must be driven from another task
+    void setDynamicNotch(const DynamicNotchConfig& config) { dynamic_.configure(config, sampleHz_); }
+    // Throttle-keyed motor harmonic notches, fed through setMotorCommands()
+    void setHarmonicNotch(const HarmonicNotchConfig& config) { harmonic_.configure(config, sampleHz_); }
+    // PT1 then a Butterworth biquad after the notches; 0 Hz leaves that stage a passthrough
+    void setLowpass(float pt1Hz, float biquadHz) {
+        pt1Hz_ = pt1Hz;
+        biquadHz_ = biquadHz;
+        lowpass_.configure([this](Lowpass& f) {
+            if (pt1Hz_ > 0.0f) f.stage<0>().configure(pt1Hz_, sampleHz_); else f.stage<0>().setGain(1.0f);
+            if (biquadHz_ > 0.0f) f.stage<1>().configure(biquadHz_, 0.7071f, sampleHz_); else f.stage<1>().setPassthrough();
+        });
+    }
+
+    DynamicNotch& dynamicNotch() { return dynamic_; }
+    HarmonicNotch& harmonicNotch() { return harmonic_; }
+
+    void apply(float& roll, float& pitch, float& yaw) {
+        dynamic_.apply(roll, pitch, yaw);
+        harmonic_.apply(roll, pitch, yaw);
+        float x[3] = {roll, pitch, yaw};
+        lowpass_.apply(x);
+        roll = x[0]; pitch = x[1]; yaw = x[2];
+    }
+
+    // Commands written this tick shape the next tick's harmonic notches; measured rotor
+    // speeds (RPM filtering) replace the command map whenever the ESCs report them.
+    void setMotorCommands(const int* m, uint8_t count) { harmonic_.setMotorCommands(m, count); }
+    void setMotorRpm(const float* rpm, uint8_t count) { harmonic_.setMotorRpm(rpm, count); }
+
+private:
+    using Lowpass = FilterCascade<Pt1Filter, BiquadLowpass>;
+
+    float sampleHz_ = 250.0f;
+    float pt1Hz_ = 0.0f, biquadHz_ = 0.0f;
+    AxisFilters<Lowpass> lowpass_;
+    DynamicNotch dynamic_;
+    HarmonicNotch harmonic_;
+};
+
+#endif // GYROFILTERSTAGE_H
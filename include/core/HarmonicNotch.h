@@ -0,0 +1,64 @@
+#ifndef HARMONICNOTCH_H
+#define HARMONICNOTCH_H
+
+#include "core/BiquadFilter.h"
+#include "interfaces/IMotors.h"
+#include <cstdint>
+
+struct HarmonicNotchConfig {
+    static constexpr uint8_t kMapPoints = 6;   // commands 1000, 1200, ... 2000 µs
+
+    bool enabled = false;
+    // Motor fundamental (Hz) at each map point; measure per airframe with a throttle sweep.
+    // Defaults match the native QuadPhysics plant (400 Hz at full command, thrust ∝ rpm²).
+    float fundamentalHz[kMapPoints] = {0.0f, 118.7f, 192.7f, 262.9f, 331.8f, 400.0f};
+    uint8_t harmonics = 3;      // 1st..3rd, ≤ HarmonicNotch::kHarmonics
+    float q = 5.0f;
+    float minHz = 40.0f;        // below this a notch would bite into the control band
+    float motorTauS = 0.03f;    // command → rotor speed lag; 0 follows commands instantly
+};
+
+/**
+ * @brief Gyro notch bank centred on each motor's first harmonics, without an RPM sensor.
+ * Fundamentals come from the last motor commands through a per-airframe map, or from
+ * measured rotor speeds (ESC eRPM telemetry) via setMotorRpm() / setMotorFundamentals(). Harmonics outside [minHz, 0.45·fs]
+ * are bypassed. Every motor has its own tracker; only the first `count` passed in are
+ * filtered. One motor is retuned per tick and its coefficients shared by all three axes,
+ * so the trig cost is three sin/cos pairs per tick regardless of motor count.
+ */
+class HarmonicNotch {
+public:
+    static constexpr uint8_t kAxes = 3;
+    static constexpr uint8_t kMotors = IMotors::kMaxMotors;
+    static constexpr uint8_t kHarmonics = 3;
+
+    void configure(const HarmonicNotchConfig& config, float sampleHz);
+    const HarmonicNotchConfig& config() const { return config_; }
+    void reset();
+
+    // Feed the first `count` commands written this tick; they shape the next tick's filtering.
+    void setMotorCommands(const int* m, uint8_t count);
+    void setMotorFundamentals(const float* hz, uint8_t count);
+    // Measured rotor speeds: no map and no lag model
+    void setMotorRpm(const float* rpm, uint8_t count);
+    void apply(float& roll, float& pitch, float& yaw);
+
+    float fundamentalForCommand(int us) const;
+    float fundamentalHz(uint8_t motor) const { return fundamental_[motor]; }
+    // Centre currently loaded into the bank, 0 when that harmonic is bypassed.
+    float centerHz(uint8_t motor, uint8_t harmonic) const { return centers_[motor][harmonic]; }
+
+private:
+    HarmonicNotchConfig config_;
+    float sampleHz_ = 1000.0f;
+    float lagAlpha_ = 1.0f;
+    float fundamental_[kMotors] = {};
+    float centers_[kMotors][kHarmonics] = {};
+    uint8_t nextRetune_ = 0;
+    uint8_t active_ = 4;
+    BiquadFilter notches_[kAxes][kMotors][kHarmonics];
+
+    void retuneMotor(uint8_t motor);
+};
+
+#endif // HARMONICNOTCH_H
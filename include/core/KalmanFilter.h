@@ -1,16 +1,22 @@
 #ifndef KALMANFILTER_H
 #define KALMANFILTER_H
 
+#include "core/FixedPoint.h"
+
 /**
  * @brief Platform-independent 1D Kalman filter.
  * Estimates quadcopter roll/pitch angles by fusing gyroscope rates and accelerometer angles.
+ * T is the numeric type (float or Q16); dt and the process noise dt²·Q are converted
+ * once per distinct dt, leaving the gain division as the only divide per update.
+ * Instantiated for float and Q16 in KalmanFilter.cpp.
  */
-class KalmanFilter {
+template <typename T>
+class BasicKalmanFilter {
 public:
     /**
      * @brief Construct a new KalmanFilter object.
      */
-    KalmanFilter(float initialState = 0.0f, float initialUncertainty = 4.0f);
+    BasicKalmanFilter(T initialState = T(0.0f), T initialUncertainty = T(4.0f));
 
     /**
      * @brief Performs standard 1D Kalman filter fusion.
@@ -18,20 +24,25 @@ public:
      * @param measurement Accelerometer-calculated angle (deg).
      * @param dt Sampling time delta (s).
      */
-    void update(float rate, float measurement, float dt);
+    void update(T rate, T measurement, float dt);
 
     /**
      * @brief Resets filter states.
      */
-    void reset(float state = 0.0f, float uncertainty = 4.0f);
+    void reset(T state = T(0.0f), T uncertainty = T(4.0f));
 
     // Getters
-    float getState() const { return state_; }
-    float getUncertainty() const { return uncertainty_; }
+    T getState() const { return state_; }
+    T getUncertainty() const { return uncertainty_; }
 
 private:
-    float state_;
-    float uncertainty_;
+    T state_;
+    T uncertainty_;
+    T dt_, processNoise_;     // cached for cachedDt_
+    float cachedDt_ = -1.0f;
 };
 
+using KalmanFilter = BasicKalmanFilter<float>;
+using FixedKalmanFilter = BasicKalmanFilter<Q16>;
+
 #endif // KALMANFILTER_H
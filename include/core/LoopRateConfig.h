@@ -0,0 +1,45 @@
+#ifndef LOOPRATECONFIG_H
+#define LOOPRATECONFIG_H
+
+#include <cstdint>
+
+/**
+ * @brief Multi-rate layout of the flight loop.
+ * The gyro read, rate PIDs and mixer run every tick at gyroHz; slower work runs on
+ * integer sub-rates so every task stays phase-locked to the gyro tick.
+ */
+struct LoopRateConfig {
+    uint16_t gyroHz         = 250; // inner loop: gyro, rate PID, mixer, motor write
+    uint8_t attitudeDivider = 1;   // estimator + angle PIDs
+    uint8_t rcDivider       = 1;   // receiver parsing
+    uint8_t logDivider      = 5;   // blackbox frame (50 Hz at the 250 Hz default; 1 = every tick)
+
+    constexpr float gyroDt() const { return 1.0f / static_cast<float>(gyroHz); }
+    constexpr uint32_t periodUs() const { return 1000000UL / gyroHz; }
+};
+
+/**
+ * @brief Counts inner-loop ticks and fires every Nth one, starting with the first.
+ */
+class RateDivider {
+public:
+    explicit RateDivider(uint8_t divider = 1) { setDivider(divider); }
+
+    void setDivider(uint8_t divider) { divider_ = divider ? divider : 1; count_ = 0; }
+    uint8_t divider() const { return divider_; }
+
+    // Next tick fires — used after arm/reset so the outer loops run before the inner one.
+    void restart() { count_ = 0; }
+
+    bool tick() {
+        const bool due = count_ == 0;
+        if (++count_ >= divider_) count_ = 0;
+        return due;
+    }
+
+private:
+    uint8_t divider_ = 1;
+    uint8_t count_ = 0;
+};
+
+#endif // LOOPRATECONFIG_H
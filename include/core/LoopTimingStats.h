@@ -0,0 +1,57 @@
+#ifndef LOOPTIMINGSTATS_H
+#define LOOPTIMINGSTATS_H
+
+#include <atomic>
+#include <cstdint>
+
+// Flight loop stages, in execution order. TickLateness is how late a tick started
+// relative to its schedule, measured by the task that paces the loop.
+enum class LoopStage : uint8_t {
+    ImuRead, RcRead, GyroFilter, Estimator, Pid, Mixer, MotorWrite, Logging, Total, TickLateness, Count
+};
+
+struct StageTimingSnapshot {
+    uint32_t count;
+    uint32_t minUs, maxUs;
+    uint32_t p50Us, p90Us, p99Us; // upper edge of the bucket holding the percentile
+};
+
+/**
+ * @brief Per-stage µs histograms for the flight loop.
+ * Single writer (flight task), any number of readers. Everything is a relaxed atomic so
+ * recording never blocks and readers on the other core never tear a 32-bit value.
+ * Buckets are log-linear (4 per octave) covering 0..8191 µs with ≤25% resolution.
+ */
+class LoopTimingStats {
+public:
+    static constexpr int kStageCount  = static_cast<int>(LoopStage::Count);
+    static constexpr int kBucketCount = 48;
+
+    LoopTimingStats();
+
+    // Flight task only.
+    void record(LoopStage stage, uint32_t us);
+
+    // Safe from any task; the flight task clears the histograms before its next record.
+    StageTimingSnapshot snapshot(LoopStage stage) const;
+    void requestReset() { resetPending_.store(true, std::memory_order_relaxed); }
+
+    static const char* stageName(LoopStage stage);
+    static int bucketFor(uint32_t us);
+    static uint32_t bucketUpperUs(int bucket);
+
+private:
+    struct Stage {
+        std::atomic<uint32_t> count;
+        std::atomic<uint32_t> minUs;
+        std::atomic<uint32_t> maxUs;
+        std::atomic<uint32_t> buckets[kBucketCount];
+    };
+
+    Stage stages_[kStageCount];
+    std::atomic<bool> resetPending_{false};
+
+    void clear();
+};
+
+#endif // LOOPTIMINGSTATS_H
@@ -0,0 +1,50 @@
+#ifndef MAHONYESTIMATOR_H
+#define MAHONYESTIMATOR_H
+
+#include "core/AttitudeMath.h"
+
+struct MahonyConfig {
+    float kp = 1.0f;          // rad/s of correction per unit vector error (~1 s time constant)
+    float ki = 0.02f;         // gyro bias integral
+    float magWeight = 0.5f;   // compass error relative to accel error (yaw only)
+    float accelGateG = 0.15f; // accel trust fades to 0 as | |a| - 1 g | reaches this
+};
+
+/**
+ * @brief Quaternion complementary (Mahony) attitude estimator.
+ * One fused 3-axis update per call: gyro integration with accelerometer (and optional
+ * magnetometer) error fed back through a PI term. The update path uses only
+ * multiply/add and 1/√x — trig is confined to alignment and Euler conversion, which
+ * callers request only when they need angles. Accel is ignored while its magnitude is
+ * far from 1 g (coordinated turns, hard manoeuvres); the compass only corrects yaw.
+ */
+class MahonyEstimator {
+public:
+    explicit MahonyEstimator(const MahonyConfig& config = MahonyConfig());
+
+    void setConfig(const MahonyConfig& config) { config_ = config; }
+    void reset();
+    // Level the estimate to an accelerometer reading; yaw is set to 0.
+    void alignToAccel(float ax, float ay, float az);
+
+    /**
+     * @param gx,gy,gz Body rates (deg/s).
+     * @param ax,ay,az Specific force (g), body axes; a 1 g reading at rest is (0,0,1).
+     * @param mag Optional field vector in body axes (any unit), nullptr when unavailable.
+     */
+    void update(float gx, float gy, float gz, float ax, float ay, float az, float dt,
+                const float* mag = nullptr);
+
+    void getRollPitchDeg(float& roll, float& pitch) const;
+    float getYawDeg() const;
+    const Quaternion& quaternion() const { return q_; }
+
+private:
+    MahonyConfig config_;
+    Quaternion q_;
+    float integral_[3] = {0.0f, 0.0f, 0.0f}; // rad/s
+
+    float magYawError(const float* mag) const;
+};
+
+#endif // MAHONYESTIMATOR_H
@@ -0,0 +1,92 @@
+#ifndef MOTORMIXER_H
+#define MOTORMIXER_H
+
+#include "core/ThrustCompensation.h"
+#include "interfaces/IMotors.h"
+#include <cstdint>
+
+enum class FrameType : uint8_t { QuadX, QuadPlus, HexX, OctoX };
+
+/**
+ * @brief One frame's mixing matrix: per motor, how much roll/pitch/yaw correction it takes.
+ * Signs follow the FlightController convention (QuadX: +roll raises motors 3/4, +pitch 2/3,
+ * +yaw 2/4, 1-based). Motors are numbered around the frame with alternating spin, and the
+ * geometry is scaled so the longest lever on a frame is 1.
+ */
+struct MixerRow { float roll, pitch, yaw; };
+struct MixerTable {
+    uint8_t motors;
+    MixerRow rows[IMotors::kMaxMotors];
+};
+
+constexpr MixerTable kMixerTables[] = {
+    {4, {{-1.0f, -1.0f, -1.0f}, {-1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, -1.0f}, {1.0f, -1.0f, 1.0f}}},
+    {4, {{-1.0f,  0.0f, -1.0f}, { 0.0f, 1.0f, 1.0f}, {1.0f, 0.0f, -1.0f}, {0.0f, -1.0f, 1.0f}}},
+    {6, {{-0.5f, -0.866f, -1.0f}, {-1.0f, 0.0f, 1.0f}, {-0.5f, 0.866f, -1.0f},
+         { 0.5f,  0.866f, 1.0f},  { 1.0f, 0.0f, -1.0f}, { 0.5f, -0.866f, 1.0f}}},
+    {8, {{-0.414f, -1.0f, -1.0f}, {-1.0f, -0.414f, 1.0f}, {-1.0f, 0.414f, -1.0f}, {-0.414f, 1.0f, 1.0f},
+         { 0.414f,  1.0f, -1.0f}, { 1.0f,  0.414f, 1.0f}, { 1.0f, -0.414f, -1.0f}, { 0.414f, -1.0f, 1.0f}}},
+};
+
+constexpr const MixerTable& mixerTable(FrameType frame) { return kMixerTables[static_cast<uint8_t>(frame)]; }
+
+// Every column sums to zero, so pure throttle moves no axis and the mean output is the throttle
+constexpr bool isBalanced(const MixerTable& t) {
+    float r = 0.0f, p = 0.0f, y = 0.0f;
+    for (uint8_t i = 0; i < IMotors::kMaxMotors; ++i) { r += t.rows[i].roll; p += t.rows[i].pitch; y += t.rows[i].yaw; }
+    return r * r < 1e-6f && p * p < 1e-6f && y * y < 1e-6f;
+}
+static_assert(isBalanced(kMixerTables[0]) && isBalanced(kMixerTables[1]) && isBalanced(kMixerTables[2])
+              && isBalanced(kMixerTables[3]), "mixer tables must be balanced");
+
+// What the last mix() could actually deliver, for the PIDs' anti-windup
+struct MixerFeedback {
+    bool saturated = false;  // an output hit a limit even after the shift
+    float applied[3] = {};   // roll/pitch/yaw correction the outputs carry, same units as the input
+};
+
+/**
+ * @brief Throttle + roll/pitch/yaw corrections (µs) → one command per motor.
+ * The active table is held column-wise and zero-padded to kMaxMotors, so the product and
+ * the desaturation run fixed-length loops the compiler unrolls or vectorizes; padded slots
+ * land on the throttle, which a balanced table keeps inside the motors' min..max.
+ * Saturation shifts all outputs together, preserving the attitude correction. With thrust
+ * compensation active the mix and its limits live in the compensated domain, and each
+ * output is mapped to an ESC command last. The tables' columns are orthogonal, so each
+ * axis's delivered share is the outputs' projection onto its column.
+ */
+class MotorMixer {
+public:
+    static constexpr uint8_t kMaxMotors = IMotors::kMaxMotors;
+
+    explicit MotorMixer(FrameType frame = FrameType::QuadX);
+
+    void setFrame(FrameType frame);
+    FrameType frame() const { return frame_; }
+    uint8_t motorCount() const { return count_; }
+
+    // Thrust curve + sag stage between the mix and the ESCs; off by default.
+    bool setCompensation(const ThrustCompensationConfig& config, float sampleHz);
+    void setSampleRate(float sampleHz) { setCompensation(comp_.config(), sampleHz); }
+    const ThrustCompensation& compensation() const { return comp_; }
+    void updateVoltage(float volts); // every tick before mix(); re-derives the output limits
+
+    // out[kMaxMotors]: the first motorCount() are live, the rest hold MOTOR_OFF_US
+    void mix(float throttle, float roll, float pitch, float yaw, int out[kMaxMotors],
+             MixerFeedback* feedback = nullptr) const;
+
+private:
+    FrameType frame_ = FrameType::QuadX;
+    uint8_t count_ = 4;
+    ThrustCompensation comp_;
+    int lo_, hi_; // desaturation limits in the mixer's output domain
+    alignas(16) float roll_[kMaxMotors] = {};
+    alignas(16) float pitch_[kMaxMotors] = {};
+    alignas(16) float yaw_[kMaxMotors] = {};
+    float invNorm_[3] = {}; // 1 / (|column|² · MIXING_SCALE)
+
+    void writeFeedback(bool clipped, float roll, float pitch, float yaw, const int out[kMaxMotors],
+                       MixerFeedback& fb) const;
+};
+
+#endif // MOTORMIXER_H
@@ -0,0 +1,18 @@
+#ifndef NUMERICPOLICY_H
+#define NUMERICPOLICY_H
+
+#include "core/FixedPoint.h"
+
+/**
+ * @brief Build-time numeric type for the PID path of FlightController.
+ * Default float; -D FC_FIXED_POINT_CONTROL instantiates the same controller templates on
+ * saturating Q16 so the loop can be profiled (GET /api/timing "pid" stage) or ported to an
+ * MCU without an FPU. Sensor filtering and the attitude estimator stay float.
+ */
+#ifdef FC_FIXED_POINT_CONTROL
+using ControlScalar = Q16;
+#else
+using ControlScalar = float;
+#endif
+
+#endif // NUMERICPOLICY_H
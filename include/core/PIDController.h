@@ -1,34 +1,69 @@
 #ifndef PIDCONTROLLER_H
 #define PIDCONTROLLER_H
 
+#include "core/PtFilter.h"
+#include "core/FixedPoint.h"
+
 /**
  * @brief Cascaded PID controller with D-on-measurement and optional D-term LPF.
  * dAlpha = 1.0 means no filtering; lower values cut high-frequency noise.
+ * T is the numeric type of the whole update path (float or Q16). The dt-dependent
+ * products ki·dt/2 and kd/dt are rebuilt only when dt or the gains change, so the
+ * per-tick path has no divides. Instantiated for float and Q16 in PIDController.cpp.
+ *
+ * Two optional I-term guards, both off by default:
+ *  - back-calculation: after the mixer, applySaturation() bleeds I by
+ *    gain·dt·(applied − commanded), only while I pushes into the limit and never past zero;
+ *  - I-term relax: I accumulation is scaled by max(0, 1 − |setpoint − PT1(setpoint)| / threshold),
+ *    so fast stick moves (flips, punch-outs) don't charge I while the craft is still catching up.
  */
-class PIDController {
+template <typename T>
+class BasicPIDController {
 public:
-    PIDController(float kp, float ki, float kd, float dAlpha = 1.0f);
+    BasicPIDController(float kp, float ki, float kd, float dAlpha = 1.0f);
 
     // Main update: D acts on measurement (no setpoint kick), LPF applied.
-    float update(float error, float measurement, float dt);
+    T update(T error, T measurement, float dt);
 
     // Test utility: explicit state injection with D-on-error (no LPF).
-    float update(float error, float prevError, float prevIterm, float dt);
+    T update(T error, T prevError, T prevIterm, float dt);
 
     void reset();
     void setGains(float kp, float ki, float kd);
+    void setDtermAlpha(float dAlpha) { dFilter_.setGain(dAlpha); }
+    void setAntiWindup(float gainPerS) { antiWindup_ = gainPerS; cachedDt_ = -1.0f; } // 0 = off
+    void setItermRelax(float thresholdPerS) { // 0 = off; the divide happens here, not per tick
+        itermRelax_ = thresholdPerS > 0.0f;
+        invRelax_ = T(itermRelax_ ? 1.0f / thresholdPerS : 0.0f);
+    }
+    void setItermRelaxCutoff(float cutoffHz, float sampleHz) { setpointLpf_.configure(cutoffHz, sampleHz); }
+
+    // commanded: what update() returned; applied: what the actuators carried this tick.
+    void applySaturation(T commanded, T applied, float dt);
 
-    float getIterm() const { return iterm_; }
-    float getError() const { return prevError_; }
+    T getIterm() const { return iterm_; }
+    T getError() const { return prevError_; }
 
 private:
     static constexpr float kOutputLimit = 400.0f; // motor mixing range ±400µs
 
-    float kp_, ki_, kd_, dAlpha_;
-    float prevError_ = 0.0f;
-    float prevMeasurement_ = 0.0f;
-    float iterm_ = 0.0f;
-    float dFiltered_ = 0.0f;
+    float kp_, ki_, kd_;
+    float antiWindup_ = 0.0f;
+    bool itermRelax_ = false;
+    T kpT_, invRelax_ = T(0.0f);
+    T halfKiDt_, kdOverDt_, awDt_; // cached for cachedDt_
+    float cachedDt_ = -1.0f;  // < 0 forces a rebuild
+    T prevError_ = T(0.0f);
+    T prevMeasurement_ = T(0.0f);
+    T iterm_ = T(0.0f);
+    PtFilter<1, T> dFilter_;  // D-term EMA; gain = dAlpha
+    PtFilter<1, T> setpointLpf_; // I-term relax: setpoint minus this is its fast part
+
+    void cacheDt(float dt);
+    static T clampOutput(T v);
 };
 
+using PIDController = BasicPIDController<float>;
+using FixedPIDController = BasicPIDController<Q16>;
+
 #endif // PIDCONTROLLER_H
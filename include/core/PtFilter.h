@@ -0,0 +1,54 @@
+#ifndef PTFILTER_H
+#define PTFILTER_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief PTn low-pass: n identical first-order sections, order fixed at compile time.
+ * Each section's weight is solved exactly in the discrete domain so the whole cascade is
+ * -3 dB at the requested cutoff; higher orders trade a little more delay for steeper
+ * roll-off. apply() is fully inline with no branches. T is the sample type (float or a
+ * Fixed<> Q format); the weight is always solved in float and converted once.
+ */
+template <uint8_t Order, typename T = float>
+class PtFilter {
+    static_assert(Order >= 1 && Order <= 3, "PtFilter supports PT1..PT3");
+
+public:
+    // Power gain each section contributes at the cutoff: 2^(-1/n)
+    static constexpr float kSectionPowerGain = Order == 1 ? 0.5f : (Order == 2 ? 0.70710678f : 0.79370053f);
+
+    // Solves k²/(1 - 2(1-k)cosω + (1-k)²) = g for the EMA weight k (config time only).
+    void configure(float cutoffHz, float sampleHz) {
+        const float g = kSectionPowerGain;
+        const float c = 1.0f - std::cos(6.28318531f * cutoffHz / sampleHz);
+        k_ = T((-g * c + std::sqrt(g * g * c * c + 2.0f * g * (1.0f - g) * c)) / (1.0f - g));
+    }
+
+    // Raw per-section weight, for callers that already think in EMA alpha (1 = bypass).
+    void setGain(float k) { k_ = T(k); }
+    float gain() const { return static_cast<float>(k_); }
+
+    T apply(T x) {
+        for (uint8_t i = 0; i < Order; ++i) {
+            state_[i] += k_ * (x - state_[i]);
+            x = state_[i];
+        }
+        return x;
+    }
+
+    void reset(T value = T(0.0f)) {
+        for (uint8_t i = 0; i < Order; ++i) state_[i] = value;
+    }
+
+private:
+    T k_ = T(1.0f);
+    T state_[Order] = {};
+};
+
+using Pt1Filter = PtFilter<1>;
+using Pt2Filter = PtFilter<2>;
+using Pt3Filter = PtFilter<3>;
+
+#endif // PTFILTER_H
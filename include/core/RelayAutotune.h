@@ -0,0 +1,79 @@
+#ifndef RELAYAUTOTUNE_H
+#define RELAYAUTOTUNE_H
+
+#include "core/Seqlock.h"
+#include <atomic>
+#include <cstdint>
+
+struct RelayAutotuneConfig {
+    float relayUs = 60.0f;         // ± correction the relay commands on the tuned axis
+    float hysteresisDps = 8.0f;    // rate-error band the relay ignores (gyro noise)
+    uint8_t settleCycles = 3;      // cycles discarded while the limit cycle builds up
+    uint8_t measureCycles = 4;     // cycles averaged into Ku and Tu
+    float maxPeriodSpread = 0.25f; // (max - min) / mean period accepted across them
+    float timeoutS = 6.0f;
+    float abortRateDps = 400.0f;   // |rate error| beyond this ends the test
+};
+
+enum class AutotuneState : uint8_t { Idle, Running, Done, Failed };
+
+struct AutotuneResult {
+    AutotuneState state = AutotuneState::Idle;
+    uint8_t axis = 0;              // 0 roll, 1 pitch, 2 yaw
+    uint16_t cycles = 0;           // completed relay cycles
+    float ultimateGain = 0.0f;     // Ku, µs per deg/s
+    float periodS = 0.0f;          // Tu
+    float amplitudeDps = 0.0f;     // rate oscillation amplitude
+    float kp = 0.0f, ki = 0.0f, kd = 0.0f; // suggested rate-loop gains
+};
+
+/**
+ * @brief Åström–Hägglund relay-feedback autotune for one rate axis.
+ * While running, the axis's PID output is replaced by ±relayUs switched on the sign of
+ * the rate error (with hysteresis), which drives the loop into a limit cycle at its
+ * ultimate frequency. Amplitude a and period Tu of that cycle give
+ * Ku = 4·d / (π·√(a² − ε²)); gains follow the Ziegler–Nichols "no overshoot" rule
+ * (Kp = 0.2·Ku, Ki = 0.4·Ku/Tu, Kd = 0.066·Ku·Tu), conservative for a rate loop with
+ * motor lag. The result is only a suggestion: applying it is up to the caller.
+ *
+ * request()/cancel()/result() are safe from any task. Everything else belongs to the
+ * flight task, which calls poll() at a tick boundary and step() in place of the PIDs.
+ */
+class RelayAutotune {
+public:
+    static constexpr uint8_t kAxes = 3;
+
+    // Flight task, while no test is running
+    void setConfig(const RelayAutotuneConfig& config) { config_ = config; }
+    const RelayAutotuneConfig& config() const { return config_; }
+
+    void request(uint8_t axis) { if (axis < kAxes) request_.store(axis + 1, std::memory_order_release); }
+    void cancel() { request_.store(kCancel, std::memory_order_release); }
+    AutotuneResult result() const { return result_.read(); }
+
+    void poll();
+    bool running() const { return running_; }
+    // error: desired − measured rate per axis (deg/s); replaces out[axis] while running
+    void step(const float error[kAxes], float out[kAxes], float dt);
+    void abort(); // disarm / throttle cut mid-test
+
+private:
+    static constexpr uint8_t kCancel = 0xFF;
+
+    RelayAutotuneConfig config_;
+    std::atomic<uint8_t> request_{0};
+    Seqlock<AutotuneResult> result_;
+    AutotuneResult progress_;      // flight task's copy; published on every change
+
+    bool running_ = false, primed_ = false, relayHigh_ = false, sawRise_ = false;
+    float elapsedS_ = 0.0f, sinceRiseS_ = 0.0f;
+    float maxError_ = 0.0f, minError_ = 0.0f;
+    float periodSum_ = 0.0f, amplitudeSum_ = 0.0f, periodMin_ = 0.0f, periodMax_ = 0.0f;
+    uint8_t measured_ = 0;
+
+    void start(uint8_t axis);
+    void completeCycle(float period, float amplitude);
+    void finish(AutotuneState state);
+};
+
+#endif // RELAYAUTOTUNE_H
@@ -0,0 +1,62 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Single-writer sequence lock for a trivially copyable value.
+ * The writer bumps seq_ to odd, stores the payload, then bumps it to even; a reader
+ * copies the payload between two seq_ loads and retries if they differ or are odd. The
+ * writer never waits and readers never block it, so the flight task can publish every
+ * tick while any number of tasks on the other core take consistent copies. The payload
+ * lives in relaxed atomic words so the concurrent copy is well defined in C++, and on
+ * the ESP32 compiles to plain 32-bit loads and stores.
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock payload must be trivially copyable");
+
+public:
+    // Writer only
+    void write(const T& value) {
+        uint32_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+        const uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (uint32_t i = 0; i < kWords; ++i) words_[i].store(words[i], std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // Any task; false if a write overlapped the copy (out is then unspecified)
+    bool tryRead(T& out) const {
+        const uint32_t before = seq_.load(std::memory_order_acquire);
+        if (before & 1u) return false;
+        uint32_t words[kWords];
+        for (uint32_t i = 0; i < kWords; ++i) words[i] = words_[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) != before) return false;
+        std::memcpy(&out, words, sizeof(T));
+        return true;
+    }
+
+    // Any task; retries until a copy lands between two writes
+    T read() const {
+        T out;
+        while (!tryRead(out)) {}
+        return out;
+    }
+
+    // Completed writes so far
+    uint32_t version() const { return seq_.load(std::memory_order_acquire) >> 1; }
+
+private:
+    static constexpr uint32_t kWords = (sizeof(T) + 3) / 4;
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<uint32_t> words_[kWords] = {};
+};
+
+#endif // SEQLOCK_H
@@ -0,0 +1,63 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Wait-free single-producer / single-consumer ring of N (power of two) items.
+ * head_ and tail_ are free-running sequence counters: the producer publishes an item by
+ * a release store of head_, the consumer frees its slot by a release store of tail_, so
+ * neither side ever waits, spins or touches a kernel object. A full ring rejects the new
+ * item and counts it; the consumer can peek() and pop() later, leaving an item queued
+ * while its own sink is busy.
+ */
+template <typename T, uint32_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    static constexpr uint32_t kCapacity = N;
+
+    // Producer side
+    bool push(const T& item) {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == N) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items_[head & (N - 1)] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool peek(T& item) const {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        item = items_[tail & (N - 1)];
+        return true;
+    }
+    void pop() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+    bool pop(T& item) {
+        if (!peek(item)) return false;
+        pop();
+        return true;
+    }
+
+    // Either side; a snapshot that may be stale by the time it is used
+    uint32_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    uint32_t pushed() const { return head_.load(std::memory_order_relaxed); }
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    T items_[N];
+    // Separate lines so the two cores' counters don't false-share on desktop test hosts
+    alignas(64) std::atomic<uint32_t> head_{0};
+    alignas(64) std::atomic<uint32_t> tail_{0};
+    std::atomic<uint32_t> dropped_{0};
+};
+
+#endif // SPSCRING_H
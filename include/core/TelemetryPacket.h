@@ -0,0 +1,39 @@
+#ifndef TELEMETRYPACKET_H
+#define TELEMETRYPACKET_H
+
+#include "core/VehicleState.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fixed 53-byte little-endian packing of a VehicleState for the live stream.
+ *
+ *   0  u8   version (kTelemetryPacketVersion)
+ *   1  u32  tick
+ *   5  i16  roll, pitch, yaw          0.01°, from VehicleState::attitudeDeg()
+ *  11  i16  accRoll, accPitch         0.01°, from VehicleState::accAnglesDeg()
+ *  15  i16  gyro roll, pitch, yaw     0.1°/s
+ *  21  u16  rc[6]                     µs
+ *  33  u16  motors[8]                 µs, unused motors 1000
+ *  49  u16  voltage                   mV
+ *  51  u8   flags: bit0 armed, bit1 signal lost
+ *  52  u8   motor count
+ *
+ * Out-of-range values saturate. The dashboard page decodes the same layout with a DataView.
+ */
+constexpr uint8_t kTelemetryPacketVersion = 2; // 2: eight motors + count
+constexpr size_t kTelemetryPacketBytes = 53;
+
+void packTelemetry(const VehicleState& state, uint8_t* out);
+// false on a short buffer or unknown version
+bool unpackTelemetry(const uint8_t* in, size_t len, VehicleState& state);
+
+/**
+ * @brief One Server-Sent Events message carrying a packed frame as base64:
+ * "data:<72 chars>\n\n". Returns characters written (no terminator counted), 0 if cap
+ * is too small.
+ */
+constexpr size_t kTelemetryEventBytes = 5 + (kTelemetryPacketBytes + 2) / 3 * 4 + 2;
+size_t formatTelemetryEvent(const VehicleState& state, char* out, size_t cap);
+
+#endif // TELEMETRYPACKET_H
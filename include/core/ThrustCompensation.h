@@ -0,0 +1,58 @@
+#ifndef THRUSTCOMPENSATION_H
+#define THRUSTCOMPENSATION_H
+
+#include "core/PtFilter.h"
+#include <cstdint>
+
+struct ThrustCompensationConfig {
+    static constexpr uint8_t kCurvePoints = 11; // commands 1000, 1100, ... 2000 µs
+
+    bool linearize = false;       // mixer outputs are thrust fractions, not raw commands
+    bool sagCompensation = false; // scale thrust by (referenceVoltage / pack voltage)²
+    // Static thrust at each curve point, normalised to full command; rising from 0 to 1.
+    // Measure per motor/prop with a thrust stand. Defaults match the native QuadPhysics plant.
+    float thrust[kCurvePoints] = {0.0f, 0.037f, 0.088f, 0.153f, 0.232f, 0.325f,
+                                  0.432f, 0.553f, 0.688f, 0.837f, 1.0f};
+    float referenceVoltage = 11.1f; // pack voltage the PID gains were tuned at
+    float minVoltage = 6.0f;        // below this there is no pack (USB power): no scaling
+    float maxBoost = 1.4f;          // clamp on the sag scale; a pack above Vref gets 1, never less
+    float voltageCutoffHz = 1.0f;   // PT1 on the pack reading; throttle punches stay out
+};
+
+/**
+ * @brief Maps mixer outputs to ESC commands so equal steps give equal thrust steps at any
+ * pack voltage. Rotor speed follows duty × voltage and thrust follows speed², so a sagging
+ * pack loses thrust — and rate-loop gain — as (V / Vref)². Per motor:
+ *   t  = linearize ? mixer output : curve(mixer output)    (normalised thrust)
+ *   t' = t · clamp((Vref / V)², 1, maxBoost)
+ *   command = curve⁻¹(t')                                  (uniform inverse LUT)
+ * inputFor() runs the chain backwards so the mixer can desaturate in its own domain.
+ */
+class ThrustCompensation {
+public:
+    static constexpr uint8_t kInversePoints = 33;
+
+    // Flight task, disarmed. false (and inactive) if the curve is not rising from 0 to 1.
+    bool configure(const ThrustCompensationConfig& config, float sampleHz);
+    const ThrustCompensationConfig& config() const { return config_; }
+    bool active() const { return valid_ && (config_.linearize || config_.sagCompensation); }
+
+    void updateVoltage(float volts); // every tick before apply()
+    float thrustScale() const { return scale_; }
+
+    int apply(int us) const;    // mixer output µs → ESC command µs
+    int inputFor(int us) const; // mixer output that apply() maps onto us
+
+    float curveThrust(float command) const; // both normalised 0..1
+    float curveCommand(float thrust) const;
+
+private:
+    ThrustCompensationConfig config_;
+    bool valid_ = false;
+    bool primed_ = false;
+    float scale_ = 1.0f;
+    Pt1Filter voltage_;
+    float inverse_[kInversePoints] = {};
+};
+
+#endif // THRUSTCOMPENSATION_H
@@ -0,0 +1,43 @@
+#ifndef VEHICLESTATE_H
+#define VEHICLESTATE_H
+
+#include "core/AttitudeMath.h"
+#include "core/Seqlock.h"
+#include <cstdint>
+
+/**
+ * @brief Everything other tasks may want from the flight loop, published by
+ * FlightController once per tick. Readers (LED, web dashboard) take a Seqlock copy
+ * instead of calling into the IMU/receiver drivers the flight task owns.
+ *
+ * Attitude and accel are published raw (quaternion, g vector) so the 1 kHz tick does no
+ * trig; readers convert with attitudeDeg() / accAnglesDeg(). The estimator only runs
+ * while armed: disarmed snapshots hold the attitude of the last armed tick (level before
+ * the first arm), so show it as live only when armed. accel is live on every tick.
+ */
+struct VehicleState {
+    static constexpr int kChannels = 6;
+    static constexpr int kMotors = 8;          // IMotors::kMaxMotors
+
+    uint32_t tick = 0;                         // FlightController loop counter
+    Quaternion attitude;                       // estimator, body to world; stale while disarmed
+    float accel[3] = {0, 0, 1};                // g, body axes, as read this tick
+    float gyro[3] = {};                        // filtered rates when armed, else raw - bias, deg/s
+    int16_t rc[kChannels] = {};                // µs as seen by the flight task (incl. overrides)
+    int16_t motors[kMotors] = {};              // last command written, µs
+    uint8_t motorCount = 4;                    // live entries in motors[] (mixer frame)
+    float voltage = 0;                         // V
+    bool armed = false;                        // motors live
+    bool signalLost = false;
+
+    void attitudeDeg(float& roll, float& pitch, float& yaw) const {
+        rollPitchDegFromQuaternion(attitude, roll, pitch);
+        yaw = yawDegFromQuaternion(attitude);
+    }
+    // Accelerometer-only angles, deg (IIMU::getAccAngles() convention)
+    void accAnglesDeg(float& roll, float& pitch) const { accAnglesFromAccel(accel[0], accel[1], accel[2], roll, pitch); }
+};
+
+using VehicleStateLock = Seqlock<VehicleState>;
+
+#endif // VEHICLESTATE_H
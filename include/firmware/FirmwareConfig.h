@@ -0,0 +1,37 @@
+#ifndef FIRMWARECONFIG_H
+#define FIRMWARECONFIG_H
+
+#include "core/LoopRateConfig.h"
+#include "core/MotorMixer.h"
+#include "hardware/MPU6500IMU.h"
+#include <cstdint>
+
+// Build-time firmware choices; the hardware objects and tasks read them from here.
+
+// Mixer motor order; hex/octo list 6/8 pins. Analog PWM at 250 Hz is the default and keeps
+// the existing ESC calibration. kDShot opts into DShot600: a frame every tick, no endpoint
+// calibration, ESC commands from the dashboard. Bidirectional DShot (Bluejay/BLHeli_32)
+// returns eRPM; setup() then enables the harmonic notches and centres them on it.
+constexpr bool kDShot = false;
+constexpr bool kDShotBidirectional = false;
+constexpr uint8_t kMotorPoles = 14;
+
+// 1 kHz gyro + rate PID + mixer; estimator, angle PIDs and RC at 250 Hz; blackbox every tick.
+// Analog PWM latches at 250 Hz, so extra inner ticks buy disturbance rejection, not output
+// rate; with kDShot every tick reaches the ESCs.
+constexpr LoopRateConfig kLoopRates{1000, 4, 4, 1};
+// Fifo: 8 kHz gyro averaged down to each 1 kHz tick (lower noise, no 41 Hz DLPF lag),
+// paced by the busy-wait timer. DataReady instead paces the loop from the INT pin at 1 kHz.
+constexpr ImuAcquisitionMode kImuMode = ImuAcquisitionMode::Fifo;
+// Static gyro lowpass after the notches: a PT1, then a Butterworth biquad; 0 Hz turns a stage
+// off. 250 Hz costs ~11 degrees of phase at 50 Hz, the far end of what the rate loop reacts to.
+constexpr float kGyroLowpassPt1Hz = 250.0f;
+constexpr float kGyroLowpassBiquadHz = 0.0f;
+// Keep serving while armed so gains can be tuned in flight (POST /api/pid goes live next
+// tick); overrides, motor test and ESC calibration still refuse while armed. false restores
+// the dashboard-only-on-the-ground behaviour.
+constexpr bool kLiveTuning = true;
+// Motor layout; FlightController refuses a frame with more motors than physicalMotors has pins.
+constexpr FrameType kFrame = FrameType::QuadX;
+
+#endif // FIRMWARECONFIG_H
@@ -0,0 +1,31 @@
+#ifndef FIRMWAREHARDWARE_H
+#define FIRMWAREHARDWARE_H
+
+#ifndef NATIVE_BUILD
+#include "hardware/MPU6500IMU.h"
+#include "hardware/IBusReceiverDriver.h"
+#include "hardware/PWMESP32Motors.h"
+#include "hardware/DShotESP32Motors.h"
+#include "hardware/ADCBatteryMonitor.h"
+#include "hardware/QMC5883LCompass.h"
+#include "hardware/ESP32LEDIndicator.h"
+#include "network/WebDashboardServer.h"
+#include "core/FlightController.h"
+
+// The firmware's single instances, defined in FirmwareHardware.cpp: setup() wires them,
+// the FreeRTOS tasks in FirmwareTasks.cpp run them.
+extern MPU6500IMU physicalImu;
+extern IBusReceiverDriver physicalPpm;
+extern DShotESP32Motors dshotMotors;
+extern PWMESP32Motors pwmMotors;
+extern IMotors& physicalMotors; // whichever of the two kDShot selects
+extern ADCBatteryMonitor physicalBattery;
+extern ESP32LEDIndicator physicalIndicator;
+extern QMC5883LCompass physicalCompass;
+extern WebDashboardServer webServer;
+extern BlackboxLog blackbox;
+extern TelemetryRing telemetry;
+extern FlightController fc;
+#endif // NATIVE_BUILD
+
+#endif // FIRMWAREHARDWARE_H
@@ -0,0 +1,14 @@
+#ifndef FIRMWARETASKS_H
+#define FIRMWARETASKS_H
+
+#ifndef NATIVE_BUILD
+// FreeRTOS task bodies; setup() pins the flight task to core 1 and the rest to core 0.
+void batteryMonitorTask(void* pvParameters);
+void flightControlTask(void* pvParameters);
+void gyroAnalysisTask(void* pvParameters);
+void compassTask(void* pvParameters);
+void telemetryTask(void* pvParameters);
+void webDashboardTask(void* pvParameters);
+#endif // NATIVE_BUILD
+
+#endif // FIRMWARETASKS_H
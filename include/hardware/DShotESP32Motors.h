@@ -0,0 +1,70 @@
+#ifndef DSHOTESP32MOTORS_H
+#define DSHOTESP32MOTORS_H
+
+#include "interfaces/IMotors.h"
+#include "core/DShot.h"
+#include "core/DShotTelemetry.h"
+#include <atomic>
+#include <initializer_list>
+
+/**
+ * @brief ESP32 DShot ESC driver on the RMT peripheral, one TX channel per pin (up to 8).
+ * writeMotors() encodes every channel's frame into its RMT RAM, then starts the channels
+ * back to back, so all outputs leave within a few µs of each other and a DShot600 frame is
+ * on the wire in ~27 µs. ESCs need a steady frame stream to stay armed: call writeMotors()
+ * every loop tick, disarmed included. No endpoint calibration.
+ *
+ * Bidirectional: frames go out inverted on an open-drain pin and channel i+4 listens on the
+ * same pin for the ESC's eRPM reply, so at most 4 motors. Each writeMotors() drains the
+ * previous tick's captures (our own frame is refused by the decoder) before sending.
+ */
+class DShotESP32Motors : public IMotors {
+public:
+    static constexpr int kMaxBidirectional = kMaxMotors / 2;
+    static constexpr uint8_t kRpmStaleTicks = 8; // ticks without a good reply before rpm is dropped
+
+    explicit DShotESP32Motors(std::initializer_list<int> pins, DShotRate rate = DShotRate::DShot600,
+                              bool bidirectional = false, uint8_t motorPoles = 14);
+
+    void init();
+    void writeMotors(const int* us, int count) override;
+    int motorCount() const override { return count_; }
+
+    bool isDigital() const override { return true; }
+    // Replaces the stop frame of a stopped motor for dshotCommandRepeats() ticks
+    bool sendCommand(uint8_t command, int motorIdx) override;
+    // Bidirectional only, and only while every motor has replied within kRpmStaleTicks
+    bool getMotorRpm(float* rpm) const override;
+    uint32_t telemetryErrors() const { return telemetryErrors_; }
+
+    // Simulation/Override functionality
+    void setOverride(int motorIdx, int value, bool active) override;
+    int getMotorOutput(int motorIdx) const override;
+    bool isMotorOverridden(int motorIdx) const override;
+
+private:
+    DShotEncoder encoder_;
+    int count_ = 0;
+    int pins_[kMaxMotors] = {};
+    int outputs_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
+    // Web task queues, flight task sends: command_ is published by the release on commandTicks_
+    uint8_t command_[kMaxMotors] = {};
+    std::atomic<uint8_t> commandTicks_[kMaxMotors] = {}; // frames of command_ still to send
+    uint32_t items_[kMaxMotors][DShotEncoder::kItems] = {};
+    bool bidirectional_ = false;
+    uint8_t motorPoles_ = 14;
+    float rpm_[kMaxMotors] = {};
+    uint8_t rpmAge_[kMaxMotors] = {};
+    uint32_t telemetryErrors_ = 0;
+    void* rx_[kMaxMotors] = {}; // RingbufHandle_t of each RX channel
+
+    // Override states
+    bool oActive_[kMaxMotors] = {};
+    int oVal_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
+
+    uint16_t nextFrame(int motorIdx);
+    void initChannel(int motorIdx);
+    void readTelemetry();
+};
+
+#endif // DSHOTESP32MOTORS_H
@@ -11,6 +11,7 @@ public:
     void readSensor() override;
     void getGyroRates(float& rollRate, float& pitchRate, float& yawRate) const override;
     void getAccAngles(float& rollAngle, float& pitchAngle) const override;
+    void getAccel(float& ax, float& ay, float& az) const override;
 
     // Simulation/Override functionality
     void setOverride(float rollRate, float pitchRate, float yawRate,
@@ -21,6 +22,7 @@ public:
 private:
     float rollRate_ = 0.0f, pitchRate_ = 0.0f, yawRate_ = 0.0f;
     float rollAngle_ = 0.0f, pitchAngle_ = 0.0f;
+    float accel_[3] = {0.0f, 0.0f, 1.0f};
 
     // Override states
     bool overrideActive_ = false;
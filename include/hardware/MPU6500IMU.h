@@ -2,20 +2,45 @@
 #define MPU6500IMU_H
 
 #include "interfaces/IIMU.h"
+#include "core/GyroFifoDecimator.h"
+#include "core/AttitudeMath.h"
 #include <Arduino.h>
+#include <atomic>
+
+#ifndef NATIVE_BUILD
+#include <driver/spi_master.h>
+#endif
+
+enum class ImuAcquisitionMode : uint8_t {
+    Polled,    // Arduino SPI, 14 bytes clocked on demand inside readSensor()
+    DataReady, // INT edge starts a DMA burst; the flight task wakes on the completed buffer
+    Fifo       // 8 kHz gyro queued in the sensor FIFO, drained and averaged once per loop
+};
 
 /**
  * @brief SPI hardware driver for the MPU6500 IMU, implementing the abstract IIMU interface.
  */
 class MPU6500IMU : public IIMU {
 public:
-    MPU6500IMU(uint8_t csPin);
-    void begin();
+    MPU6500IMU(uint8_t csPin, int8_t intPin = -1);
+    void begin(ImuAcquisitionMode mode = ImuAcquisitionMode::Polled);
     bool isConnected();
+    ImuAcquisitionMode mode() const { return mode_; }   // Polled if DataReady setup failed
+
+    // DataReady mode only: blocks until the DMA burst of the next sample has completed (no
+    // bus work on the calling task). false on timeout, so the caller can still run failsafe.
+    bool waitForSample(uint32_t timeoutUs);
+    uint32_t lastSampleUs() const { return lastSampleUs_; }   // INT edge timestamp
+    uint32_t missedSamples() const { return missedSamples_.load(std::memory_order_relaxed); }
+
+    // Fifo mode only: overflows (FIFO reset, previous rates held) and frames in the last drain
+    uint32_t fifoOverflows() const { return fifoOverflows_.load(std::memory_order_relaxed); }
+    uint16_t fifoLastBatch() const { return fifo_.lastFrames(); }
 
     void readSensor() override;
     void getGyroRates(float& rollRate, float& pitchRate, float& yawRate) const override;
     void getAccAngles(float& rollAngle, float& pitchAngle) const override;
+    void getAccel(float& ax, float& ay, float& az) const override;
 
     void setOverride(float rollRate, float pitchRate, float yawRate,
                       float rollAngle, float pitchAngle) override;
@@ -25,25 +50,50 @@ public:
 private:
     static constexpr float GYRO_SCALE  = 65.5f;    // LSB/(deg/s) for ±500 dps (reg 0x1B=0x08)
     static constexpr float ACCEL_SCALE = 8192.0f;  // LSB/g for ±4 g            (reg 0x1C=0x08)
-    static constexpr float kRadToDeg   = 57.2957795f; // 180/π
+    static constexpr uint8_t kBurstLen = 14;       // ACCEL_XOUT_H .. GYRO_ZOUT_L
+    static constexpr uint16_t kFifoBytes = 512;    // MPU6500 FIFO size
 
     uint8_t cs_;
+    int8_t intPin_;
+    ImuAcquisitionMode mode_ = ImuAcquisitionMode::Polled;
     float rollRate_ = 0.0f, pitchRate_ = 0.0f, yawRate_ = 0.0f;
-    float rollAngle_ = 0.0f, pitchAngle_ = 0.0f;
+    float accel_[3] = {0.0f, 0.0f, 1.0f};   // g; angles are derived only when asked for
+
+    // DataReady double buffer: DMA fills the back half, its completion callback flips frontIdx_
+    alignas(4) uint8_t burstRx_[2][16] = {{0}};
+    std::atomic<uint8_t> frontIdx_{0};
+    volatile uint32_t lastSampleUs_ = 0;
+    std::atomic<uint32_t> missedSamples_{0};
+
+    alignas(4) uint8_t fifoBuf_[kFifoBytes] = {0};
+    GyroFifoDecimator fifo_{GYRO_SCALE};
+    std::atomic<uint32_t> fifoOverflows_{0};
 
     // Simulation overrides
     bool oActive_ = false;
     float oRollRate_ = 0.0f, oPitchRate_ = 0.0f, oYawRate_ = 0.0f;
     float oRollAngle_ = 0.0f, oPitchAngle_ = 0.0f;
 
+    void convertSample(const uint8_t* data);
+    void convertAccel(const uint8_t* data);
+    void drainFifo();
+
 #ifndef NATIVE_BUILD
+    spi_device_handle_t dmaDev_ = nullptr;
+    spi_transaction_t burst_ = {};
+    TaskHandle_t waiter_ = nullptr, kicker_ = nullptr;
+    static void IRAM_ATTR onDataReady(void* arg);
+    static void IRAM_ATTR onBurstDone(spi_transaction_t* t);
+    static void kickBursts(void* arg); // queues the DMA burst on each INT edge
+    bool beginDmaBus();
+    void beginFifo();
     void writeReg(uint8_t reg, uint8_t val);
     uint8_t readReg(uint8_t reg);
-    void readBytes(uint8_t reg, uint8_t *buf, uint8_t len);
+    void readBytes(uint8_t reg, uint8_t *buf, uint16_t len); // up to a full FIFO drain
 #else
     void writeReg(uint8_t, uint8_t) {}
     uint8_t readReg(uint8_t) { return 0; }
-    void readBytes(uint8_t, uint8_t*, uint8_t) {}
+    void readBytes(uint8_t, uint8_t*, uint16_t) {}
 #endif
 };
 
@@ -2,16 +2,19 @@
 #define PWMESP32MOTORS_H
 
 #include "interfaces/IMotors.h"
+#include <initializer_list>
 
 /**
  * @brief ESP32 Brushless Motor ESC driver using LEDC hardware PWM.
+ * One LEDC channel per pin, in mixer motor order; up to kMaxMotors pins.
  */
 class PWMESP32Motors : public IMotors {
 public:
-    PWMESP32Motors(int pinM1, int pinM2, int pinM3, int pinM4);
+    explicit PWMESP32Motors(std::initializer_list<int> pins);
 
     void init();
-    void writeMotors(int m1, int m2, int m3, int m4) override;
+    void writeMotors(const int* us, int count) override;
+    int motorCount() const override { return count_; }
 
     // Simulation/Override functionality
     void setOverride(int motorIdx, int value, bool active) override;
@@ -28,12 +31,13 @@ private:
         return (us * LEDC_MAX_DUTY) / PWM_PERIOD_US;
     }
 
-    int pins_[4];
-    int outputs_[4] = {1000, 1000, 1000, 1000};
+    int count_ = 0;
+    int pins_[kMaxMotors] = {};
+    int outputs_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
 
     // Override states
-    bool oActive_[4] = {false, false, false, false};
-    int oVal_[4] = {1000, 1000, 1000, 1000};
+    bool oActive_[kMaxMotors] = {};
+    int oVal_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
 };
 
 #endif // PWMESP32MOTORS_H
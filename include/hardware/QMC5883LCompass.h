@@ -1,17 +1,23 @@
 #ifndef QMC5883LCOMPASS_H
 #define QMC5883LCOMPASS_H
 
+#include "interfaces/ICompass.h"
 #include <Arduino.h>
+#include <atomic>
 
 /**
  * @brief Companion driver for the QMC5883L I2C magnetometer.
  * Provides heading measurements and calibration storage.
+ * update() does the I2C read (~1 ms) and must run outside the flight task; getMag()
+ * only reads the cached sample, so the estimator can call it every attitude tick.
  */
-class QMC5883LCompass {
+class QMC5883LCompass : public ICompass {
 public:
     QMC5883LCompass();
     bool begin();
-    void readMag(float &mx, float &my, float &mz);
+    bool readMag(float &mx, float &my, float &mz);
+    void update();
+    bool getMag(float& mx, float& my, float& mz) const override;
     float getHeading();
     void setCalibration(float ox, float oy, float oz, float sx, float sy, float sz);
 
@@ -20,6 +26,11 @@ private:
     float offset_[3] = {0.0f, 0.0f, 0.0f};
     float scale_[3] = {1.0f, 1.0f, 1.0f};
 
+    // Written by update() on core 0, read by the flight task; per-axis tearing across
+    // one 50 Hz sample is harmless for a slowly varying field
+    std::atomic<float> cached_[3];
+    std::atomic<bool> valid_{false};
+
     bool writeReg(uint8_t reg, uint8_t val);
     bool readRegs(uint8_t reg, uint8_t *buf, uint8_t count);
 };
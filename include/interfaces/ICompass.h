@@ -0,0 +1,20 @@
+#ifndef ICOMPASS_H
+#define ICOMPASS_H
+
+/**
+ * @brief Abstract interface for a magnetometer feeding the attitude estimator.
+ * Axes must match the IMU body frame; remap in the driver if the module is rotated.
+ */
+class ICompass {
+public:
+    virtual ~ICompass() = default;
+
+    /**
+     * @brief Latest calibrated field vector (any consistent unit).
+     * Must be cheap and non-blocking: it is called from the flight loop.
+     * @return false until a valid sample exists.
+     */
+    virtual bool getMag(float& mx, float& my, float& mz) const = 0;
+};
+
+#endif // ICOMPASS_H
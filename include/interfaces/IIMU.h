@@ -24,6 +24,12 @@ public:
      */
     virtual void getAccAngles(float& rollAngle, float& pitchAngle) const = 0;
 
+    /**
+     * @brief Gets the accelerometer vector (g) in body axes; (0, 0, 1) when level at rest.
+     * In override mode this is the 1 g vector implied by the override angles.
+     */
+    virtual void getAccel(float& ax, float& ay, float& az) const = 0;
+
     /**
      * @brief Sets manual override values to simulate custom flight conditions.
      */
@@ -1,18 +1,28 @@
 #ifndef IMOTORS_H
 #define IMOTORS_H
 
+#include <stdint.h>
+
 /**
  * @brief Abstract interface for controlling ESC motor outputs.
  * Directs motor speeds and tracks final outputs, with override capabilities.
  */
 class IMotors {
 public:
+    static constexpr int kMaxMotors = 8; // octo
+
     virtual ~IMotors() = default;
 
     /**
-     * @brief Writes output speed values to the 4 ESC motors (typical range: 1000 to 2000).
+     * @brief Writes one output speed per ESC (typical range: 1000 to 2000).
+     * count is at most motorCount(); outputs past count are left untouched.
      */
-    virtual void writeMotors(int m1, int m2, int m3, int m4) = 0;
+    virtual void writeMotors(const int* us, int count) = 0;
+
+    /**
+     * @brief Number of ESC outputs this driver was set up with.
+     */
+    virtual int motorCount() const = 0;
 
     /**
      * @brief Simulates physical hardware conditions by overriding a motor speed output.
@@ -28,6 +38,23 @@ public:
      * @brief Checks if a specific motor's output is currently overridden.
      */
     virtual bool isMotorOverridden(int motorIdx) const = 0;
+
+    /**
+     * @brief True for digital protocols (DShot): no endpoint calibration, ESC commands supported.
+     */
+    virtual bool isDigital() const { return false; }
+
+    /**
+     * @brief Queues an ESC command (DShot: a DShotCommand value) for one motor, or all with -1.
+     * Sent only while that motor is stopped; false if the protocol has no commands.
+     */
+    virtual bool sendCommand(uint8_t command, int motorIdx) { (void)command; (void)motorIdx; return false; }
+
+    /**
+     * @brief Rotor speed per motor (RPM) from ESC telemetry, e.g. bidirectional DShot eRPM.
+     * false when the driver has none, or any motor's telemetry has gone stale.
+     */
+    virtual bool getMotorRpm(float* rpm) const { (void)rpm; return false; }
 };
 
 #endif // IMOTORS_H
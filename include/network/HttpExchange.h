@@ -0,0 +1,82 @@
+#ifndef HTTPEXCHANGE_H
+#define HTTPEXCHANGE_H
+
+#include "network/HttpTypes.h"
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @brief One connection slot of HttpServer: the request being read and the response
+ * being sent, in fixed buffers (kRequestBytes + kResponseBytes + kBodyStateBytes).
+ * Handlers see the parsed request and answer exactly once with send(), sendStatic(),
+ * sendAsset() or stream(); every response is "Connection: close".
+ */
+class HttpExchange {
+public:
+    static constexpr size_t kRequestBytes = 1024;   // request line + headers + form body
+    static constexpr size_t kResponseBytes = 1536;  // headers + copied body / one body chunk
+    static constexpr size_t kBodyStateBytes = 1280; // room for the stream() body object
+    static constexpr uint8_t kMaxArgs = 16;
+
+    HttpExchange() = default;
+    HttpExchange(const HttpExchange&) = delete;
+    HttpExchange& operator=(const HttpExchange&) = delete;
+    ~HttpExchange() { endBody(); }
+
+    HttpMethod method() const { return method_; }
+    const char* path() const { return path_; }
+    HttpArg arg(const char* name) const;
+    const char* ifNoneMatch() const { return ifNoneMatch_; } // "" when absent
+
+    // Body copied into the send buffer; too large for it → 500
+    void send(int code, const char* contentType, const char* content);
+    // Body sent straight from content (flash / static storage), any size
+    void sendStatic(int code, const char* contentType, const char* content, size_t len);
+    // Gzipped flash asset; 304 without a body when the client already holds its ETag
+    void sendAsset(const HttpAsset& asset);
+    // Open-ended body built in place; sent until it returns IHttpBody::kDone or the peer leaves
+    template <typename Body, typename... Args>
+    void stream(int code, const char* contentType, Args&&... args) {
+        static_assert(sizeof(Body) <= kBodyStateBytes, "body state exceeds the per-connection budget");
+        static_assert(alignof(Body) <= alignof(std::max_align_t), "over-aligned body");
+        if (!writeHeader(code, contentType, -1, "Cache-Control: no-cache\r\n")) return;
+        body_ = new (bodyState_) Body(std::forward<Args>(args)...);
+    }
+    bool responded() const { return responded_; }
+
+private:
+    friend class HttpServer;
+    enum class Phase : uint8_t { Idle, Reading, Writing };
+    enum class Parse : uint8_t { Incomplete, Ready, TooLarge, Malformed };
+
+    void open(int fd, uint32_t nowMs);
+    void endBody();
+    // contentLength -1: until close; extraHeaders: complete "Name: value\r\n" lines
+    bool writeHeader(int code, const char* contentType, long contentLength, const char* extraHeaders = "");
+    Parse parse();               // HttpRequestParse.cpp
+    void addArgs(char* encoded); // splits a=b&c=d in place
+
+    int fd_ = -1;
+    Phase phase_ = Phase::Idle;
+    uint32_t lastActivityMs_ = 0;
+
+    char rx_[kRequestBytes + 1];
+    size_t rxLen_ = 0;
+    HttpMethod method_ = HttpMethod::Other;
+    const char* path_ = "";
+    const char* ifNoneMatch_ = "";
+    const char* argName_[kMaxArgs];
+    const char* argValue_[kMaxArgs];
+    uint8_t argCount_ = 0;
+
+    char tx_[kResponseBytes];
+    size_t txLen_ = 0, txPos_ = 0;
+    const char* static_ = nullptr;
+    size_t staticLen_ = 0, staticPos_ = 0;
+    alignas(std::max_align_t) unsigned char bodyState_[kBodyStateBytes];
+    IHttpBody* body_ = nullptr;
+    bool responded_ = false;
+};
+
+#endif // HTTPEXCHANGE_H
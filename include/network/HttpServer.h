@@ -0,0 +1,64 @@
+#ifndef HTTPSERVER_H
+#define HTTPSERVER_H
+
+#include "network/HttpExchange.h"
+#include <cstdint>
+
+/**
+ * @brief Event-driven HTTP/1.1 server on non-blocking BSD sockets (lwIP on the ESP32,
+ * the host stack in native builds). poll() accepts, reads, dispatches and writes
+ * whatever is ready on every connection and returns without waiting, so one slow
+ * client never stalls the others or the task that polls. Memory is fixed: a route
+ * table and kMaxConnections HttpExchange slots; a client beyond that gets 503. A client
+ * that stops sending its request or stops reading its response loses its slot.
+ */
+class HttpServer {
+public:
+    static constexpr uint8_t kMaxConnections = 4;
+    static constexpr uint8_t kMaxRoutes = 24;
+    static constexpr uint32_t kRequestTimeoutMs = 5000; // request must arrive within this
+    static constexpr uint32_t kWriteStallTimeoutMs = 5000; // client must keep taking the response
+    static constexpr size_t kSendBudgetBytes = 4096;    // per connection per poll()
+
+    using Handler = void (*)(HttpExchange&);
+
+    HttpServer() = default;
+    HttpServer(const HttpServer&) = delete;
+    HttpServer& operator=(const HttpServer&) = delete;
+    ~HttpServer() { stop(); }
+
+    // false once the route table is full
+    bool on(HttpMethod method, const char* path, Handler handler);
+    // Listens on all interfaces; port 0 picks a free one (see port())
+    bool begin(uint16_t port);
+    void stop();
+    bool running() const { return listenFd_ >= 0; }
+    uint16_t port() const { return port_; }
+
+    void poll(uint32_t nowMs);
+
+    uint8_t openConnections() const;
+    uint32_t rejectedConnections() const { return rejected_; }
+
+private:
+    struct Route {
+        HttpMethod method;
+        const char* path;
+        Handler handler;
+    };
+
+    Route routes_[kMaxRoutes];
+    uint8_t routeCount_ = 0;
+    int listenFd_ = -1;
+    uint16_t port_ = 0;
+    uint32_t rejected_ = 0;
+    HttpExchange conns_[kMaxConnections];
+
+    void acceptPending(uint32_t nowMs);
+    void readRequest(HttpExchange& c, uint32_t nowMs);
+    void dispatch(HttpExchange& c);
+    void writeResponse(HttpExchange& c, uint32_t nowMs);
+    void drop(HttpExchange& c);
+};
+
+#endif // HTTPSERVER_H
@@ -0,0 +1,27 @@
+#ifndef HTTPSOCKET_H
+#define HTTPSOCKET_H
+
+// BSD socket API: lwIP on the ESP32, the host stack in native builds
+#ifndef NATIVE_BUILD
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // lwIP never raises SIGPIPE
+#endif
+
+inline bool httpSetNonBlocking(int fd) {
+    const int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+inline bool httpWouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR; }
+
+#endif // HTTPSOCKET_H
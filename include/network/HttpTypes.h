@@ -0,0 +1,54 @@
+#ifndef HTTPTYPES_H
+#define HTTPTYPES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+enum class HttpMethod : uint8_t { Get, Post, Other };
+
+/**
+ * @brief One decoded query or form argument; "" when absent. Points into the
+ * connection's request buffer, so it is only valid inside the handler.
+ */
+class HttpArg {
+public:
+    explicit HttpArg(const char* value) : value_(value ? value : "") {}
+    const char* c_str() const { return value_; }
+    size_t length() const { return std::strlen(value_); }
+    int toInt() const { return std::atoi(value_); }
+    float toFloat() const { return std::strtof(value_, nullptr); }
+    bool operator==(const char* other) const { return std::strcmp(value_, other) == 0; }
+
+private:
+    const char* value_;
+};
+
+/**
+ * @brief Response body produced on demand, for bodies larger than the connection's
+ * send buffer or open-ended streams. The server calls read() whenever the socket has
+ * drained the previous chunk; implementations keep their own position.
+ */
+class IHttpBody {
+public:
+    static constexpr int kDone = -1;
+    virtual ~IHttpBody() = default;
+    // Writes up to cap bytes; returns the count, 0 if nothing is ready yet, or kDone.
+    virtual int read(char* out, size_t cap, uint32_t nowMs) = 0;
+};
+
+/**
+ * @brief A gzip-compressed static file in flash (see tools/build_web_assets.py),
+ * served as-is with Content-Encoding: gzip and revalidated by ETag.
+ */
+struct HttpAsset {
+    const char* path;
+    const char* contentType;
+    const char* cacheControl;
+    const uint8_t* data;
+    size_t len;
+    const char* etag; // quoted, as sent
+};
+
+#endif // HTTPTYPES_H
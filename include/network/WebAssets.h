@@ -0,0 +1,296 @@
+// Generated by tools/build_web_assets.py from web/ - edit those files, not this one.
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include "network/HttpTypes.h"
+
+// /: 7696 B source, 7338 B minified, 1979 B gzip
+alignas(4) static const uint8_t kWebAsset0[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x59,0xcd,0x72,0xe3,0x36,
+    0x12,0x7e,0x95,0x5e,0x6e,0x95,0xad,0xa9,0x1a,0xeb,0xd7,0x1a,0xcf,0xda,0x92,0xb6,
+    0x34,0xb2,0x27,0x33,0x9b,0x38,0xe3,0xb2,0x9c,0xd4,0xe6,0xe4,0x02,0x49,0x50,0x44,
+    0x0c,0x02,0x5c,0x00,0x92,0xad,0x1c,0xf6,0x1d,0xf6,0xb8,0xb7,0x75,0xed,0x39,0xb7,
+    0x9c,0x26,0x87,0x1c,0x9c,0x17,0xf1,0x9b,0x6c,0x03,0x24,0x25,0x9b,0xfa,0xb1,0x34,
+    0xca,0xba,0x4a,0x2e,0x82,0x6c,0xf4,0xd7,0xe8,0x9f,0x0f,0x4d,0xb0,0xf3,0xa7,0xd3,
+    0x4f,0x83,0xab,0x1f,0x2e,0xce,0x20,0x36,0x09,0xef,0x75,0xf2,0xff,0x94,0x84,0xbd,
+    0x8e,0x61,0x86,0xd3,0xde,0xd9,0xf0,0xa2,0xd5,0x84,0x53,0x25,0x05,0x85,0x53,0xa2,
+    0x63,0x5f,0x12,0x15,0x76,0x6a,0xd9,0xc3,0x4e,0x42,0x0d,0x01,0x41,0x12,0xda,0xf5,
+    0x26,0x8c,0xde,0xa6,0x52,0x19,0x0f,0x02,0x29,0x0c,0x15,0xa6,0xeb,0xdd,0xb2,0xd0,
+    0xc4,0xdd,0x90,0x4e,0x58,0x40,0x0f,0xdc,0xe0,0x35,0x30,0xc1,0x0c,0x23,0xfc,0x40,
+    0x07,0x84,0xd3,0x6e,0xc3,0xeb,0x75,0x38,0x13,0x37,0xa0,0x28,0xef,0x7a,0xda,0x4c,
+    0x39,0xd5,0x31,0xa5,0xa8,0x24,0x56,0x34,0xea,0x7a,0x35,0x92,0xa6,0xd5,0x40,0xeb,
+    0xbf,0x4e,0xba,0xcd,0x56,0xfb,0x28,0x6a,0x1c,0xfe,0xa5,0xfe,0xf6,0x0d,0xc1,0x59,
+    0xb5,0xcc,0x48,0x5f,0x86,0x53,0x34,0xb8,0xb1,0xca,0x4e,0x7c,0xd2,0x09,0xd9,0x04,
+    0x02,0x4e,0xb4,0xee,0x7a,0x01,0xde,0xc4,0xc9,0x71,0xb3,0x77,0x35,0x16,0x4c,0x8c,
+    0xe0,0xe2,0xe3,0x29,0x5c,0x10,0x85,0x2b,0x30,0x54,0x69,0x94,0x6f,0xf6,0x3a,0x91,
+    0x54,0x09,0xb0,0xb0,0xeb,0xa5,0x2c,0x7c,0x8f,0xd7,0xde,0x33,0x15,0x4a,0xde,0xe2,
+    0x0d,0xbf,0x77,0x49,0x0c,0x85,0x4b,0xc9,0xf9,0x71,0xa7,0xe6,0xf7,0xe0,0xeb,0xb4,
+    0xc3,0x44,0x3a,0x36,0x60,0xa6,0x29,0x7a,0x43,0x8c,0x13,0x9f,0x2a,0x0f,0xb4,0xa1,
+    0x69,0xd7,0xab,0x57,0xeb,0xf5,0x86,0xe7,0x74,0xaa,0xeb,0x9b,0xd4,0x43,0x71,0xb6,
+    0xb1,0x38,0xb3,0xe2,0xe1,0xc6,0xe2,0x76,0x7d,0x35,0xb4,0x77,0xb5,0xd1,0x17,0xcc,
+    0x04,0xf1,0x76,0x56,0xa7,0xdb,0x59,0x9d,0x6e,0x67,0x75,0xba,0x89,0xd5,0x3f,0x90,
+    0xdb,0xed,0x6c,0x9e,0x6e,0x67,0xf3,0x74,0x3b,0x9b,0xa7,0x2f,0xd8,0xdc,0x17,0x23,
+    0xbe,0x45,0x7e,0x14,0xf1,0x23,0xb9,0xd1,0xe1,0xa6,0xd2,0x1b,0x18,0xb1,0x79,0xbc,
+    0x8b,0x78,0x6c,0x65,0x45,0xfa,0x92,0x15,0x1f,0x0f,0xb0,0xb6,0x92,0xcc,0x80,0x3e,
+    0x53,0x89,0x0c,0xe9,0x33,0xbd,0x41,0x4c,0x83,0x1b,0x5f,0xde,0x65,0xea,0x48,0x26,
+    0x81,0xf0,0x97,0x94,0x93,0x3b,0x08,0xe9,0xa8,0xa6,0xd7,0xd8,0x91,0x5b,0xc1,0xae,
+    0x95,0x15,0xc7,0x69,0x7d,0x61,0x18,0xb2,0x8d,0x08,0xc7,0x29,0x6c,0x32,0x93,0xdc,
+    0x5e,0x8f,0x08,0x13,0xb3,0x15,0xf8,0x63,0x63,0xa4,0xc8,0x67,0x64,0x03,0x0f,0xa4,
+    0x08,0x38,0x0b,0x6e,0x90,0xa3,0xc8,0x84,0x22,0x69,0x54,0x5e,0x79,0xbd,0x7e,0x9a,
+    0xf2,0xa9,0x65,0x10,0x5c,0x99,0x13,0x43,0x0d,0x96,0x3b,0x90,0xd2,0x88,0x4f,0x91,
+    0x47,0x57,0x2f,0x12,0x99,0xe5,0x02,0xf9,0x86,0x69,0x4b,0x97,0xf6,0x09,0x0d,0x7b,
+    0x30,0x44,0xd5,0x60,0x24,0x44,0xe8,0xbe,0x18,0x2a,0x24,0x42,0xb7,0x01,0x27,0x22,
+    0xb4,0x44,0xc5,0x22,0x20,0x2a,0xa1,0xe1,0xab,0x4e,0x2d,0xd7,0xae,0x53,0x22,0x0a,
+    0x65,0x43,0x43,0xcc,0x58,0xdb,0x25,0xd8,0xbb,0x4b,0x62,0x31,0x27,0x3e,0xeb,0xd5,
+    0x29,0xf4,0xc7,0x46,0x9a,0xb1,0xa0,0x19,0xe3,0x95,0x83,0xf6,0x41,0x4e,0x10,0x9a,
+    0x09,0x20,0x2e,0x81,0x6c,0x3c,0x5e,0x83,0x89,0xa9,0x40,0xcf,0x11,0x65,0xaa,0x70,
+    0x15,0x53,0x20,0x77,0x4c,0xc3,0xad,0xf4,0x7d,0xe4,0x6c,0x20,0x10,0xd1,0x5b,0x1b,
+    0x2b,0x45,0x71,0x84,0x5e,0x80,0x7f,0x36,0x40,0x57,0x57,0x24,0x45,0xdf,0x4e,0xed,
+    0x68,0xca,0x69,0x60,0xb2,0x18,0x18,0x7b,0x0b,0x0d,0x94,0xa9,0x61,0xe8,0xfc,0x09,
+    0xe1,0x63,0x74,0x5a,0xdd,0xeb,0xd9,0x0a,0xea,0xd4,0xb2,0xdb,0xe5,0xc7,0xb8,0x7b,
+    0xb8,0xdc,0x5e,0xf5,0xbc,0xe9,0xf5,0x90,0x35,0xe6,0x4f,0x6b,0x19,0xe2,0x4b,0x21,
+    0x26,0xb9,0x6f,0x2a,0xfb,0x6e,0xb5,0xfb,0x18,0xea,0xa1,0xbd,0x98,0x87,0x79,0xd3,
+    0xf9,0x01,0x11,0x01,0xe5,0x56,0xc1,0xc0,0x5d,0x6d,0xaf,0x81,0xd8,0x1c,0xdb,0x9f,
+    0x25,0x9b,0xa2,0x7a,0xcc,0x9f,0x18,0xb2,0xd4,0xbd,0xe0,0xf6,0xd1,0xae,0x17,0xe1,
+    0x3e,0x7c,0x10,0x91,0x84,0xf1,0xe9,0x71,0x22,0x85,0xc4,0xd4,0x08,0xe8,0x49,0x9e,
+    0xf4,0xa6,0x48,0x19,0x16,0x72,0x9a,0xeb,0x59,0x93,0x35,0xdf,0x30,0xcc,0xcd,0x2b,
+    0x74,0x1f,0x6e,0x94,0x6a,0xba,0x3c,0x6b,0x86,0x46,0x51,0x92,0x3c,0x8b,0xab,0x76,
+    0xb7,0x3e,0xfc,0xe4,0xd6,0x16,0x63,0x36,0x51,0x7b,0x0f,0x7d,0x99,0xc9,0xda,0x2a,
+    0xca,0x63,0xd6,0x6b,0xd4,0x17,0xc2,0x98,0x29,0xc2,0xd2,0x68,0xb6,0xcb,0xcf,0x7a,
+    0xed,0x05,0x71,0xd4,0x50,0x5f,0x8c,0x35,0x7c,0xf8,0x09,0xe6,0xa5,0xc2,0x71,0x19,
+    0xd7,0x51,0xaa,0x67,0x3e,0x4a,0x88,0x1a,0x31,0x71,0xc0,0x69,0x64,0x8e,0x1b,0xf5,
+    0xf4,0xee,0xc4,0xeb,0xd5,0xf3,0x22,0x82,0xc8,0xb6,0x05,0xba,0xa6,0x5f,0x97,0x15,
+    0xe0,0x0a,0x0c,0x12,0xd4,0xc1,0xca,0x6a,0xdb,0x20,0x0a,0xbd,0xbe,0xc1,0x1e,0x6a,
+    0x1c,0xd2,0xb2,0x72,0x62,0x0c,0xda,0x00,0x35,0x70,0xbf,0x1c,0x62,0x0f,0x2b,0xeb,
+    0x04,0xf6,0x84,0xaf,0xd3,0x13,0x38,0x97,0x46,0x2a,0x5d,0x9e,0x97,0x48,0x33,0x37,
+    0xa9,0x10,0x2d,0xc9,0x4c,0x9e,0xac,0xee,0xfb,0x97,0x83,0x7e,0x49,0x03,0xca,0x2c,
+    0x13,0x9c,0x4b,0xec,0xda,0xa4,0x5a,0x1e,0xf6,0xab,0x58,0x49,0x83,0xdd,0xe0,0xf1,
+    0x13,0x34,0x2c,0x40,0x2c,0x3e,0x0c,0xc8,0x0c,0xee,0xe9,0x34,0x9f,0xa8,0xbc,0xa7,
+    0xb2,0xb2,0x38,0x6a,0x7a,0xc5,0xa3,0x88,0x71,0x3e,0x63,0xe2,0x15,0x06,0x3a,0x54,
+    0xb7,0xb3,0x3e,0x47,0x44,0xb6,0x68,0xb4,0x37,0x44,0xac,0x6f,0x8f,0x98,0x6d,0xa3,
+    0xcf,0x21,0x1b,0x5b,0x40,0x36,0xb6,0x87,0xb4,0x3d,0xcf,0x73,0xc0,0xd6,0x16,0x80,
+    0xad,0xed,0x01,0xfb,0xdf,0xfd,0xbd,0x51,0x42,0x3c,0xdc,0x22,0x8e,0x87,0x2f,0x23,
+    0xae,0x49,0xb7,0x8f,0xe7,0xdf,0xc1,0x90,0x0a,0x2d,0xd7,0x27,0x5c,0x51,0x58,0x21,
+    0xd3,0x29,0x6e,0x65,0xc7,0x4c,0xe0,0x1b,0x04,0x3d,0xf0,0xb9,0x0c,0x6e,0x4e,0xc0,
+    0xbd,0x66,0x1c,0xa3,0x8f,0x5c,0x2d,0xf7,0x83,0x00,0xca,0x99,0xc2,0x92,0xf1,0xb5,
+    0x35,0xfc,0x59,0x6d,0xad,0xaf,0xe1,0x4d,0xa1,0x16,0x52,0xc4,0x61,0xa5,0x7f,0x38,
+    0xd6,0x57,0x53,0x25,0x97,0xae,0x6b,0x54,0x5e,0x17,0x36,0x40,0x7f,0x0c,0xda,0xd2,
+    0xa5,0x8d,0xd2,0xff,0x17,0x5c,0x29,0xf3,0x1d,0xd8,0x74,0x15,0xd8,0x9a,0x9c,0xfa,
+    0x9b,0x9c,0x6a,0x83,0x7b,0x2a,0x7c,0x42,0x1e,0x53,0x0c,0xe9,0xb6,0x32,0x44,0x65,
+    0x9c,0xd8,0x5d,0xe2,0x55,0x96,0x5f,0x2f,0x76,0x6b,0xea,0xee,0x8a,0xda,0x4e,0x6d,
+    0xbe,0x87,0x19,0x39,0xc2,0xc6,0xe8,0xd2,0xdd,0xb7,0x9b,0x18,0x9c,0x09,0x82,0x7d,
+    0x10,0x2c,0xc0,0xcd,0xba,0xb5,0x15,0x0e,0xc9,0xf7,0x1f,0x23,0xd3,0x62,0xfb,0x81,
+    0x27,0x7c,0xfa,0xd4,0x24,0x65,0x91,0x3d,0x48,0x98,0xc0,0xc6,0x07,0x0b,0x12,0x2f,
+    0xc9,0x1d,0xf6,0x38,0xee,0xb2,0x68,0x88,0xdc,0xc0,0x9a,0xfc,0xa3,0x9c,0x36,0xad,
+    0xc1,0x4e,0x03,0xee,0xb9,0xd4,0x14,0xa6,0x55,0x9a,0xb6,0x95,0x63,0xba,0xea,0xe6,
+    0x58,0xdb,0xf3,0x44,0xda,0x1a,0xac,0xfd,0x04,0xac,0xbe,0x02,0xac,0x5e,0x06,0x2b,
+    0xf2,0x68,0x27,0xb4,0xc6,0x0a,0xb4,0x46,0x19,0x2d,0x4b,0xa3,0x9d,0xb0,0x5a,0x2b,
+    0xb0,0x5a,0x65,0xac,0x9c,0x3b,0x77,0x8a,0xd9,0xe1,0x0a,0xb0,0xc3,0x12,0xd8,0xcb,
+    0x89,0xef,0x9a,0x04,0xb0,0xf9,0x89,0x64,0x6a,0xd3,0xfe,0x94,0x69,0xf7,0x02,0x01,
+    0x9f,0x04,0x9f,0x6e,0x9a,0xf9,0xc9,0xf2,0xc4,0x3f,0x2f,0xe7,0xfd,0x1c,0xed,0x0b,
+    0x12,0xfe,0x7c,0x43,0xb7,0x35,0x30,0x2e,0x4b,0xdc,0x96,0x94,0xb2,0xc1,0xd9,0xb2,
+    0x98,0x78,0xe7,0xcd,0xdd,0x50,0x9a,0xcb,0x50,0x16,0x12,0xee,0xbc,0xb5,0x1b,0x4a,
+    0x6b,0x19,0xca,0x42,0xc5,0x9e,0x1f,0xee,0x86,0x72,0xb8,0x0c,0x65,0x21,0xa1,0xcf,
+    0xdb,0xbb,0xa1,0xb4,0x97,0xa1,0x1c,0x2e,0xa0,0xbc,0xd9,0x0d,0xe5,0xcd,0x32,0x94,
+    0xf6,0x02,0xca,0xd1,0x6e,0x28,0x47,0xcb,0x50,0xde,0x2c,0xa0,0xbc,0xdd,0x0d,0xe5,
+    0xed,0x32,0x94,0xa3,0x6d,0x6a,0xbf,0x28,0x33,0x5f,0xaa,0x90,0xaa,0x63,0x68,0xa4,
+    0x77,0xa0,0x25,0x67,0x21,0xfc,0x39,0x8a,0x5a,0xf8,0x77,0xe2,0xe8,0xa1,0x10,0x0b,
+    0x24,0x97,0x28,0x35,0x7f,0x76,0x36,0x1c,0xc0,0x80,0x70,0xe6,0x2b,0xb7,0x43,0x22,
+    0x6d,0xf4,0xbf,0xfd,0xea,0xec,0x72,0x53,0xbe,0x08,0xec,0xd4,0x21,0x89,0xa8,0x99,
+    0x2e,0xb2,0x86,0xd3,0xeb,0x58,0xe3,0xea,0xe1,0x17,0x06,0x77,0x0f,0xf7,0x01,0x88,
+    0xf8,0xf1,0xf3,0xcf,0x02,0x7e,0xff,0xd7,0xc3,0x7f,0x71,0x95,0x0f,0xf7,0x12,0x8c,
+    0x7c,0xf8,0x8f,0x00,0xff,0xf1,0xd7,0x7f,0x43,0xf0,0x70,0x2f,0x62,0xf8,0xc7,0xf8,
+    0xf1,0xf3,0xfd,0x73,0x5e,0x99,0x41,0xbd,0x33,0x42,0x2f,0x34,0x17,0x42,0x0a,0x7a,
+    0x02,0x0b,0x44,0x53,0x3a,0x96,0x5a,0xfb,0x02,0x1e,0xe4,0x2e,0xa0,0xe8,0x8f,0xca,
+    0x3e,0xc6,0x0c,0x5f,0xc1,0x67,0xae,0x25,0xc1,0xcd,0x48,0xc9,0xb1,0x08,0x8f,0x0b,
+    0xbf,0x41,0xe6,0x47,0x1c,0x46,0xb6,0x81,0x79,0xfc,0xf5,0x67,0x06,0x96,0xe4,0xc7,
+    0x7a,0xd3,0x37,0xfe,0x12,0x20,0x13,0xf6,0x9d,0x3f,0x53,0xd4,0xd8,0x41,0x51,0xc4,
+    0x04,0xd3,0xb1,0xd5,0xf5,0xf5,0xe3,0xe7,0xdf,0x8c,0x75,0xf1,0xe7,0x00,0xf6,0xb0,
+    0xc7,0x90,0x0f,0xf7,0x9b,0x9e,0x23,0x2c,0x52,0x76,0xc7,0xef,0x9d,0x0e,0x63,0x69,
+    0xdc,0x99,0xde,0x0b,0x06,0x51,0x1d,0x0c,0x64,0x92,0x10,0x11,0x56,0xf6,0x7d,0x4a,
+    0x02,0xe9,0x96,0xf6,0xce,0x5d,0x6d,0xba,0xa8,0xa7,0x3a,0x74,0xca,0xc4,0xb5,0x90,
+    0x2a,0x21,0xee,0x60,0x65,0x88,0x43,0xc8,0x86,0x5f,0xac,0x4d,0x51,0xec,0xd6,0x34,
+    0x0d,0x67,0xfa,0x8a,0x1b,0x5f,0xa2,0x11,0xaf,0xaf,0xed,0x21,0xa1,0x53,0x96,0x9f,
+    0xe8,0x61,0x2c,0xca,0xbe,0x5e,0x77,0xd6,0x22,0x65,0x0a,0x57,0x2c,0xb1,0xc7,0x7e,
+    0x95,0xbd,0x84,0x05,0x4a,0x9e,0xe8,0xbc,0x02,0x73,0x3b,0x66,0xc8,0x5c,0x92,0x30,
+    0x13,0xad,0x44,0x84,0x6b,0xcb,0x0f,0x97,0x34,0x52,0x54,0xc7,0x0b,0xb6,0x2f,0x9b,
+    0x63,0x94,0xa5,0x94,0x35,0x87,0x21,0xb9,0x32,0xd8,0x23,0x49,0x7a,0x02,0x97,0x14,
+    0x59,0x69,0xae,0xd8,0xb8,0xbd,0xdf,0x16,0xa3,0x71,0xea,0xae,0xec,0x78,0x65,0xda,
+    0xc0,0xaa,0x93,0x90,0x4e,0xcd,0x29,0x5a,0xeb,0x93,0xf7,0x9c,0x8d,0x62,0x03,0xa7,
+    0xc4,0x10,0xf8,0x46,0xa2,0x5f,0x06,0xc3,0xef,0xd7,0xb8,0x04,0x45,0x2c,0xd1,0xbc,
+    0xa7,0xd8,0x6c,0x02,0x8a,0xda,0x39,0xab,0x1d,0x12,0xc8,0x74,0x9a,0xcd,0x58,0xe3,
+    0x89,0x01,0x0a,0xd9,0x58,0x0e,0x38,0x4b,0xf3,0x8f,0x4b,0x85,0x3e,0x32,0xff,0x5a,
+    0xc5,0x6a,0x5c,0x8e,0x3c,0x08,0xe5,0xad,0xb0,0x76,0xe0,0x8b,0xb0,0x33,0xbc,0x1a,
+    0xe8,0xc9,0x3a,0xe5,0xa7,0xb9,0x3c,0x44,0x63,0xce,0x0f,0x6c,0xf9,0x5a,0xab,0x3b,
+    0x35,0x52,0x52,0xee,0x73,0x92,0xb3,0xed,0x1c,0xa1,0xb8,0x57,0xf5,0x7d,0xbe,0x11,
+    0x86,0xcf,0x04,0x51,0x53,0x28,0xe6,0x39,0x14,0x5f,0x65,0x3f,0x43,0xef,0x0c,0x51,
+    0x94,0x64,0x67,0x46,0x72,0xf4,0xce,0x62,0xe1,0x38,0x94,0xd8,0x35,0x02,0xd2,0x6b,
+    0x40,0x63,0xc9,0x71,0x6b,0xe9,0x7a,0x03,0xeb,0x3c,0xc8,0x5c,0x8c,0x7e,0x71,0xaa,
+    0xad,0xab,0x43,0x8c,0x51,0xb5,0x5a,0x75,0x71,0xcd,0xb5,0x15,0xa1,0xd5,0x81,0x62,
+    0xa9,0x01,0xad,0x82,0xfc,0xd3,0xde,0x8f,0xf6,0xcb,0x5e,0xe8,0xbf,0x0d,0x68,0xa3,
+    0x1e,0x86,0xc1,0x51,0xdb,0x1d,0x61,0x3b,0x29,0xbc,0xc8,0x3e,0xee,0xd5,0xdc,0x47,
+    0xc9,0xff,0x01,0x3d,0xe0,0xab,0xab,0xaa,0x1c,0x00,0x00,
+};
+
+// /app.css: 929 B source, 794 B minified, 413 B gzip
+alignas(4) static const uint8_t kWebAsset1[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x6d,0x52,0xd1,0x6e,0xe3,0x20,
+    0x10,0xfc,0x95,0x48,0xd1,0xbd,0x9d,0x23,0xec,0xc4,0xb9,0x16,0x74,0x5f,0x52,0xdd,
+    0x03,0x18,0xb0,0x57,0xc5,0x2c,0x02,0x5c,0x3b,0xb2,0xfc,0xef,0x07,0x71,0x9c,0x34,
+    0x6d,0xb5,0x12,0x42,0xbb,0xec,0xec,0xcc,0x2c,0x02,0xe5,0x65,0xd6,0x68,0x63,0xa1,
+    0x79,0x0f,0xe6,0x42,0x03,0xb7,0xa1,0x08,0xca,0x83,0x66,0x82,0x37,0xef,0xad,0xc7,
+    0xc1,0x4a,0xba,0x2f,0xab,0x1c,0xac,0x41,0x83,0x9e,0xee,0x15,0xc9,0xc1,0x7a,0xee,
+    0x5b,0xb0,0xb4,0x22,0x6e,0x5a,0xba,0xf2,0x77,0x57,0xcd,0xb7,0x3a,0x21,0xea,0xfc,
+    0xe7,0xbc,0x1c,0x1a,0xee,0xe5,0xfc,0x04,0xa3,0x72,0x30,0xc7,0xa5,0x04,0xdb,0xd2,
+    0xb2,0x76,0x13,0x13,0xe8,0xa5,0xf2,0x85,0xe7,0x12,0x86,0x40,0x5f,0x52,0x66,0xc5,
+    0x2d,0x04,0xc6,0x88,0xfd,0xf5,0xd1,0x72,0xf0,0x38,0xce,0x12,0x82,0x33,0xfc,0x42,
+    0xb5,0x51,0x13,0xcb,0x47,0x31,0x7a,0xee,0x68,0x3e,0x58,0x9b,0x2e,0x25,0xf9,0xde,
+    0x9c,0x53,0xdc,0x40,0x6b,0x0b,0x88,0xaa,0x0f,0xb4,0x51,0x36,0x2a,0xbf,0x18,0x2e,
+    0x94,0xb9,0x03,0x82,0x35,0x60,0x55,0x21,0x0c,0x36,0xef,0x6c,0x04,0x19,0x3b,0x7a,
+    0xce,0xa2,0xc0,0xba,0x21,0xbe,0xc5,0x8b,0x53,0x7f,0xed,0xd0,0x0b,0xe5,0xff,0xcd,
+    0x8f,0xea,0x93,0x3f,0xc7,0xe3,0x71,0x33,0x47,0x6b,0x7d,0xd3,0x44,0x4b,0x37,0xed,
+    0x02,0x1a,0x90,0xbb,0x7d,0x5d,0xd7,0x77,0xd9,0xa7,0x04,0x2d,0x86,0xc4,0xcf,0x3e,
+    0x99,0xb3,0xba,0xc6,0xee,0x1e,0x92,0x0d,0xc6,0xa2,0x7d,0x78,0x96,0x0c,0xda,0x95,
+    0xe7,0x6f,0xbe,0x25,0x4c,0xd6,0x0c,0x3e,0xa4,0x56,0x87,0x90,0x35,0xb2,0xeb,0x5a,
+    0x47,0x05,0x6d,0x17,0xa9,0x40,0x23,0x6f,0x33,0x69,0x87,0x1f,0xca,0x7f,0x99,0x2c,
+    0x8e,0xf5,0xeb,0x12,0xd5,0x14,0xb9,0x57,0xfc,0x26,0xb2,0x24,0xe4,0x17,0xeb,0xd6,
+    0xfe,0xb2,0xfe,0xaa,0xb8,0xaa,0xaa,0x07,0x55,0xad,0x1f,0x6c,0x3f,0x89,0x3e,0x9d,
+    0x4e,0xec,0xf3,0xe7,0xea,0xd1,0x62,0x70,0xbc,0x51,0xcb,0x41,0xf0,0x67,0x0a,0xd9,
+    0xc0,0x6d,0xd6,0xcb,0x8f,0xea,0x32,0x6b,0x6d,0x70,0xa4,0x1d,0x48,0xa9,0xec,0xb6,
+    0xe8,0x88,0xee,0x5a,0x5e,0x39,0x57,0x24,0xef,0xed,0xa0,0xc1,0x98,0x9f,0xbc,0xdd,
+    0x26,0x64,0x65,0x6b,0x43,0xba,0x44,0x9f,0xfe,0x3c,0x44,0x48,0xd6,0x5c,0x73,0x3b,
+    0x72,0x28,0xc3,0xf2,0x1f,0x1c,0xf8,0x8d,0xb3,0x1a,0x03,0x00,0x00,
+};
+
+// /app.js: 5375 B source, 4797 B minified, 1919 B gzip
+alignas(4) static const uint8_t kWebAsset2[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x58,0x6d,0x77,0xda,0x38,
+    0x16,0xfe,0xce,0xaf,0x50,0x66,0x77,0x23,0x7b,0x21,0x0e,0xa4,0x4b,0x67,0x03,0x31,
+    0x39,0x69,0x9a,0xee,0x64,0xb6,0xdd,0xe9,0x69,0x32,0xf3,0x25,0x27,0xa7,0x23,0x2c,
+    0x01,0x2a,0xb6,0xe5,0x95,0xe5,0x00,0x43,0xf8,0xef,0x73,0xaf,0x64,0xc0,0x0e,0x21,
+    0xed,0xee,0xe9,0x87,0x36,0xb2,0x74,0x75,0xf5,0xdc,0xe7,0xbe,0xe8,0x8a,0x51,0x91,
+    0x46,0x46,0xaa,0x94,0x8c,0x85,0xf1,0x0a,0x1d,0xb7,0x48,0x34,0xf4,0x97,0x23,0x61,
+    0xa2,0x09,0x7e,0xfa,0x81,0x99,0x88,0xd4,0xd3,0xe1,0x40,0x07,0x5f,0x72,0x95,0x7a,
+    0x7e,0x39,0x03,0x52,0xfd,0x55,0x63,0xb4,0xde,0x9d,0xa9,0xbc,0xdc,0xce,0x9d,0x86,
+    0x46,0x2c,0x0c,0x19,0x86,0xbf,0x0c,0xbf,0x88,0xc8,0x04,0x53,0xb1,0xc8,0x3d,0xee,
+    0x07,0x09,0xcb,0xbc,0x69,0x38,0x10,0x69,0xa4,0xb8,0xf8,0xf5,0xd3,0xf5,0xa5,0x4a,
+    0x32,0x95,0x8a,0xd4,0x78,0x53,0xbf,0x49,0x43,0xda,0x7c,0x66,0x85,0xdf,0x4d,0xef,
+    0xe1,0xd4,0x2f,0x4a,0xa6,0x1e,0x3d,0xa4,0x7e,0xbf,0xb1,0x41,0xd7,0x5a,0x26,0xc2,
+    0x4c,0x14,0xef,0xd1,0x8f,0xbf,0xdc,0xdc,0xd2,0xd6,0x44,0x30,0x2e,0x74,0xde,0x5b,
+    0xd2,0x4b,0x95,0x1a,0xd8,0x7c,0x74,0xbb,0xc8,0x04,0xed,0x51,0x96,0x65,0xb1,0x8c,
+    0x18,0x42,0x3d,0x9e,0x1f,0xcd,0x66,0xb3,0xa3,0x91,0xd2,0xc9,0x11,0xa8,0x70,0x07,
+    0x72,0xba,0x6a,0x0d,0x15,0x5f,0xf4,0x86,0xab,0x17,0x2d,0x6e,0x54,0x4c,0x8e,0x15,
+    0xe3,0x1f,0xaf,0xdf,0x7a,0xfe,0xd2,0x72,0x47,0x8f,0x59,0x26,0x8f,0x33,0xc9,0x29,
+    0x70,0x10,0x0e,0x96,0x04,0x4e,0xf0,0x90,0x84,0x29,0x91,0x29,0xe1,0xfe,0x12,0xc7,
+    0x22,0x0e,0xb9,0x8a,0x8a,0x04,0xa0,0x05,0xb0,0xe9,0x2a,0x16,0x38,0x7c,0xb3,0xb8,
+    0xe6,0x40,0x40,0x9f,0xc8,0x91,0x27,0xe2,0xc3,0x43,0x11,0x07,0x06,0x70,0x87,0x21,
+    0x8d,0x26,0x22,0x9a,0x0e,0xd5,0x9c,0xfa,0x30,0x67,0x3f,0x04,0x0f,0x91,0x90,0x41,
+    0x3b,0xe8,0xf6,0x41,0x5d,0x2e,0xdc,0x26,0x5c,0x7f,0x60,0x71,0x21,0xec,0x6a,0x7f,
+    0x45,0x56,0xa0,0xae,0x02,0x36,0x67,0x0f,0xc2,0x81,0xb5,0x8e,0xe1,0xe1,0x72,0xd5,
+    0x27,0x1b,0x28,0xff,0x2d,0x84,0x5e,0xdc,0x88,0x18,0x5c,0xa5,0xf4,0x45,0x1c,0x7b,
+    0xf4,0x2f,0x60,0xc8,0x3b,0xa0,0x08,0xb0,0x67,0x85,0xa1,0x7e,0x00,0xd6,0x5c,0x31,
+    0x60,0x5d,0x86,0x03,0x7e,0x27,0x03,0xc9,0xef,0x43,0xb9,0x83,0x92,0x9c,0x13,0x4f,
+    0xae,0x71,0x9e,0x77,0x7a,0x6d,0x9f,0xf4,0x48,0xc6,0x74,0x2e,0xde,0x01,0x5b,0x06,
+    0xd6,0x2c,0x46,0x1f,0x88,0x04,0xd4,0x07,0xfb,0xa8,0xa0,0x70,0xf8,0x47,0xf0,0xa3,
+    0xcc,0xf1,0xe4,0x52,0x9d,0x4f,0x78,0x90,0xb9,0xc9,0xb0,0xdd,0x6f,0xd8,0x80,0xab,
+    0x71,0xde,0x22,0xe0,0xb3,0x65,0x23,0x17,0xe6,0x56,0xcc,0x8d,0x55,0x72,0x63,0x98,
+    0x29,0x72,0x58,0xd4,0x41,0x6e,0x87,0x07,0x21,0xcd,0x8b,0x28,0x12,0x79,0x8e,0x58,
+    0xd7,0xb3,0x4d,0x4a,0x68,0xd3,0xd3,0x18,0xa5,0x8f,0x8f,0x94,0x22,0x68,0x58,0x02,
+    0xc6,0x38,0x08,0xd1,0x58,0x3e,0x08,0xd2,0xb4,0x0c,0x72,0x6a,0x97,0x32,0x91,0x72,
+    0x99,0x8e,0xd7,0x8b,0x2d,0xbb,0x96,0x13,0xa0,0x99,0xcb,0x9c,0xe9,0x04,0xa5,0xdc,
+    0x36,0x2f,0x55,0xc6,0xed,0xf4,0x31,0x70,0x57,0x36,0x82,0xd0,0x01,0xcc,0xdc,0xca,
+    0x44,0xe8,0x30,0x2d,0xe2,0xb8,0x5f,0x71,0xd3,0x44,0xcd,0x2e,0x0a,0xa3,0x4c,0x91,
+    0x0a,0x4f,0xfb,0x15,0x6b,0x98,0x79,0x62,0x8c,0x00,0xd4,0x77,0xb4,0x79,0x47,0xb5,
+    0x8a,0x63,0xda,0x02,0x73,0x21,0x29,0xe0,0xef,0x82,0xcd,0xe8,0xfd,0x9d,0x0e,0xd8,
+    0x5c,0xe6,0xf7,0x4d,0x7a,0x4f,0xa2,0x45,0x14,0x03,0x3a,0xda,0xd4,0x81,0x1b,0x36,
+    0x1b,0x5e,0xa9,0x02,0x7c,0xc7,0x21,0xc9,0x90,0x0b,0x4a,0x1e,0xc9,0xbf,0x0b,0x2b,
+    0x35,0x2d,0x40,0xf5,0xad,0x1b,0x9b,0xe2,0x73,0x82,0xfc,0x24,0x39,0x39,0x1a,0x90,
+    0x69,0xe6,0x04,0x32,0x98,0x99,0x4a,0x37,0x96,0x38,0xe6,0x6e,0xcc,0xd1,0x70,0x5a,
+    0xba,0xb7,0x3c,0x03,0x28,0xd7,0x45,0x9a,0x02,0x5f,0x94,0x1c,0x1e,0xae,0x0d,0x87,
+    0xa4,0x01,0x28,0x4c,0x5f,0x43,0x9a,0x6a,0x08,0x0a,0x6f,0x3d,0xdf,0xaf,0x53,0x03,
+    0x31,0x5c,0x89,0x62,0xb6,0xa6,0x26,0x4a,0xf8,0x36,0x92,0xe1,0xa3,0x07,0xff,0x5a,
+    0x04,0x4d,0xee,0xed,0x0d,0x2a,0x66,0x2e,0x60,0x1d,0x02,0xca,0xc6,0xe0,0xca,0x62,
+    0x84,0x6d,0xc0,0x01,0x56,0x87,0x85,0x45,0xf7,0xbd,0x42,0x72,0x0d,0xb4,0x12,0x97,
+    0x96,0x11,0x35,0x0d,0xc3,0x70,0xc4,0x20,0x6d,0x81,0x80,0xe7,0x7d,0x9b,0xe4,0x63,
+    0x20,0x41,0x0b,0x53,0xe8,0x14,0xcd,0x7f,0x82,0x72,0xcf,0x3e,0x57,0xe1,0x04,0xef,
+    0xb9,0x48,0xfe,0x1e,0xc1,0x8b,0x7e,0xdc,0x16,0xb9,0x27,0x90,0x0e,0xd6,0xfe,0xda,
+    0xb8,0x0b,0x50,0x6d,0x9c,0xe9,0xf9,0xe1,0x60,0x5b,0x13,0x2b,0x64,0x54,0xe3,0xdb,
+    0x6f,0x91,0x6e,0xbb,0x5d,0xcb,0x0a,0x91,0x5b,0xaf,0xb7,0xc8,0x48,0xb3,0x04,0x3e,
+    0xda,0xd5,0xd4,0x28,0xad,0x96,0x40,0xa8,0x01,0x16,0xf6,0x79,0x4a,0xc2,0x35,0x23,
+    0xd3,0x54,0x68,0x94,0x0e,0x4d,0xad,0x0a,0xaa,0xf4,0x1d,0x2a,0xf6,0xc4,0xe6,0x7e,
+    0xfa,0x55,0xa6,0xe6,0x9f,0x17,0x5a,0xb3,0x45,0x30,0xd2,0x2a,0x81,0x30,0x54,0x43,
+    0x4f,0x04,0x9c,0x19,0x06,0xf8,0xa2,0x70,0x10,0x81,0xb3,0x99,0xbe,0x84,0x3b,0xe2,
+    0xc2,0x78,0xed,0x32,0xb4,0x87,0x01,0xdc,0x1b,0x63,0x33,0x39,0xeb,0xbe,0x22,0x8f,
+    0x8f,0x64,0x78,0xd7,0xbe,0x3f,0x08,0x4f,0xfc,0x35,0x45,0x56,0xf7,0x43,0x98,0x8a,
+    0x19,0x79,0x0b,0x8a,0x7e,0x93,0x62,0x06,0x5b,0x86,0xc5,0x68,0x04,0x84,0xb5,0x88,
+    0xec,0xbc,0x0e,0x55,0x38,0x78,0x40,0xe4,0x40,0x59,0xe7,0xb5,0xa7,0x5a,0x46,0x17,
+    0x48,0x48,0x51,0x59,0x42,0x68,0xdb,0x35,0x60,0xa2,0xbc,0x4f,0x24,0xd0,0x42,0xe4,
+    0x19,0x94,0x7f,0xd9,0x6c,0x96,0x86,0x44,0x21,0xec,0xf4,0x4e,0x3a,0xcd,0x93,0xbf,
+    0x4b,0x70,0xd5,0x26,0x42,0xc0,0x19,0xb4,0x29,0xc1,0x10,0xd8,0xbf,0x37,0xb4,0x87,
+    0x4c,0x83,0x90,0x0f,0xe9,0xba,0x88,0x45,0x30,0x93,0xdc,0x4c,0x42,0xcf,0x8b,0x8e,
+    0x3a,0x6d,0x70,0xcf,0x71,0xa7,0x0d,0x37,0xf3,0xdf,0x28,0xba,0x68,0xa3,0x56,0x26,
+    0xc5,0x67,0xd8,0xd4,0x82,0x6a,0x0f,0xc7,0x76,0x3a,0x28,0xd5,0x86,0x6b,0x52,0xbd,
+    0x93,0x73,0xc1,0xbd,0x8e,0x5f,0xc5,0x60,0x85,0xb3,0x8d,0xf0,0xab,0x67,0x84,0xeb,
+    0x9a,0xc7,0x5b,0xcd,0x5d,0x7b,0xfe,0x0b,0x8a,0xc7,0x5b,0xc5,0x3f,0x7e,0x55,0x76,
+    0xb1,0x91,0x3d,0xdd,0x95,0xdd,0x62,0xc0,0xe0,0xff,0xcc,0x8c,0x01,0xe9,0xbb,0x6e,
+    0xeb,0xc7,0xd6,0xe9,0xbd,0xed,0x5b,0xc0,0x2f,0x76,0xb3,0xda,0x35,0xa0,0x6c,0x4e,
+    0xc8,0x31,0x81,0xcb,0xa3,0x49,0x3c,0x6f,0x78,0xd7,0xed,0xdc,0x1f,0x76,0x7c,0xcc,
+    0x32,0x9b,0x50,0xc4,0x8b,0x59,0x0e,0x65,0x5f,0x27,0xf6,0x2a,0xd8,0x39,0x2e,0x51,
+    0x78,0x5c,0x25,0x10,0x97,0x2e,0xc2,0x7a,0x10,0x5c,0xdd,0x93,0xfb,0x15,0x00,0xff,
+    0x0c,0x91,0x03,0x79,0x85,0x8e,0x7e,0xf5,0xca,0x3a,0x7a,0x73,0xee,0x33,0x0a,0x1f,
+    0xd0,0x56,0x94,0xfd,0x87,0xb5,0xb5,0x0a,0xf8,0x64,0x57,0xda,0x56,0x6a,0xdc,0xe1,
+    0x80,0x9f,0x58,0xe0,0x37,0xd7,0xff,0xfa,0xcf,0xc5,0x7b,0xf2,0x1e,0x5b,0x2b,0xb0,
+    0xa1,0x66,0xd4,0xc5,0xa7,0x0f,0x57,0x6f,0xad,0x65,0xae,0x6a,0x40,0x75,0xc1,0x10,
+    0xb5,0x69,0xdb,0x6c,0xd6,0xfa,0x24,0xd0,0xad,0xa1,0x50,0x69,0xc1,0x12,0x6c,0x3f,
+    0xb0,0x5d,0xc9,0x7d,0x48,0xf5,0x20,0x8a,0x55,0x2e,0xa0,0xb2,0x34,0x30,0xed,0x21,
+    0x57,0xae,0x1e,0x20,0x24,0x6f,0x54,0xa1,0x23,0x51,0x56,0x8e,0xdc,0xee,0x3a,0x9f,
+    0xfc,0x01,0x9d,0xe1,0xde,0xf0,0x75,0x42,0x3f,0xfd,0xb1,0xae,0xec,0x56,0x61,0xa0,
+    0x52,0x40,0x92,0xb3,0xb1,0x08,0xcb,0xa4,0xaf,0x61,0x32,0x6a,0x3c,0x8e,0xc5,0xa7,
+    0xf9,0xad,0x80,0x92,0x5d,0xe6,0x10,0x8b,0x0c,0x09,0xf7,0x96,0x15,0xaa,0xad,0xf0,
+    0xb6,0xf8,0xd7,0xea,0xbd,0x16,0x91,0x00,0x1e,0x31,0x70,0x97,0xa0,0x07,0x86,0x3d,
+    0xd4,0x07,0x89,0x37,0x61,0x50,0x8b,0xe2,0x6b,0x3e,0xef,0x91,0xa3,0x4e,0x8b,0x58,
+    0x84,0x3d,0xd2,0x81,0xca,0xb7,0x72,0x17,0xc3,0xaa,0xde,0x55,0x82,0x5f,0x7e,0x56,
+    0x8b,0xdc,0xc8,0x68,0x0a,0xa5,0x6c,0x6e,0x77,0x38,0xd6,0x0e,0xbe,0x19,0xda,0xb6,
+    0x10,0x7d,0x05,0x22,0x56,0x96,0x3a,0xc6,0xf5,0x91,0x08,0xd2,0x36,0x6e,0x50,0xa0,
+    0x3c,0x84,0xf0,0x3c,0x5a,0xc7,0xe3,0x87,0xff,0x81,0xc6,0xe4,0x05,0x16,0x21,0x09,
+    0xd4,0x2e,0x85,0x76,0x76,0x87,0xc0,0xf6,0x86,0x40,0x6c,0x80,0x0f,0xf0,0x6a,0xf5,
+    0x97,0xdf,0x7a,0xaa,0xbb,0x82,0xa1,0xd5,0x88,0x85,0x36,0x5e,0x79,0xe7,0xda,0x9e,
+    0xf9,0x89,0x2b,0x3e,0xe0,0xd9,0xdf,0xec,0x87,0xe4,0x1b,0xdc,0xb0,0x63,0xa3,0xf3,
+    0xc1,0xd6,0xc8,0xff,0xcb,0x03,0x97,0x2c,0x96,0x43,0xf4,0xc0,0x5e,0x6c,0x11,0x4a,
+    0xbc,0x31,0x29,0x36,0x40,0xae,0xd0,0x43,0xe2,0x66,0x31,0x5b,0xbc,0xe4,0x2c,0xbb,
+    0xe9,0x86,0xc1,0x7b,0x6b,0xb1,0x35,0x0b,0xd3,0x7f,0x14,0x8b,0xb9,0xcd,0xfe,0x14,
+    0xdb,0xc7,0x1a,0x20,0xbb,0x47,0x43,0x39,0xb9,0xba,0xb9,0x2c,0xfb,0xb4,0x17,0x49,
+    0x7b,0xf6,0x8c,0x67,0xa9,0xdb,0x68,0x46,0xfa,0xb0,0xe9,0x23,0xf0,0xdf,0x4e,0x10,
+    0xd4,0x9d,0xfa,0xd4,0xa7,0x22,0x8f,0xe0,0x65,0x99,0xb0,0x94,0x3b,0x6c,0xe4,0x3b,
+    0xe8,0x27,0x4f,0x1e,0x85,0xd0,0x0f,0x41,0x83,0xe5,0x69,0x01,0x01,0x04,0xd6,0x6f,
+    0x1b,0x21,0x63,0x17,0xb0,0x41,0xc3,0xa5,0x73,0x7a,0x6e,0xff,0x86,0x1d,0x78,0xa0,
+    0x52,0xdf,0xbd,0x1a,0x6d,0x0a,0x4d,0x42,0x7a,0x66,0xf4,0xe0,0xcc,0x4c,0x06,0x50,
+    0x3c,0xc7,0xe2,0xec,0x18,0x46,0xf8,0x95,0x6e,0x46,0xa0,0x68,0x33,0xce,0xba,0xed,
+    0xed,0xf8,0xb4,0x3a,0x3e,0xdd,0xca,0xb3,0xb9,0x1b,0x1f,0x83,0x62,0x70,0x18,0x0f,
+    0xac,0xe6,0x7c,0xf3,0xae,0xcb,0xd1,0xc8,0x49,0x33,0xfc,0xdd,0x9d,0xcc,0x07,0x7f,
+    0x5d,0xe6,0x41,0x0a,0x75,0x73,0x05,0x5b,0xf8,0x76,0xa6,0xfe,0x09,0x30,0xea,0x13,
+    0x80,0xe5,0xc9,0xc4,0xe9,0xce,0xc4,0xe9,0x13,0x1d,0x6c,0x5e,0x4e,0x20,0xb6,0xdf,
+    0x9d,0xcb,0xaa,0x48,0x86,0x31,0xb3,0xcf,0xcb,0xf5,0x2e,0x12,0xa9,0x38,0xcf,0x58,
+    0x1a,0xfe,0xf0,0xfa,0x07,0xd0,0xc0,0x83,0xb5,0x40,0xe0,0xee,0x9f,0x55,0xd9,0x3e,
+    0xb6,0x48,0x6d,0x91,0x6b,0x95,0x65,0x82,0xaf,0x48,0x39,0xa8,0x9e,0xb9,0x3f,0x6f,
+    0x9c,0xcf,0x6e,0xd9,0x30,0x86,0x86,0xd8,0x35,0x96,0x3f,0xdd,0x7e,0x78,0x1f,0x4e,
+    0xd6,0x7d,0x6b,0xcd,0xf5,0xef,0xd5,0x18,0x7f,0x0f,0x70,0x3f,0x50,0x38,0xa7,0xc7,
+    0x6a,0x8c,0x17,0x58,0xb7,0x4d,0xab,0xbf,0x2c,0x18,0xbc,0x7b,0xd7,0xbf,0x2c,0x18,
+    0xe4,0x7e,0x2f,0x02,0x50,0xf0,0x06,0x7f,0x01,0x28,0xdf,0xf7,0x66,0x27,0xe6,0x22,
+    0x95,0x2d,0xdc,0xc1,0x65,0x53,0xfb,0x55,0x55,0x7d,0x32,0x0c,0x72,0xfb,0xdc,0xc7,
+    0xc6,0x7e,0x23,0x2e,0xe6,0x62,0x93,0x1d,0x14,0xb5,0xe2,0x9d,0xee,0xc2,0x9d,0x5e,
+    0xaa,0x0c,0x9e,0x17,0x44,0xb3,0x19,0xb9,0xbc,0xf9,0x0d,0xca,0x0e,0xbc,0xdf,0x64,
+    0x36,0x54,0x4c,0xf3,0x03,0xfb,0xb4,0x6d,0xcc,0x64,0xca,0xd5,0x0c,0x2e,0x5e,0x24,
+    0x22,0xc4,0x27,0xc0,0xb2,0xfa,0x7c,0xa8,0xb5,0x01,0xb6,0x33,0xab,0x3d,0x17,0x2a,
+    0xcf,0x1a,0xdb,0x91,0x8c,0x32,0x7c,0xd6,0x38,0x47,0x82,0xf8,0xe6,0x41,0x40,0x20,
+    0x21,0x6d,0x3b,0x03,0xa3,0xfe,0x9f,0xcb,0xad,0x42,0x06,0xbd,0x12,0x00,0x00,
+};
+
+static const HttpAsset kWebAssets[] = {
+    {"/", "text/html", "no-cache", kWebAsset0, sizeof(kWebAsset0), "\"e177f38bf9cb\""},
+    {"/app.css", "text/css", "public, max-age=31536000, immutable", kWebAsset1, sizeof(kWebAsset1), "\"2357f149086a\""},
+    {"/app.js", "application/javascript", "public, max-age=31536000, immutable", kWebAsset2, sizeof(kWebAsset2), "\"db8ce10ddc75\""},
+};
+constexpr size_t kWebAssetCount = sizeof(kWebAssets) / sizeof(kWebAssets[0]);
+
+#endif // WEBASSETS_H
@@ -1,74 +1,72 @@
 #ifndef WEBDASHBOARDHANDLERS_H
 #define WEBDASHBOARDHANDLERS_H
 
-#ifndef NATIVE_BUILD
-#include <WebServer.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#else
-#include <string>
-#include <cstdint>
-using String = std::string;
-class WebServer {
-public:
-    void send(int code, const char* content_type, const String& content) {}
-    void send(int code, const char* content_type, const char* content) {}
-    String arg(const char* name) { return ""; }
-};
-#endif
-
+#include "network/HttpServer.h"
 #include "interfaces/IPPM.h"
 #include "interfaces/IMotors.h"
 #include "interfaces/IBattery.h"
-#include "interfaces/IIMU.h"
-
-struct FlightLogEntry {
-    uint32_t timeMs;
-    float rollSp,  rollAct;
-    float pitchSp, pitchAct;
-    float yawSp,   yawAct;
-    int16_t throttle;
-    int16_t m1, m2, m3, m4;
-    float voltage;
-};
+#include "core/LoopTimingStats.h"
+#include "core/FlightTelemetry.h"
+#include "core/VehicleState.h"
+#include "core/FlightParams.h"
+#include "core/RelayAutotune.h"
 
 /**
- * @brief Handles API request callbacks from the Web Dashboard and manages the RAM Blackbox buffer.
+ * @brief Handles API request callbacks from the Web Dashboard and serves the RAM blackbox.
  */
 class WebDashboardHandlers {
 public:
-    static void init(IPPM& ppm, IMotors& motors, IBattery& battery, IIMU& imu);
+    // Open SSE streams allowed at once; the other slots stay free for API calls and downloads
+    static constexpr uint8_t kMaxStreamClients = HttpServer::kMaxConnections / 2;
 
-    static void handleRoot(WebServer& server);
-    static void handleGetPID(WebServer& server);
-    static void handleSetPID(WebServer& server);
-    static void handleGetReceiver(WebServer& server);
-    static void handleSetReceiver(WebServer& server);
-    static void handleMotorTest(WebServer& server);
-    static void handleCalibrateESC(WebServer& server);
-    static void handleGetIMU(WebServer& server);
-    static void handleGetLog(WebServer& server);
+    // state: the flight task's published snapshot; every read-only handler uses it
+    static void init(IPPM& ppm, IMotors& motors, IBattery& battery, const VehicleStateLock& state);
 
-    static void logFlightData(float rSp, float rAct, float pSp, float pAct,
-                              float ySp, float yAct, int16_t throttle,
-                              int16_t m1, int16_t m2, int16_t m3, int16_t m4,
-                              float voltage);
-    static void clearFlightLog();
+    static void handleAsset(HttpExchange& server);        // "/", /app.js, /app.css from WebAssets.h
+    static void handleGetPID(HttpExchange& server);       // all FlightParams as one JSON object
+    static void handleSetPID(HttpExchange& server);       // batch: any subset, all-or-nothing, live next tick
+    static void handleGetReceiver(HttpExchange& server);
+    static void handleSetReceiver(HttpExchange& server);
+    static void handleMotorTest(HttpExchange& server);
+    static void handleCalibrateESC(HttpExchange& server);
+    static void handleGetIMU(HttpExchange& server);
+    static void handleGetLog(HttpExchange& server);       // CSV, decimated to ~50 Hz
+    static void handleGetBlackbox(HttpExchange& server);  // raw full-rate log for the decoder tool
+    static void handleGetTiming(HttpExchange& server);
+    static void handleStream(HttpExchange& server);       // SSE live telemetry, ?hz=N; 503 past the cap
+    static void handleGetAutotune(HttpExchange& server);  // relay test progress / result
+    static void handleAutotune(HttpExchange& server);     // cmd=start&axis=N | cancel | apply
+
+    // The dashboard's route table; the firmware server and the native loopback tests share it
+    static void registerRoutes(HttpServer& server);
+
+    // Flight loop profiler owned by FlightController; optional.
+    static void setTimingStats(LoopTimingStats& stats) { timing_ = &stats; }
+    // Flight controller's tunables; this task becomes their only writer
+    static void setParams(FlightParamsLock& params) { params_ = &params; }
+    static void setAutotune(RelayAutotune& tune) { autotune_ = &tune; }
+    // Saves gains staged while armed once the snapshot shows disarmed; call from the web loop
+    static void commitPendingParams();
+    // Recorder fed from the flight task's ring; loopHz goes into the file header.
+    static void setBlackbox(BlackboxLog& log, TelemetryRing& ring, uint16_t loopHz) {
+        blackbox_ = &log; telemetry_ = &ring; blackboxHz_ = loopHz;
+    }
 
 private:
     static IPPM* ppm_;
     static IMotors* motors_;
     static IBattery* battery_;
-    static IIMU* imu_;
-
-    static const int MAX_LOGS = 500; // 500 entries @ 50Hz = 10 seconds of log
-    static FlightLogEntry logBuffer_[MAX_LOGS];
-    static int logIndex_;
-    static int logCount_;
-
-#ifndef NATIVE_BUILD
-    static SemaphoreHandle_t logMutex_;
-#endif
+    static const VehicleStateLock* state_;
+    static bool transmitterArmed(); // arm switch position in the latest snapshot
+    static LoopTimingStats* timing_;
+    static FlightParamsLock* params_;
+    static bool paramsPending_; // live but not yet in NVS
+    static RelayAutotune* autotune_;
+    // Publishes a validated set (live next tick) and saves or defers it per ?persist
+    static void stageParams(HttpExchange& server, const FlightParams& p);
+    static BlackboxLog* blackbox_;
+    static TelemetryRing* telemetry_;
+    static uint16_t blackboxHz_;
 };
 
 #endif // WEBDASHBOARDHANDLERS_H
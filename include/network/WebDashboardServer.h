@@ -1,32 +1,24 @@
 #ifndef WEBDASHBOARDSERVER_H
 #define WEBDASHBOARDSERVER_H
 
-#include <Arduino.h>
-
-#ifndef NATIVE_BUILD
-#include <WebServer.h>
-#include <WiFi.h>
-#else
-#include "network/WebDashboardHandlers.h"
-#endif
+#include "network/HttpServer.h"
 
 /**
- * @brief Manages the Wi-Fi softAP and HTTP web server endpoints.
+ * @brief Manages the Wi-Fi softAP and the dashboard's non-blocking HTTP server.
+ * handleClient() services every open connection once and returns.
  */
 class WebDashboardServer {
 public:
+    static constexpr uint16_t kPort = 80;
+
     WebDashboardServer();
     void begin();
     void handleClient();
     void stop();
 
 private:
-#ifndef NATIVE_BUILD
-    WebServer server_;
+    HttpServer server_;
     bool isRunning_ = false;
-    bool routesRegistered_ = false;
-    void registerRoutes();
-#endif
 };
 
 #endif // WEBDASHBOARDSERVER_H
@@ -0,0 +1,71 @@
+#ifndef CLOSEDLOOPSIM_H
+#define CLOSEDLOOPSIM_H
+
+#include "core/FlightController.h"
+#include "simulation/QuadPhysics.h"
+#include "simulation/SensorNoise.h"
+#include "simulation/SimulatedHardware.h"
+#include "simulation/SimulatedCompass.h"
+
+struct ClosedLoopSimConfig {
+    float physicsHz = 4000.0f; // plant integration rate
+    LoopRateConfig rates;      // controller rates; rates.gyroHz must divide physicsHz
+    uint32_t seed   = 1;
+    int notchAnalysisDivider = 10; // control ticks per DynamicNotch::analyse() (firmware: 100 Hz task)
+    bool compass = false;                               // attach SimulatedCompass to the FC
+    bool rpmTelemetry = false; // rotor speeds reach the FC as bidirectional DShot eRPM replies
+    uint8_t motorPoles = 14;
+    float magFieldWorld[3] = {0.22f, 0.0f, -0.42f};     // gauss, north + down (world z up)
+    QuadPhysicsParams quad;
+    SensorNoiseParams noise;
+};
+
+/**
+ * @brief Closes the loop between FlightController and QuadPhysics through the simulated HAL.
+ * Each control tick reads SimulatedMotors, integrates the plant at physicsHz, then injects
+ * the noisy IMU picture back through SimulatedIMU overrides. Runs far faster than real time.
+ */
+class ClosedLoopSim {
+public:
+    explicit ClosedLoopSim(const ClosedLoopSimConfig& config = ClosedLoopSimConfig());
+
+    void setStick(int channel, int us) { ppm_.setOverride(channel, us); }
+
+    // Throttle low + AUX1 high for one tick, exactly as a pilot arms.
+    void arm();
+    void disarm();
+
+    void stepControl();
+    void run(float seconds);
+
+    float time() const { return time_; }
+    float controlDt() const { return controlDt_; }
+
+    QuadPhysics& plant() { return plant_; }
+    FlightController& controller() { return fc_; }
+    SimulatedMotors& motors() { return motors_; }
+    SimulatedBatteryMonitor& battery() { return battery_; }
+    SimulatedPPMReceiver& receiver() { return ppm_; }
+    SimulatedCompass& compass() { return compass_; }
+
+private:
+    ClosedLoopSimConfig config_;
+    SimulatedIMU imu_;
+    SimulatedPPMReceiver ppm_;
+    SimulatedMotors motors_;
+    SimulatedBatteryMonitor battery_;
+    SimulatedCompass compass_;
+    QuadPhysics plant_;
+    SensorNoise noise_;
+    FlightController fc_;
+
+    int substeps_;
+    float physicsDt_, controlDt_;
+    float time_ = 0.0f;
+    int analysisTicks_ = 0;
+
+    void publishSensors(bool withNoise);
+    void publishRpmTelemetry();
+};
+
+#endif // CLOSEDLOOPSIM_H
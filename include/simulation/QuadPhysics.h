@@ -0,0 +1,82 @@
+#ifndef QUADPHYSICS_H
+#define QUADPHYSICS_H
+
+#include "core/MotorMixer.h"
+
+/**
+ * @brief Physical constants of the simulated airframe.
+ * Defaults approximate a 250-class 3S quad so mid-stick throttle hovers.
+ */
+struct QuadPhysicsParams {
+    float massKg            = 0.9f;
+    float inertia[3]        = {0.0075f, 0.0075f, 0.013f}; // kg·m² about roll/pitch/yaw
+    FrameType frame         = FrameType::QuadX; // motor layout, from the mixer tables
+    float armLengthM        = 0.113f;  // lever at mix coefficient 1 (0.16 m arm × sin 45°)
+    float maxThrustN        = 6.0f;    // per motor at full command on a nominal pack
+    float nominalVoltage    = 11.1f;   // thrust scales with (pack / nominal)², rotor Hz linearly
+    float thrustExpo        = 0.7f;    // 0 = linear, 1 = pure quadratic thrust curve
+    float motorTauS         = 0.03f;   // first-order spool-up time constant
+    float yawTorquePerN     = 0.016f;  // reaction torque per Newton of thrust
+    float linearDrag        = 0.3f;    // N per m/s
+    float angularDrag       = 0.002f;  // N·m per rad/s
+    float motorMaxHz        = 400.0f;  // rotor frequency at full command (vibration source)
+};
+
+/**
+ * @brief Rigid-body multirotor plant for native closed-loop simulation.
+ * Motor geometry is the frame's MixerTable, so each motor's torque follows the same
+ * FlightController sign convention the mixer uses (QuadX: +roll raised by motors 3/4,
+ * +pitch by 2/3, +yaw by 2/4). Attitude is a unit quaternion, world z is up.
+ */
+class QuadPhysics {
+public:
+    static constexpr int kMaxMotors = IMotors::kMaxMotors;
+
+    explicit QuadPhysics(const QuadPhysicsParams& params = QuadPhysicsParams());
+
+    void reset();
+
+    // Advances the plant by dt seconds with ESC commands in µs (1000..2000).
+    // Reads motorCount() commands.
+    void step(float dt, const int* motorUs);
+    int motorCount() const { return mixerTable(params_.frame).motors; }
+
+    // Steady-state thrust (N) a motor produces for a command in µs at the current pack voltage.
+    float thrustForCommand(int us) const;
+    void setPackVoltage(float volts) { packVoltage_ = volts; }
+
+    void getEulerDeg(float& roll, float& pitch, float& yaw) const;
+    void getBodyRatesDeg(float& roll, float& pitch, float& yaw) const;
+    // Non-gravitational acceleration in body axes, in g — what an accelerometer reads.
+    void getSpecificForceG(float& x, float& y, float& z) const;
+
+    void setAttitudeDeg(float roll, float pitch, float yaw);
+    // World-frame vector (e.g. Earth's magnetic field) expressed in body axes.
+    void rotateToBody(const float world[3], float body[3]) const;
+    void setBodyRatesDeg(float roll, float pitch, float yaw);
+
+    float getAltitudeM() const { return pos_[2]; }
+    float getClimbRateMs() const { return vel_[2]; }
+    float getMotorThrustN(int idx) const { return thrust_[idx]; }
+    float getRotorHz(int idx) const;
+    float getRotorPhase(int idx) const { return rotorPhase_[idx]; } // rad, wraps at 2π
+    bool isGrounded() const { return grounded_; }
+    const QuadPhysicsParams& params() const { return params_; }
+
+private:
+    static constexpr float kGravity = 9.80665f;
+
+    QuadPhysicsParams params_;
+    float packVoltage_;
+    float q_[4];          // w, x, y, z — body to world
+    float rates_[3];      // rad/s, body axes
+    float pos_[3], vel_[3];
+    float thrust_[kMaxMotors];
+    float rotorPhase_[kMaxMotors];
+    float forceBody_[3];  // last non-gravitational force, body axes
+    bool grounded_ = true;
+
+    void rotateToWorld(const float body[3], float world[3]) const;
+};
+
+#endif // QUADPHYSICS_H
@@ -0,0 +1,40 @@
+#ifndef SENSORNOISE_H
+#define SENSORNOISE_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief IMU corruption model: white noise, constant gyro bias and rotor vibration.
+ * Seeded xorshift keeps every simulated flight bit-for-bit reproducible.
+ */
+struct SensorNoiseParams {
+    float gyroNoiseDegS       = 0.3f;   // 1σ white noise
+    float accelNoiseG         = 0.01f;
+    float gyroBiasDegS[3]     = {0.5f, -0.3f, 0.2f}; // removed by calibrateGyro()
+    float vibrationDegSPerN   = 0.5f;   // gyro ripple amplitude per Newton of rotor thrust
+    float vibrationGPerN      = 0.02f;
+    float vibrationHarmonics[2] = {0.0f, 0.0f}; // 2nd/3rd rotor harmonic, relative to the 1st
+};
+
+class SensorNoise {
+public:
+    explicit SensorNoise(uint32_t seed = 1) : state_(seed ? seed : 1) {}
+
+    // Standard normal sample via Box–Muller
+    float gaussian() {
+        float u1 = uniform(), u2 = uniform();
+        if (u1 < 1e-7f) u1 = 1e-7f;
+        return std::sqrt(-2.0f * std::log(u1)) * std::cos(6.28318531f * u2);
+    }
+
+    float uniform() {
+        state_ ^= state_ << 13; state_ ^= state_ >> 17; state_ ^= state_ << 5;
+        return static_cast<float>(state_ >> 8) * (1.0f / 16777216.0f);
+    }
+
+private:
+    uint32_t state_;
+};
+
+#endif // SENSORNOISE_H
@@ -0,0 +1,21 @@
+#ifndef SIMULATEDCOMPASS_H
+#define SIMULATEDCOMPASS_H
+
+#include "interfaces/ICompass.h"
+
+/**
+ * @brief Magnetometer stand-in; ClosedLoopSim feeds it the plant's body-frame field.
+ */
+class SimulatedCompass : public ICompass {
+public:
+    bool getMag(float& mx, float& my, float& mz) const override {
+        mx = m_[0]; my = m_[1]; mz = m_[2];
+        return valid_;
+    }
+    void setOverride(float mx, float my, float mz) { m_[0] = mx; m_[1] = my; m_[2] = mz; valid_ = true; }
+private:
+    bool valid_ = false;
+    float m_[3] = {0.0f, 0.0f, 0.0f};
+};
+
+#endif // SIMULATEDCOMPASS_H
@@ -3,8 +3,9 @@
 
 #include "interfaces/IIMU.h"
 #include "interfaces/IPPM.h"
-#include "interfaces/IMotors.h"
 #include "interfaces/IBattery.h"
+#include "core/AttitudeMath.h"
+#include "simulation/SimulatedMotors.h"
 
 class SimulatedIMU : public IIMU {
 public:
@@ -18,16 +19,25 @@ public:
         r = active_ ? oRollAngle_ : 0.0f;
         p = active_ ? oPitchAngle_ : 0.0f;
     }
+    void getAccel(float& x, float& y, float& z) const override {
+        x = active_ ? oAccel_[0] : 0.0f;
+        y = active_ ? oAccel_[1] : 0.0f;
+        z = active_ ? oAccel_[2] : 1.0f;
+    }
+    // Angles also set a matching 1 g accel vector; setAccelOverride() replaces it afterwards.
     void setOverride(float rRate, float pRate, float yRate, float rAngle, float pAngle) override {
         oRollRate_ = rRate; oPitchRate_ = pRate; oYawRate_ = yRate;
         oRollAngle_ = rAngle; oPitchAngle_ = pAngle;
+        accelFromAccAngles(rAngle, pAngle, oAccel_[0], oAccel_[1], oAccel_[2]);
     }
+    void setAccelOverride(float x, float y, float z) { oAccel_[0] = x; oAccel_[1] = y; oAccel_[2] = z; }
     void setOverrideActive(bool active) override { active_ = active; }
     bool isOverrideActive() const override { return active_; }
 private:
     bool active_ = false;
     float oRollRate_ = 0.0f, oPitchRate_ = 0.0f, oYawRate_ = 0.0f;
     float oRollAngle_ = 0.0f, oPitchAngle_ = 0.0f;
+    float oAccel_[3] = {0.0f, 0.0f, 1.0f};
 };
 
 class SimulatedPPMReceiver : public IPPM {
@@ -48,27 +58,6 @@ private:
     int oChannels_[6] = {1500, 1500, 1000, 1500, 1500, 1500};
 };
 
-class SimulatedMotors : public IMotors {
-public:
-    void writeMotors(int m1, int m2, int m3, int m4) override {
-        m_[0] = m1; m_[1] = m2; m_[2] = m3; m_[3] = m4;
-    }
-    void setOverride(int idx, int val, bool act) override {
-        if (idx >= 0 && idx < 4) { oActive_[idx] = act; oVal_[idx] = val; }
-    }
-    int getMotorOutput(int idx) const override {
-        if (idx >= 0 && idx < 4) return oActive_[idx] ? oVal_[idx] : m_[idx];
-        return 1000;
-    }
-    bool isMotorOverridden(int idx) const override {
-        return (idx >= 0 && idx < 4) ? oActive_[idx] : false;
-    }
-private:
-    int m_[4] = {1000, 1000, 1000, 1000};
-    int oVal_[4] = {1000, 1000, 1000, 1000};
-    bool oActive_[4] = {false, false, false, false};
-};
-
 class SimulatedBatteryMonitor : public IBattery {
 public:
     float readVoltage() const override { return active_ ? oVoltage_ : 11.1f; }
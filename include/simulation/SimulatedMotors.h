@@ -0,0 +1,45 @@
+#ifndef SIMULATEDMOTORS_H
+#define SIMULATEDMOTORS_H
+
+#include "interfaces/IMotors.h"
+
+// Records the last command per output; ESC eRPM telemetry is whatever the test publishes
+class SimulatedMotors : public IMotors {
+public:
+    explicit SimulatedMotors(int count = 4) : count_(count < kMaxMotors ? count : kMaxMotors) {}
+    void writeMotors(const int* us, int count) override {
+        for (int i = 0; i < count && i < count_; ++i) m_[i] = us[i];
+        ++writes_;
+    }
+    int writes() const { return writes_; } // frames a DShot ESC would have been sent
+    int motorCount() const override { return count_; }
+    void setOverride(int idx, int val, bool act) override {
+        if (idx >= 0 && idx < count_) { oActive_[idx] = act; oVal_[idx] = val; }
+    }
+    int getMotorOutput(int idx) const override {
+        if (idx >= 0 && idx < count_) return oActive_[idx] ? oVal_[idx] : m_[idx];
+        return 1000;
+    }
+    bool isMotorOverridden(int idx) const override {
+        return (idx >= 0 && idx < count_) ? oActive_[idx] : false;
+    }
+    // ESC telemetry stand-in: nullptr stops reporting (e.g. a dropped reply)
+    void setMotorRpm(const float* rpm) {
+        rpmValid_ = rpm != nullptr;
+        for (int i = 0; rpm && i < count_; ++i) rpm_[i] = rpm[i];
+    }
+    bool getMotorRpm(float* rpm) const override {
+        for (int i = 0; rpmValid_ && i < count_; ++i) rpm[i] = rpm_[i];
+        return rpmValid_;
+    }
+private:
+    int count_;
+    int writes_ = 0;
+    bool rpmValid_ = false;
+    float rpm_[kMaxMotors] = {};
+    int m_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
+    int oVal_[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
+    bool oActive_[kMaxMotors] = {};
+};
+
+#endif // SIMULATEDMOTORS_H
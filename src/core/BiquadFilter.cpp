@@ -0,0 +1,46 @@
+#include "core/BiquadFilter.h"
+#include <cmath>
+
+namespace {
+constexpr float kTwoPi = 6.28318531f;
+}
+
+void BiquadFilter::setNotch(float centerHz, float q, float sampleHz) {
+    const float omega = kTwoPi * centerHz / sampleHz;
+    const float alpha = std::sin(omega) / (2.0f * q);
+    const float cs = std::cos(omega);
+    const float a0 = 1.0f + alpha;
+    b0_ = 1.0f / a0;
+    b1_ = -2.0f * cs / a0;
+    b2_ = b0_;
+    a1_ = b1_;
+    a2_ = (1.0f - alpha) / a0;
+}
+
+void BiquadFilter::setLowpass(float cutoffHz, float q, float sampleHz) {
+    const float omega = kTwoPi * cutoffHz / sampleHz;
+    const float alpha = std::sin(omega) / (2.0f * q);
+    const float cs = std::cos(omega);
+    const float a0 = 1.0f + alpha;
+    b0_ = (1.0f - cs) * 0.5f / a0;
+    b1_ = (1.0f - cs) / a0;
+    b2_ = b0_;
+    a1_ = -2.0f * cs / a0;
+    a2_ = (1.0f - alpha) / a0;
+}
+
+void BiquadFilter::setBandpass(float centerHz, float q, float sampleHz) {
+    const float omega = kTwoPi * centerHz / sampleHz;
+    const float alpha = std::sin(omega) / (2.0f * q);
+    const float a0 = 1.0f + alpha;
+    b0_ = alpha / a0;
+    b1_ = 0.0f;
+    b2_ = -b0_;
+    a1_ = -2.0f * std::cos(omega) / a0;
+    a2_ = (1.0f - alpha) / a0;
+}
+
+void BiquadFilter::setPassthrough() {
+    b0_ = 1.0f;
+    b1_ = b2_ = a1_ = a2_ = 0.0f;
+}
@@ -0,0 +1,77 @@
+#include "core/BlackboxCodec.h"
+
+namespace {
+int32_t predict(const BlackboxFrame& prev, const BlackboxFrame& prev2, uint8_t field) {
+    if (field == static_cast<uint8_t>(BlackboxField::Iteration)) {
+        return static_cast<int32_t>(2u * static_cast<uint32_t>(prev.v[field]) - static_cast<uint32_t>(prev2.v[field]));
+    }
+    return prev.v[field];
+}
+} // namespace
+
+size_t writeBlackboxHeader(uint8_t* out, uint16_t loopHz) {
+    out[0] = 'F'; out[1] = 'C'; out[2] = 'B'; out[3] = 'B';
+    out[4] = kBlackboxVersion;
+    out[5] = kBlackboxFieldCount;
+    out[6] = static_cast<uint8_t>(loopHz);
+    out[7] = static_cast<uint8_t>(loopHz >> 8);
+    return kBlackboxHeaderBytes;
+}
+
+size_t readBlackboxHeader(const uint8_t* in, size_t len, uint16_t& loopHz) {
+    if (len < kBlackboxHeaderBytes || in[0] != 'F' || in[1] != 'C' || in[2] != 'B' || in[3] != 'B') return 0;
+    if (in[4] != kBlackboxVersion || in[5] != kBlackboxFieldCount) return 0;
+    loopHz = static_cast<uint16_t>(in[6] | (in[7] << 8));
+    return kBlackboxHeaderBytes;
+}
+
+size_t BlackboxEncoder::encode(const BlackboxFrame& frame, uint8_t* out) {
+    size_t n = 0;
+    if (!havePrev_) {
+        out[n++] = kBlackboxKeyframe;
+        for (uint8_t i = 0; i < kBlackboxFieldCount; ++i) n += writeVarint(zigzagEncode(frame.v[i]), out + n);
+        prev2_ = frame;
+        havePrev_ = true;
+    } else {
+        // Bitmap of non-zero residuals up front, so an unchanged field costs one bit
+        uint8_t* mask = out + 1;
+        out[0] = kBlackboxDelta;
+        for (size_t b = 0; b < kBlackboxMaskBytes; ++b) mask[b] = 0;
+        n = 1 + kBlackboxMaskBytes;
+        for (uint8_t i = 0; i < kBlackboxFieldCount; ++i) {
+            // Wrapping unsigned difference; the decoder wraps back the same way
+            const int32_t residual = static_cast<int32_t>(static_cast<uint32_t>(frame.v[i])
+                                                          - static_cast<uint32_t>(predict(prev_, prev2_, i)));
+            if (residual == 0) continue;
+            mask[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+            n += writeVarint(zigzagEncode(residual), out + n);
+        }
+        prev2_ = prev_;
+    }
+    prev_ = frame;
+    return n;
+}
+
+size_t BlackboxDecoder::decode(const uint8_t* in, size_t len, BlackboxFrame& frame) {
+    if (len == 0) return 0;
+    const bool key = in[0] == kBlackboxKeyframe;
+    if (!key && (in[0] != kBlackboxDelta || !havePrev_)) return 0;
+    if (!key && len < 1 + kBlackboxMaskBytes) return 0;
+    const uint8_t* mask = in + 1;
+    size_t n = key ? 1 : 1 + kBlackboxMaskBytes;
+    for (uint8_t i = 0; i < kBlackboxFieldCount; ++i) {
+        uint32_t u = 0;
+        if (key || (mask[i >> 3] & (1u << (i & 7)))) {
+            const size_t used = readVarint(in + n, len - n, u);
+            if (!used) return 0;
+            n += used;
+        }
+        frame.v[i] = key ? zigzagDecode(u)
+                         : static_cast<int32_t>(static_cast<uint32_t>(predict(prev_, prev2_, i))
+                                                + static_cast<uint32_t>(zigzagDecode(u)));
+    }
+    prev2_ = key ? frame : prev_;
+    prev_ = frame;
+    havePrev_ = true;
+    return n;
+}
@@ -0,0 +1,43 @@
+#include "core/BlackboxCsv.h"
+#include <cstdio>
+
+size_t blackboxCsvHeader(char* out, size_t cap) {
+    size_t n = 0;
+    int w = snprintf(out, cap, "time_us");
+    if (w < 0 || static_cast<size_t>(w) >= cap) return 0;
+    n += w;
+    for (uint8_t i = 0; i < kBlackboxFieldCount; ++i) {
+        w = snprintf(out + n, cap - n, ",%s", kBlackboxFieldName[i]);
+        if (w < 0 || static_cast<size_t>(w) >= cap - n) return 0;
+        n += w;
+    }
+    if (n + 2 > cap) return 0;
+    out[n++] = '\n';
+    out[n] = '\0';
+    return n;
+}
+
+size_t blackboxCsvRow(const BlackboxFrame& frame, uint16_t loopHz, char* out, size_t cap) {
+    const uint64_t loop = static_cast<uint32_t>(frame[BlackboxField::Iteration]);
+    const unsigned long long timeUs = loopHz ? loop * 1000000ULL / loopHz : 0;
+    int w = snprintf(out, cap, "%llu", timeUs);
+    if (w < 0 || static_cast<size_t>(w) >= cap) return 0;
+    size_t n = w;
+    for (uint8_t i = 0; i < kBlackboxFieldCount; ++i) {
+        const long scale = static_cast<long>(kBlackboxFieldScale[i]);
+        const long v = frame.v[i];
+        if (scale == 1) {
+            w = snprintf(out + n, cap - n, ",%ld", v);
+        } else {
+            const int decimals = scale == 10 ? 1 : (scale == 100 ? 2 : 3);
+            const long mag = v < 0 ? -v : v;
+            w = snprintf(out + n, cap - n, ",%s%ld.%0*ld", v < 0 ? "-" : "", mag / scale, decimals, mag % scale);
+        }
+        if (w < 0 || static_cast<size_t>(w) >= cap - n) return 0;
+        n += w;
+    }
+    if (n + 2 > cap) return 0;
+    out[n++] = '\n';
+    out[n] = '\0';
+    return n;
+}
@@ -0,0 +1,39 @@
+#include "core/BlackboxCsv.h"
+
+size_t BlackboxCsvStream::read(char* out, size_t cap) {
+    size_t fill = 0;
+    if (!started_) {
+        started_ = true;
+        seq_ = log_.oldestSegment();
+        last_ = log_.currentSegment();
+        fill = blackboxCsvHeader(out, cap);
+    }
+    BlackboxFrame frame;
+    while (cap - fill >= kBlackboxCsvRowBytes) {
+        if (pos_ >= len_) {
+            if (seq_ == last_ + 1) break;
+            len_ = log_.copySegment(seq_++, segment_);
+            pos_ = 0;
+            if (!len_) { ++result_.segmentsLost; continue; }
+            decoder_.restart();
+        }
+        const size_t used = decoder_.decode(segment_ + pos_, len_ - pos_, frame);
+        if (!used) { pos_ = len_; continue; }
+        pos_ += static_cast<uint16_t>(used);
+        const uint32_t loop = static_cast<uint32_t>(frame[BlackboxField::Iteration]);
+        if (haveNext_ && static_cast<int32_t>(loop - nextLoop_) < 0) continue;
+        haveNext_ = true;
+        nextLoop_ = loop + step_;
+        const size_t n = blackboxCsvRow(frame, loopHz_, out + fill, cap - fill);
+        fill += n;
+        if (n) ++result_.rows;
+    }
+    return fill;
+}
+
+BlackboxCsvStream::Result BlackboxCsvStream::write(Sink sink, void* ctx) {
+    char chunk[kChunkBytes];
+    size_t n;
+    while ((n = read(chunk, sizeof(chunk))) != 0) sink(ctx, chunk, n);
+    return result_;
+}
@@ -0,0 +1,55 @@
+#include "core/BlackboxLog.h"
+#include <cstring>
+
+BlackboxLog::BlackboxLog() { clear(); }
+
+void BlackboxLog::clear() {
+    head_.store(0, std::memory_order_release);
+    for (uint8_t i = 0; i < kSegments; ++i) used_[i] = 0;
+    encoder_.restart();
+    recorded_.store(0, std::memory_order_relaxed);
+}
+
+bool BlackboxLog::record(const BlackboxFrame& frame) {
+    // seq_cst flag pair: at most one of writer/reader sees the other as idle
+    writing_.store(true);
+    if (reading_.load()) {
+        writing_.store(false);
+        return false;
+    }
+    uint8_t buf[kBlackboxMaxFrameBytes];
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    size_t n = encoder_.encode(frame, buf);
+    if (used_[head % kSegments] + n > kSegmentBytes) {
+        // Segment full: open the next one (reusing the oldest) on a keyframe
+        ++head;
+        used_[head % kSegments] = 0;
+        head_.store(head, std::memory_order_release);
+        encoder_.restart();
+        n = encoder_.encode(frame, buf);
+    }
+    uint16_t& used = used_[head % kSegments];
+    std::memcpy(&data_[head % kSegments][used], buf, n);
+    used = static_cast<uint16_t>(used + n);
+    recorded_.fetch_add(1, std::memory_order_relaxed);
+    writing_.store(false);
+    return true;
+}
+
+uint32_t BlackboxLog::oldestSegment() const {
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    return head >= kSegments ? head - (kSegments - 1) : 0;
+}
+
+uint16_t BlackboxLog::copySegment(uint32_t seq, uint8_t* dst) {
+    reading_.store(true);
+    while (writing_.load()) {}
+    uint16_t n = 0;
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (seq <= head && head - seq < kSegments) {
+        n = used_[seq % kSegments];
+        std::memcpy(dst, data_[seq % kSegments], n);
+    }
+    reading_.store(false);
+    return n;
+}
@@ -0,0 +1,43 @@
+#include "core/DShot.h"
+#include "core/FlightControlConstants.h"
+#include <cstring>
+
+namespace {
+// 40 MHz ticks per bit, T1H = 3/4 and T0H = 3/8 of it, rounded
+const DShotEncoder::Timing kTimings[] = {
+    {267, 200, 100}, // DShot150: 6.67 µs bit
+    {133, 100, 50},  // DShot300: 3.33 µs
+    {67, 50, 25},    // DShot600: 1.67 µs
+};
+}
+
+uint16_t dshotThrottle(int us) {
+    using K = FlightControlConstants;
+    if (us <= K::MOTOR_OFF_US) return 0;
+    const int span = kDShotThrottleMax - kDShotThrottleMin;
+    const int v = kDShotThrottleMin + (us - K::MOTOR_OFF_US) * span / (K::MOTOR_MAX_US - K::MOTOR_OFF_US);
+    return static_cast<uint16_t>(v > kDShotThrottleMax ? kDShotThrottleMax : v);
+}
+
+const DShotEncoder::Timing& DShotEncoder::timing(DShotRate rate) {
+    return kTimings[static_cast<uint8_t>(rate)];
+}
+
+void DShotEncoder::setRate(DShotRate rate, bool inverted) {
+    rate_ = rate;
+    inverted_ = inverted;
+    const Timing& t = timing(rate);
+    const uint32_t levels = inverted ? (1u << 15 | 1u << 31) : 0; // flips level0 and level1
+    const uint32_t zero = item(t.zeroHighTicks, t.bitTicks - t.zeroHighTicks) ^ levels;
+    const uint32_t one = item(t.oneHighTicks, t.bitTicks - t.oneHighTicks) ^ levels;
+    for (uint8_t n = 0; n < 16; ++n) {
+        for (uint8_t b = 0; b < 4; ++b) nibbles_[n][b] = (n >> (3 - b)) & 1 ? one : zero;
+    }
+}
+
+void DShotEncoder::encode(uint16_t frame, uint32_t items[kItems]) const {
+    for (uint8_t n = 0; n < 4; ++n) {
+        std::memcpy(items + 4 * n, nibbles_[(frame >> (12 - 4 * n)) & 0xF], sizeof(nibbles_[0]));
+    }
+    items[kFrameBits] = 0;
+}
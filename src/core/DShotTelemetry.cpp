@@ -0,0 +1,87 @@
+#include "core/DShotTelemetry.h"
+#include <cmath>
+#include <initializer_list>
+
+namespace {
+constexpr uint8_t kGcr[16] = {0x19, 0x1B, 0x12, 0x13, 0x1D, 0x15, 0x16, 0x17,
+                              0x1A, 0x09, 0x0A, 0x0B, 0x1E, 0x0D, 0x0E, 0x0F};
+constexpr uint8_t kBad = 0xFF;
+// Quintet → nibble, kBad for the 16 codes GCR never sends
+constexpr uint8_t kFromGcr[32] = {
+    kBad, kBad, kBad, kBad, kBad, kBad, kBad, kBad, kBad, 9, 10, 11, kBad, 13, 14, 15,
+    kBad, kBad, 2, 3, kBad, 5, 6, 7, kBad, 0, 8, 1, kBad, 4, 12, kBad};
+constexpr uint16_t kStopped = 0xFFF;
+}
+
+float DShotTelemetry::ticksPerBit(DShotRate rate) {
+    return DShotEncoder::timing(rate).bitTicks * 4.0f / 5.0f;
+}
+
+bool DShotTelemetry::decode(const uint32_t* edges, uint8_t count, float ticksPerBit, uint32_t& periodUs) {
+    if (count == 0) return false;
+    // Each run of len bits is an edge followed by len-1 quiet bits: "1 0 .. 0"
+    uint32_t line = 0;
+    uint8_t bits = 0;
+    for (uint8_t i = 1; i <= count && bits < kLineBits; ++i) {
+        int len = kLineBits - bits; // after the last edge the line runs out to 21 bits
+        if (i < count) {
+            const long measured = std::lround((edges[i] - edges[i - 1]) / ticksPerBit);
+            if (measured < 1) return false;
+            if (measured < len) {
+                if (measured > 3) return false; // GCR never leaves the line quiet this long
+                len = static_cast<int>(measured);
+            }
+        }
+        line = line << len | 1u << (len - 1);
+        bits = static_cast<uint8_t>(bits + len);
+    }
+    if (bits != kLineBits) return false;
+
+    uint16_t value = 0;
+    for (int q = 3; q >= 0; --q) {
+        const uint8_t nibble = kFromGcr[(line >> (5 * q)) & 0x1F];
+        if (nibble == kBad) return false;
+        value = static_cast<uint16_t>(value << 4 | nibble);
+    }
+    if (((value ^ value >> 4 ^ value >> 8 ^ value >> 12) & 0xF) != 0xF) return false;
+    const uint16_t data = value >> 4;
+    if (data == kStopped) { periodUs = 0; return true; }
+    periodUs = static_cast<uint32_t>(data & 0x1FF) << (data >> 9);
+    return periodUs != 0;
+}
+
+uint32_t DShotTelemetry::encodeLine(uint32_t periodUs) {
+    uint16_t data = kStopped;
+    if (periodUs != 0) {
+        uint8_t e = 0;
+        while (periodUs > 0x1FF && e < 7) { periodUs >>= 1; ++e; }
+        data = static_cast<uint16_t>(e << 9 | (periodUs > 0x1FF ? 0x1FF : periodUs));
+    }
+    const uint16_t value = static_cast<uint16_t>(data << 4 | (~(data ^ data >> 4 ^ data >> 8) & 0xF));
+    uint32_t line = 1; // start edge
+    for (int n = 3; n >= 0; --n) line = line << 5 | kGcr[(value >> (4 * n)) & 0xF];
+    return line;
+}
+
+uint8_t DShotTelemetry::edgesFromLine(uint32_t line, float ticksPerBit, uint32_t edges[kMaxEdges]) {
+    uint8_t n = 0;
+    for (int b = kLineBits - 1; b >= 0; --b) {
+        if ((line >> b) & 1) edges[n++] = static_cast<uint32_t>((kLineBits - 1 - b) * ticksPerBit + 0.5f);
+    }
+    return n;
+}
+
+uint8_t DShotTelemetry::edgesFromItems(const uint32_t* items, uint8_t count, uint32_t edges[kMaxEdges]) {
+    // Every recorded run ends in an edge; a zero duration is the idle that ended the capture
+    uint8_t n = 0;
+    uint32_t t = 0;
+    edges[n++] = t;
+    for (uint8_t i = 0; i < count; ++i) {
+        for (const uint32_t duration : {items[i] & 0x7FFF, (items[i] >> 16) & 0x7FFF}) {
+            if (duration == 0 || n == kMaxEdges) return n;
+            t += duration;
+            edges[n++] = t;
+        }
+    }
+    return n;
+}
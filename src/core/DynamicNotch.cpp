@@ -0,0 +1,64 @@
+#include "core/DynamicNotch.h"
+#include <cmath>
+
+namespace {
+constexpr auto kRelaxed = std::memory_order_relaxed;
+}
+
+DynamicNotch::DynamicNotch() {
+    for (uint16_t i = 0; i < kWindow; ++i) {
+        hann_[i] = 0.5f - 0.5f * std::cos(6.28318531f * i / (kWindow - 1));
+    }
+    reset();
+}
+
+void DynamicNotch::configure(const DynamicNotchConfig& config, float sampleHz) {
+    config_ = config;
+    if (config_.notchCount > kMaxNotches) config_.notchCount = kMaxNotches;
+    // Keep the search band strictly inside Nyquist so the top bin has a right neighbour
+    const float nyquist = 0.5f * sampleHz;
+    if (config_.maxHz > nyquist * 0.9f) config_.maxHz = nyquist * 0.9f;
+    sampleHz_ = sampleHz;
+    reset();
+}
+
+void DynamicNotch::reset() {
+    for (uint8_t a = 0; a < kAxes; ++a) {
+        for (uint16_t i = 0; i < kWindow; ++i) window_[a][i].store(0.0f, kRelaxed);
+        for (uint8_t n = 0; n < kMaxNotches; ++n) {
+            centers_[a][n].store(0.0f, kRelaxed);
+            notches_[a][n].setPassthrough();
+            notches_[a][n].reset();
+        }
+    }
+    head_.store(0, kRelaxed);
+    appliedGeneration_ = generation_.load(kRelaxed);
+}
+
+void DynamicNotch::apply(float& roll, float& pitch, float& yaw) {
+    if (!config_.enabled) return;
+    float* axes[kAxes] = {&roll, &pitch, &yaw};
+
+    const uint16_t head = head_.load(kRelaxed);
+    for (uint8_t a = 0; a < kAxes; ++a) window_[a][head].store(*axes[a], kRelaxed);
+    head_.store((head + 1) % kWindow, std::memory_order_release);
+
+    if (generation_.load(std::memory_order_acquire) != appliedGeneration_) retune();
+
+    for (uint8_t a = 0; a < kAxes; ++a) {
+        float x = *axes[a];
+        for (uint8_t n = 0; n < config_.notchCount; ++n) x = notches_[a][n].apply(x);
+        *axes[a] = x;
+    }
+}
+
+void DynamicNotch::retune() {
+    appliedGeneration_ = generation_.load(kRelaxed);
+    for (uint8_t a = 0; a < kAxes; ++a) {
+        for (uint8_t n = 0; n < config_.notchCount; ++n) {
+            const float hz = centers_[a][n].load(kRelaxed);
+            if (hz > 0.0f) notches_[a][n].setNotch(hz, config_.q, sampleHz_);
+            else notches_[a][n].setPassthrough();
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#include "core/DynamicNotch.h"
+#include <cmath>
+
+// FFT side of DynamicNotch: runs outside the flight task.
+
+void DynamicNotch::analyse() {
+    if (!config_.enabled) return;
+    // Samples written while we copy land at the oldest end of the window, where the
+    // Hann taper is ~0, so an unsynchronised snapshot barely perturbs the spectrum.
+    const uint16_t head = head_.load(std::memory_order_acquire);
+    for (uint8_t a = 0; a < kAxes; ++a) analyseAxis(a, head);
+    generation_.fetch_add(1, std::memory_order_release);
+}
+
+void DynamicNotch::analyseAxis(uint8_t axis, uint16_t head) {
+    float mean = 0.0f;
+    for (uint16_t i = 0; i < kWindow; ++i) {
+        re_[i] = window_[axis][(head + i) % kWindow].load(std::memory_order_relaxed);
+        mean += re_[i];
+    }
+    mean /= kWindow;
+    for (uint16_t i = 0; i < kWindow; ++i) {
+        re_[i] = (re_[i] - mean) * hann_[i];
+        im_[i] = 0.0f;
+    }
+    fft_.forward(re_, im_);
+
+    // Power spectrum over the search band, reusing re_ as storage
+    const float binHz = sampleHz_ / kWindow;
+    uint16_t lo = static_cast<uint16_t>(config_.minHz / binHz);
+    uint16_t hi = static_cast<uint16_t>(config_.maxHz / binHz);
+    if (lo < 1) lo = 1;
+    if (hi <= lo) return;
+    float bandMean = 0.0f;
+    for (uint16_t k = lo - 1; k <= hi + 1; ++k) re_[k] = re_[k] * re_[k] + im_[k] * im_[k];
+    for (uint16_t k = lo; k <= hi; ++k) bandMean += re_[k];
+    bandMean /= (hi - lo + 1);
+
+    // Strongest local maxima above the floor, kept sorted by power (descending)
+    uint16_t peakBin[kMaxNotches] = {0};
+    uint8_t found = 0;
+    for (uint16_t k = lo; k <= hi; ++k) {
+        if (re_[k] <= re_[k - 1] || re_[k] < re_[k + 1]) continue;
+        if (re_[k] < config_.peakRatio * bandMean) continue;
+        uint8_t pos = found < config_.notchCount ? found++ : config_.notchCount;
+        while (pos > 0 && re_[peakBin[pos - 1]] < re_[k]) {
+            if (pos < config_.notchCount) peakBin[pos] = peakBin[pos - 1];
+            --pos;
+        }
+        if (pos < config_.notchCount) peakBin[pos] = k;
+    }
+
+    // Parabolic interpolation on magnitudes, then assign slots in ascending frequency
+    float peakHz[kMaxNotches];
+    for (uint8_t p = 0; p < found; ++p) {
+        const uint16_t k = peakBin[p];
+        const float l = std::sqrt(re_[k - 1]), c = std::sqrt(re_[k]), r = std::sqrt(re_[k + 1]);
+        const float den = l - 2.0f * c + r;
+        const float delta = den != 0.0f ? 0.5f * (l - r) / den : 0.0f;
+        float hz = (k + delta) * binHz;
+        uint8_t pos = p;
+        while (pos > 0 && peakHz[pos - 1] > hz) { peakHz[pos] = peakHz[pos - 1]; --pos; }
+        peakHz[pos] = hz;
+    }
+    // Unmatched slots keep their last centre; a stale notch costs a little phase, a
+    // notch flapping on and off costs a transient every frame
+    for (uint8_t p = 0; p < found; ++p) {
+        const float prev = centers_[axis][p].load(std::memory_order_relaxed);
+        const float next = prev > 0.0f ? prev + config_.smoothing * (peakHz[p] - prev) : peakHz[p];
+        centers_[axis][p].store(next, std::memory_order_relaxed);
+    }
+}
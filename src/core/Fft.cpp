@@ -0,0 +1,38 @@
+#include "core/Fft.h"
+#include <cmath>
+
+Fft::Fft() {
+    for (uint16_t k = 0; k < kSize / 2; ++k) {
+        const double angle = -2.0 * 3.14159265358979 * k / kSize;
+        cos_[k] = static_cast<float>(std::cos(angle));
+        sin_[k] = static_cast<float>(std::sin(angle));
+    }
+    for (uint16_t i = 0; i < kSize; ++i) {
+        uint16_t r = 0;
+        for (uint8_t b = 0; b < kLog2Size; ++b) r |= ((i >> b) & 1u) << (kLog2Size - 1 - b);
+        bitrev_[i] = static_cast<uint8_t>(r);
+    }
+}
+
+void Fft::forward(float* re, float* im) const {
+    for (uint16_t i = 0; i < kSize; ++i) {
+        const uint16_t j = bitrev_[i];
+        if (j > i) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+    // Iterative Cooley-Tukey; twiddle stride halves as the butterfly span doubles
+    for (uint16_t span = 1, stride = kSize / 2; span < kSize; span <<= 1, stride >>= 1) {
+        for (uint16_t start = 0; start < kSize; start += span << 1) {
+            for (uint16_t k = 0; k < span; ++k) {
+                const float wr = cos_[k * stride], wi = sin_[k * stride];
+                const uint16_t a = start + k, b = a + span;
+                const float tr = wr * re[b] - wi * im[b];
+                const float ti = wr * im[b] + wi * re[b];
+                re[b] = re[a] - tr; im[b] = im[a] - ti;
+                re[a] += tr;        im[a] += ti;
+            }
+        }
+    }
+}
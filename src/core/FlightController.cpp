@@ -1,7 +1,5 @@
 #include "core/FlightController.h"
-#ifndef NATIVE_BUILD
-#include "network/WebDashboardHandlers.h"
-#endif
+#include <initializer_list>
 
 FlightController::FlightController(IIMU& imu, IPPM& ppm, IMotors& motors, IBattery& battery)
     : imu_(imu), ppm_(ppm), motors_(motors), battery_(battery) {}
@@ -29,86 +27,40 @@ void FlightController::calibrateGyro() {
     calYawRate_ = totalYaw / static_cast<float>(kCalibrationSamples);
 }
 
-void FlightController::reset() {
+void FlightController::setLoopRates(const LoopRateConfig& rates) {
+    rates_ = rates;
+    attitudeDiv_.setDivider(rates.attitudeDivider);
+    rcDiv_.setDivider(rates.rcDivider);
+    logDiv_.setDivider(rates.logDivider);
+
+    // First-order LPF alpha = dt / (dt + RC) pins the D-term corner in Hz, not in ticks
+    const float rc = 1.0f / (2.0f * 3.14159265f * DTERM_CUTOFF_HZ);
+    const float gyroDt = rates.gyroDt();
+    const float attitudeDt = gyroDt * attitudeDiv_.divider();
+    rollRatePid_.setDtermAlpha(gyroDt / (gyroDt + rc));
+    pitchRatePid_.setDtermAlpha(gyroDt / (gyroDt + rc));
+    rollAnglePid_.setDtermAlpha(attitudeDt / (attitudeDt + rc));
+    pitchAnglePid_.setDtermAlpha(attitudeDt / (attitudeDt + rc));
+    for (Pid* pid : {&rollRatePid_, &pitchRatePid_, &yawRatePid_}) pid->setItermRelaxCutoff(ITERM_RELAX_CUTOFF_HZ, rates.gyroHz);
+    gyroFilters_.setSampleRate(rates.gyroHz);
+    mixer_.setSampleRate(rates.gyroHz);
+}
+
+void FlightController::reset(bool writeOutputs) {
     rollRatePid_.reset(); pitchRatePid_.reset(); yawRatePid_.reset();
     rollAnglePid_.reset(); pitchAnglePid_.reset();
-    motors_.writeMotors(1000, 1000, 1000, 1000);
+    autotune_.abort();
+    gyroSum_[0] = gyroSum_[1] = gyroSum_[2] = 0.0f;
+    gyroSamples_ = 0;
+    desiredRateRoll_ = desiredRatePitch_ = 0.0f;
+    airmodeActive_ = false;
+    for (int& m : motorOut_) m = MOTOR_OFF_US;
+    if (writeOutputs) motors_.writeMotors(motorOut_, motors_.motorCount());
 }
 
-void FlightController::update(float dt) {
-    imu_.readSensor();
-    ppm_.readChannels();
-
-    if (ppm_.isSignalLost()) {
-        reset();
-        return;
-    }
-
-    bool isArmed = ppm_.getChannel(ARM_CHANNEL) > ARM_THRESHOLD;
-    if (!isArmed) {
-        if (wasArmed_) { reset(); wasArmed_ = false; }
-        return;
-    }
-    if (!wasArmed_) {
-        if (ppm_.getChannel(THROTTLE_CHANNEL) >= THROTTLE_IDLE_LIMIT) return;
-        loadPIDGains();
-        wasArmed_ = true;
-    }
-
-    float rateRoll, ratePitch, rateYaw, accRoll, accPitch;
-    imu_.getGyroRates(rateRoll, ratePitch, rateYaw);
-    rateRoll -= calRollRate_; ratePitch -= calPitchRate_; rateYaw -= calYawRate_;
-    imu_.getAccAngles(accRoll, accPitch);
-
-    rollKf_.update(rateRoll, accRoll, dt);
-    pitchKf_.update(ratePitch, accPitch, dt);
-
-    float desiredAngleRoll  = ROLL_SENSITIVITY  * (ppm_.getChannel(ROLL_CHANNEL)     - RC_CENTER);
-    float desiredAnglePitch = PITCH_SENSITIVITY * (ppm_.getChannel(PITCH_CHANNEL)    - RC_CENTER);
-    float inputThrottle     =  static_cast<float>(ppm_.getChannel(THROTTLE_CHANNEL));
-    float desiredRateYaw    = YAW_SENSITIVITY   * (ppm_.getChannel(YAW_CHANNEL)       - RC_CENTER);
-
-    float desiredRateRoll  = rollAnglePid_.update(desiredAngleRoll - rollKf_.getState(), rollKf_.getState(), dt);
-    float desiredRatePitch = pitchAnglePid_.update(desiredAnglePitch - pitchKf_.getState(), pitchKf_.getState(), dt);
-
-    float inputRoll  = rollRatePid_.update(desiredRateRoll - rateRoll, rateRoll, dt);
-    float inputPitch = pitchRatePid_.update(desiredRatePitch - ratePitch, ratePitch, dt);
-    float inputYaw   = yawRatePid_.update(desiredRateYaw - rateYaw, rateYaw, dt);
-
-    if (inputThrottle > THROTTLE_MAX) inputThrottle = THROTTLE_MAX;
-    int m[4] = {
-        (int)(MIXING_SCALE * (inputThrottle - inputRoll - inputPitch - inputYaw)),
-        (int)(MIXING_SCALE * (inputThrottle - inputRoll + inputPitch + inputYaw)),
-        (int)(MIXING_SCALE * (inputThrottle + inputRoll + inputPitch - inputYaw)),
-        (int)(MIXING_SCALE * (inputThrottle + inputRoll - inputPitch + inputYaw))};
-    // Rescale all motors together to preserve attitude authority at saturation
-    int hi = m[0], lo = m[0];
-    for (int i = 1; i < 4; ++i) { if (m[i] > hi) hi = m[i]; if (m[i] < lo) lo = m[i]; }
-    if (hi > MOTOR_MAX_US)       { int d = hi - MOTOR_MAX_US;       for (int i = 0; i < 4; ++i) m[i] -= d; }
-    if (lo < MOTOR_MIN_ARMED_US) { int d = MOTOR_MIN_ARMED_US - lo; for (int i = 0; i < 4; ++i) m[i] += d; }
-    for (int i = 0; i < 4; ++i) {
-        if      (m[i] > MOTOR_MAX_US)       m[i] = MOTOR_MAX_US;
-        else if (m[i] < MOTOR_MIN_ARMED_US) m[i] = MOTOR_MIN_ARMED_US;
-    }
-
-    if (ppm_.getChannel(THROTTLE_CHANNEL) < THROTTLE_IDLE_LIMIT) {
-        m[0] = m[1] = m[2] = m[3] = 1000;
-        reset();
-    }
-
-    motors_.writeMotors(m[0], m[1], m[2], m[3]);
-
-#ifndef NATIVE_BUILD
-    if (++logDiv_ >= 5) {
-        WebDashboardHandlers::logFlightData(
-            desiredAngleRoll,  rollKf_.getState(),
-            desiredAnglePitch, pitchKf_.getState(),
-            desiredRateYaw,    rateYaw,
-            static_cast<int16_t>(inputThrottle),
-            static_cast<int16_t>(m[0]), static_cast<int16_t>(m[1]),
-            static_cast<int16_t>(m[2]), static_cast<int16_t>(m[3]),
-            battery_.readVoltage());
-        logDiv_ = 0;
-    }
-#endif
+uint32_t FlightController::stamp(LoopStage stage, uint32_t since) {
+    if (!clock_) return 0;
+    const uint32_t now = clock_();
+    timing_.record(stage, now - since);
+    return now;
 }
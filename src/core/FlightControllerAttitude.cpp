@@ -0,0 +1,48 @@
+#include "core/FlightController.h"
+
+uint32_t FlightController::runAttitudeLoop(float dt, uint32_t t) {
+    // Average the gyro over the sub-period so no inner-loop sample is dropped
+    const float n = gyroSamples_ > 0 ? static_cast<float>(gyroSamples_) : 1.0f;
+    const float avg[3] = {gyroSum_[0] / n, gyroSum_[1] / n, gyroSum_[2] / n};
+    gyroSum_[0] = gyroSum_[1] = gyroSum_[2] = 0.0f;
+    gyroSamples_ = 0;
+
+    float ax, ay, az, mag[3];
+    imu_.getAccel(ax, ay, az);
+    const bool haveMag = compass_ && compass_->getMag(mag[0], mag[1], mag[2]);
+    attitude_.update(avg[0], avg[1], avg[2], ax, ay, az, dt, haveMag ? mag : nullptr);
+    // The angle PIDs are the only consumer of Euler angles, so convert once per outer tick
+    attitude_.getRollPitchDeg(angleRoll_, anglePitch_);
+    t = stamp(LoopStage::Estimator, t);
+
+    desiredAngleRoll_  = ROLL_SENSITIVITY  * (ppm_.getChannel(ROLL_CHANNEL)  - RC_CENTER);
+    desiredAnglePitch_ = PITCH_SENSITIVITY * (ppm_.getChannel(PITCH_CHANNEL) - RC_CENTER);
+    desiredRateRoll_  = static_cast<float>(rollAnglePid_.update(desiredAngleRoll_ - angleRoll_, angleRoll_, dt));
+    desiredRatePitch_ = static_cast<float>(pitchAnglePid_.update(desiredAnglePitch_ - anglePitch_, anglePitch_, dt));
+    return t;
+}
+
+void FlightController::getAttitudeDeg(float& roll, float& pitch, float& yaw) const {
+    attitude_.getRollPitchDeg(roll, pitch);
+    yaw = attitude_.getYawDeg();
+}
+
+void FlightController::logTick(const float rates[3], float desiredRateYaw, float throttle, const int* m) {
+    if (!telemetry_) return;
+    BlackboxFrame f;
+    f[BlackboxField::Iteration] = static_cast<int32_t>(tickCount_);
+    f.set(BlackboxField::AngleSpRoll, desiredAngleRoll_);
+    f.set(BlackboxField::AngleRoll, angleRoll_);
+    f.set(BlackboxField::AngleSpPitch, desiredAnglePitch_);
+    f.set(BlackboxField::AnglePitch, anglePitch_);
+    f.set(BlackboxField::RateSpRoll, desiredRateRoll_);
+    f.set(BlackboxField::GyroRoll, rates[0]);
+    f.set(BlackboxField::RateSpPitch, desiredRatePitch_);
+    f.set(BlackboxField::GyroPitch, rates[1]);
+    f.set(BlackboxField::RateSpYaw, desiredRateYaw);
+    f.set(BlackboxField::GyroYaw, rates[2]);
+    f[BlackboxField::Throttle] = static_cast<int32_t>(throttle);
+    for (int i = 0; i < IMotors::kMaxMotors; ++i) f.v[static_cast<uint8_t>(BlackboxField::Motor1) + i] = m[i];
+    f.set(BlackboxField::VoltageMv, battery_.readVoltage());
+    telemetry_->push(f); // a full ring drops the frame and counts it
+}
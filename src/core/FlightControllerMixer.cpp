@@ -0,0 +1,8 @@
+#include "core/FlightController.h"
+
+bool FlightController::setFrame(FrameType frame) {
+    if (wasArmed_ || mixerTable(frame).motors > motors_.motorCount()) return false;
+    mixer_.setFrame(frame);
+    reset(); // idle every output, including ones the previous frame drove
+    return true;
+}
@@ -1,38 +1,32 @@
 #include "core/FlightController.h"
+#include <initializer_list>
 
-#ifndef NATIVE_BUILD
-#include <Preferences.h>
-#endif
-
+// Boot-time only: one NVS blob read. A missing or rejected blob leaves the defaults.
 void FlightController::loadPIDGains() {
-    float r_kp=kDefaultRateKp,  r_ki=kDefaultRateKi,  r_kd=kDefaultRateKd;
-    float p_kp=kDefaultRateKp,  p_ki=kDefaultRateKi,  p_kd=kDefaultRateKd;
-    float y_kp=kDefaultYawKp,   y_ki=kDefaultYawKi,   y_kd=kDefaultYawKd;
-    float ra_kp=kDefaultAngleKp, ra_kd=kDefaultAngleKd;
-    float pa_kp=kDefaultAngleKp, pa_kd=kDefaultAngleKd;
-
-#ifndef NATIVE_BUILD
-    Preferences prefs;
-    prefs.begin("pid", true);
-    r_kp = prefs.getFloat("r_kp", r_kp);
-    r_ki = prefs.getFloat("r_ki", r_ki);
-    r_kd = prefs.getFloat("r_kd", r_kd);
-    p_kp = prefs.getFloat("p_kp", p_kp);
-    p_ki = prefs.getFloat("p_ki", p_ki);
-    p_kd = prefs.getFloat("p_kd", p_kd);
-    y_kp = prefs.getFloat("y_kp", y_kp);
-    y_ki = prefs.getFloat("y_ki", y_ki);
-    y_kd = prefs.getFloat("y_kd", y_kd);
-    ra_kp = prefs.getFloat("ra_kp", ra_kp);
-    ra_kd = prefs.getFloat("ra_kd", ra_kd);
-    pa_kp = prefs.getFloat("pa_kp", pa_kp);
-    pa_kd = prefs.getFloat("pa_kd", pa_kd);
-    prefs.end();
-#endif
+    FlightParams p;
+    loadParams(p);
+    params_.write(p);
+    swapGains();
+}
 
-    rollRatePid_.setGains(r_kp, r_ki, r_kd);
-    pitchRatePid_.setGains(p_kp, p_ki, p_kd);
-    yawRatePid_.setGains(y_kp, y_ki, y_kd);
-    rollAnglePid_.setGains(ra_kp, 0.0f, ra_kd);
-    pitchAnglePid_.setGains(pa_kp, 0.0f, pa_kd);
+// Called once per tick before any PID runs, so a gain set is never mixed with the
+// previous one inside a tick. The PIDs keep their I-terms across the swap. A set that
+// is being written right now is picked up next tick; the flight loop never waits.
+void FlightController::swapGains() {
+    const uint32_t version = params_.version();
+    if (version == appliedParams_) return;
+    FlightParams p;
+    if (!params_.tryRead(p)) return;
+    rollRatePid_.setGains(p.get(ParamId::RollRateKp), p.get(ParamId::RollRateKi), p.get(ParamId::RollRateKd));
+    pitchRatePid_.setGains(p.get(ParamId::PitchRateKp), p.get(ParamId::PitchRateKi), p.get(ParamId::PitchRateKd));
+    yawRatePid_.setGains(p.get(ParamId::YawRateKp), p.get(ParamId::YawRateKi), p.get(ParamId::YawRateKd));
+    rollAnglePid_.setGains(p.get(ParamId::RollAngleKp), 0.0f, p.get(ParamId::RollAngleKd));
+    pitchAnglePid_.setGains(p.get(ParamId::PitchAngleKp), 0.0f, p.get(ParamId::PitchAngleKd));
+    for (Pid* pid : {&rollRatePid_, &pitchRatePid_, &yawRatePid_}) {
+        pid->setItermRelax(p.get(ParamId::ItermRelax));
+        pid->setItermRelaxCutoff(ITERM_RELAX_CUTOFF_HZ, rates_.gyroHz);
+        pid->setAntiWindup(p.get(ParamId::AntiWindup));
+    }
+    airmode_ = p.get(ParamId::Airmode) > 0.5f;
+    appliedParams_ = version;
 }
@@ -0,0 +1,24 @@
+#include "core/FlightController.h"
+
+static_assert(VehicleState::kMotors == IMotors::kMaxMotors, "state carries every mixer output");
+
+void FlightController::publishState(const float* rates) {
+    VehicleState s;
+    s.tick = tickCount_;
+    s.attitude = attitude_.quaternion(); // raw: readers do the Euler trig, not the flight loop
+    // Cached by readSensor() earlier in this tick; no bus traffic here
+    imu_.getAccel(s.accel[0], s.accel[1], s.accel[2]);
+    if (rates) {
+        s.gyro[0] = rates[0]; s.gyro[1] = rates[1]; s.gyro[2] = rates[2];
+    } else {
+        imu_.getGyroRates(s.gyro[0], s.gyro[1], s.gyro[2]);
+        s.gyro[0] -= calRollRate_; s.gyro[1] -= calPitchRate_; s.gyro[2] -= calYawRate_;
+    }
+    for (int i = 0; i < VehicleState::kChannels; ++i) s.rc[i] = static_cast<int16_t>(ppm_.getChannel(i));
+    for (int i = 0; i < VehicleState::kMotors; ++i) s.motors[i] = static_cast<int16_t>(motorOut_[i]);
+    s.motorCount = mixer_.motorCount();
+    s.voltage = battery_.readVoltage();
+    s.armed = wasArmed_;
+    s.signalLost = ppm_.isSignalLost();
+    state_.write(s);
+}
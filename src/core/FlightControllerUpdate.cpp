@@ -0,0 +1,98 @@
+#include "core/FlightController.h"
+
+void FlightController::update(float dt) {
+    const uint32_t tickStart = clock_ ? clock_() : 0;
+    uint32_t t = tickStart;
+    ++tickCount_;
+    imu_.readSensor();
+    t = stamp(LoopStage::ImuRead, t);
+    if (rcDiv_.tick()) ppm_.readChannels();
+    t = stamp(LoopStage::RcRead, t);
+
+    if (ppm_.isSignalLost()) {
+        reset();
+        publishState(nullptr);
+        stamp(LoopStage::Total, tickStart);
+        return;
+    }
+
+    swapGains(); // tick boundary: staged gains go live before any PID runs
+    bool isArmed = ppm_.getChannel(ARM_CHANNEL) > ARM_THRESHOLD;
+    // Disarmed ticks still refresh the outputs: digital ESCs drop out without a frame stream
+    if (!isArmed) {
+        if (wasArmed_) { reset(); wasArmed_ = false; }
+        else motors_.writeMotors(motorOut_, motors_.motorCount());
+        publishState(nullptr);
+        stamp(LoopStage::Total, tickStart);
+        return;
+    }
+    if (!wasArmed_) {
+        if (ppm_.getChannel(THROTTLE_CHANNEL) >= THROTTLE_IDLE_LIMIT) {
+            motors_.writeMotors(motorOut_, motors_.motorCount());
+            publishState(nullptr);
+            stamp(LoopStage::Total, tickStart);
+            return;
+        }
+        wasArmed_ = true;
+        attitudeDiv_.restart(); // first armed tick must produce desired rates
+        float ax, ay, az;       // the estimator only runs armed: level it from the pad
+        imu_.getAccel(ax, ay, az);
+        attitude_.alignToAccel(ax, ay, az);
+        t = clock_ ? clock_() : 0; // arm-time setup is not a loop stage
+    }
+
+    float rateRoll, ratePitch, rateYaw;
+    imu_.getGyroRates(rateRoll, ratePitch, rateYaw);
+    rateRoll -= calRollRate_; ratePitch -= calPitchRate_; rateYaw -= calYawRate_;
+    gyroFilters_.apply(rateRoll, ratePitch, rateYaw);
+    t = stamp(LoopStage::GyroFilter, t);
+    gyroSum_[0] += rateRoll; gyroSum_[1] += ratePitch; gyroSum_[2] += rateYaw; ++gyroSamples_;
+
+    if (attitudeDiv_.tick()) t = runAttitudeLoop(dt * attitudeDiv_.divider(), t);
+
+    float inputThrottle  = static_cast<float>(ppm_.getChannel(THROTTLE_CHANNEL));
+    float desiredRateYaw = YAW_SENSITIVITY * (ppm_.getChannel(YAW_CHANNEL) - RC_CENTER);
+
+    const float error[3] = {desiredRateRoll_ - rateRoll, desiredRatePitch_ - ratePitch, desiredRateYaw - rateYaw};
+    float input[3] = {static_cast<float>(rollRatePid_.update(error[0], rateRoll, dt)),
+                      static_cast<float>(pitchRatePid_.update(error[1], ratePitch, dt)),
+                      static_cast<float>(yawRatePid_.update(error[2], rateYaw, dt))};
+    autotune_.poll();
+    autotune_.step(error, input, dt); // relay replaces one axis's PID output while testing
+    t = stamp(LoopStage::Pid, t);
+
+    if (inputThrottle > THROTTLE_MAX) inputThrottle = THROTTLE_MAX;
+    const uint8_t n = mixer_.motorCount();
+    int m[MotorMixer::kMaxMotors];
+    MixerFeedback fb;
+    mixer_.updateVoltage(battery_.readVoltage()); // sag scale for this tick's outputs
+    mixer_.mix(inputThrottle, input[0], input[1], input[2], m, &fb);
+    if (fb.saturated && !autotune_.running()) { // back-calculation: I gives up what the motors couldn't carry
+        rollRatePid_.applySaturation(ControlScalar(input[0]), ControlScalar(fb.applied[0]), dt);
+        pitchRatePid_.applySaturation(ControlScalar(input[1]), ControlScalar(fb.applied[1]), dt);
+        yawRatePid_.applySaturation(ControlScalar(input[2]), ControlScalar(fb.applied[2]), dt);
+    }
+
+    // Idle cut, unless airmode has latched: after the first throttle-up it keeps the PIDs
+    // live at zero throttle (the mixer lifts the low motors to MOTOR_MIN_ARMED_US) until disarm
+    const bool idle = ppm_.getChannel(THROTTLE_CHANNEL) < THROTTLE_IDLE_LIMIT;
+    if (!idle) airmodeActive_ = airmode_;
+    if (idle && !airmodeActive_) {
+        for (int& v : m) v = MOTOR_OFF_US;
+        reset(false); // the write below is this tick's only frame: DShot can't take two back to back
+    }
+    float rpm[IMotors::kMaxMotors];
+    if (motors_.getMotorRpm(rpm)) gyroFilters_.setMotorRpm(rpm, n); // ESC eRPM: RPM filter
+    else gyroFilters_.setMotorCommands(m, n);
+    t = stamp(LoopStage::Mixer, t);
+
+    motors_.writeMotors(m, n);
+    for (uint8_t i = 0; i < MotorMixer::kMaxMotors; ++i) motorOut_[i] = m[i];
+    t = stamp(LoopStage::MotorWrite, t);
+
+    const float rates[3] = {rateRoll, ratePitch, rateYaw};
+    if (logDiv_.tick()) logTick(rates, desiredRateYaw, inputThrottle, m);
+    publishState(rates);
+    stamp(LoopStage::Logging, t);
+    stamp(LoopStage::Total, tickStart);
+}
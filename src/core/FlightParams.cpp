@@ -0,0 +1,85 @@
+#include "core/FlightParams.h"
+#include "core/FlightControlConstants.h"
+#include <cstring>
+
+namespace {
+using K = FlightControlConstants;
+const ParamSpec kSpecs[kParamCount] = {
+    {"r_kp",  0.0f, 20.0f, K::kDefaultRateKp},  {"r_ki", 0.0f, 20.0f, K::kDefaultRateKi},
+    {"r_kd",  0.0f, 5.0f,  K::kDefaultRateKd},
+    {"p_kp",  0.0f, 20.0f, K::kDefaultRateKp},  {"p_ki", 0.0f, 20.0f, K::kDefaultRateKi},
+    {"p_kd",  0.0f, 5.0f,  K::kDefaultRateKd},
+    {"y_kp",  0.0f, 20.0f, K::kDefaultYawKp},   {"y_ki", 0.0f, 20.0f, K::kDefaultYawKi},
+    {"y_kd",  0.0f, 5.0f,  K::kDefaultYawKd},
+    {"ra_kp", 0.0f, 20.0f, K::kDefaultAngleKp}, {"ra_kd", 0.0f, 5.0f, K::kDefaultAngleKd},
+    {"pa_kp", 0.0f, 20.0f, K::kDefaultAngleKp}, {"pa_kd", 0.0f, 5.0f, K::kDefaultAngleKd},
+    {"airmode", 0.0f, 1.0f, 0.0f},                 // 1: full PID authority down to zero throttle
+    {"i_relax", 0.0f, 500.0f, K::kDefaultItermRelax}, {"aw_gain", 0.0f, 100.0f, K::kDefaultAntiWindup},
+};
+constexpr uint16_t kMagic = 0x5046; // "FP"
+
+void put16(uint8_t* p, uint32_t v) { p[0] = v & 0xFF; p[1] = (v >> 8) & 0xFF; }
+void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+uint32_t get16(const uint8_t* p) { return p[0] | p[1] << 8; }
+uint32_t get32(const uint8_t* p) { return get16(p) | get16(p + 2) << 16; }
+
+// CRC-32 (IEEE, reflected), bitwise: the blob is ~60 bytes and only touched on save/boot
+uint32_t crc32(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; ++b) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+}
+
+FlightParams::FlightParams() {
+    for (size_t i = 0; i < kParamCount; ++i) values[i] = kSpecs[i].def;
+}
+
+bool FlightParams::set(ParamId id, float v) {
+    const ParamSpec& s = spec(id);
+    if (!(v >= s.min && v <= s.max)) return false; // also rejects NaN
+    values[static_cast<size_t>(id)] = v;
+    return true;
+}
+
+const ParamSpec& FlightParams::spec(ParamId id) { return kSpecs[static_cast<size_t>(id)]; }
+
+bool FlightParams::find(const char* key, ParamId& id) {
+    for (size_t i = 0; i < kParamCount; ++i) {
+        if (std::strcmp(kSpecs[i].key, key) == 0) { id = static_cast<ParamId>(i); return true; }
+    }
+    return false;
+}
+
+size_t encodeParams(const FlightParams& params, uint8_t* out, size_t cap) {
+    if (cap < FlightParams::kBlobBytes) return 0;
+    put16(out, kMagic);
+    out[2] = FlightParams::kVersion;
+    out[3] = static_cast<uint8_t>(kParamCount);
+    for (size_t i = 0; i < kParamCount; ++i) {
+        uint32_t bits;
+        std::memcpy(&bits, &params.values[i], 4);
+        put32(out + 4 + 4 * i, bits);
+    }
+    const size_t body = 4 + 4 * kParamCount;
+    put32(out + body, crc32(out, body));
+    return FlightParams::kBlobBytes;
+}
+
+bool decodeParams(const uint8_t* in, size_t len, FlightParams& params) {
+    if (len < 8 || get16(in) != kMagic || in[2] == 0 || in[2] > FlightParams::kVersion) return false;
+    const size_t count = in[3], body = 4 + 4 * count;
+    if (count > kParamCount || len != body + 4 || get32(in + body) != crc32(in, body)) return false;
+    FlightParams decoded;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t bits = get32(in + 4 + 4 * i);
+        float v;
+        std::memcpy(&v, &bits, 4);
+        if (!decoded.set(static_cast<ParamId>(i), v)) return false;
+    }
+    params = decoded;
+    return true;
+}
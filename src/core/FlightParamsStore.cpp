@@ -0,0 +1,53 @@
+#include "core/FlightParams.h"
+
+#ifndef NATIVE_BUILD
+#include <Preferences.h>
+
+bool loadParams(FlightParams& params) {
+    uint8_t blob[FlightParams::kBlobBytes];
+    Preferences prefs;
+    prefs.begin("fc", true);
+    const size_t len = prefs.getBytes("params", blob, sizeof(blob));
+    prefs.end();
+    if (len > 0) return decodeParams(blob, len, params);
+
+    // First boot after the per-key layout: read it once, then keep only the blob
+    FlightParams legacy;
+    prefs.begin("pid", true);
+    for (size_t i = 0; i < kParamCount; ++i) {
+        const ParamId id = static_cast<ParamId>(i);
+        legacy.set(id, prefs.getFloat(FlightParams::spec(id).key, legacy.get(id)));
+    }
+    prefs.end();
+    params = legacy;
+    return saveParams(legacy);
+}
+
+bool saveParams(const FlightParams& params) {
+    uint8_t blob[FlightParams::kBlobBytes];
+    const size_t len = encodeParams(params, blob, sizeof(blob));
+    Preferences prefs;
+    prefs.begin("fc", false);
+    const bool ok = prefs.putBytes("params", blob, len) == len;
+    prefs.end();
+    return ok;
+}
+
+#else
+#include <cstring>
+
+// Stands in for the NVS partition so native tests see the same blob round trip
+namespace {
+uint8_t storedBlob[FlightParams::kBlobBytes];
+size_t storedLen = 0;
+}
+
+bool loadParams(FlightParams& params) {
+    return storedLen > 0 && decodeParams(storedBlob, storedLen, params);
+}
+
+bool saveParams(const FlightParams& params) {
+    storedLen = encodeParams(params, storedBlob, sizeof(storedBlob));
+    return storedLen > 0;
+}
+#endif
@@ -0,0 +1,12 @@
+#include "core/FlightTelemetry.h"
+
+uint32_t drainTelemetry(TelemetryRing& ring, BlackboxLog& log) {
+    uint32_t moved = 0;
+    BlackboxFrame frame;
+    while (ring.peek(frame)) {
+        if (!log.record(frame)) break;
+        ring.pop();
+        ++moved;
+    }
+    return moved;
+}
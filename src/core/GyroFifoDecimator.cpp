@@ -0,0 +1,29 @@
+#include "core/GyroFifoDecimator.h"
+
+GyroFifoDecimator::GyroFifoDecimator(float lsbPerDegS) : invScale_(1.0f / lsbPerDegS) {}
+
+uint16_t GyroFifoDecimator::consume(const uint8_t* data, uint16_t bytes) {
+    const uint16_t frames = bytes / kFrameBytes;
+    lastFrames_ = frames;
+    if (frames == 0) return 0;
+
+    // Integer sums are exact for up to 65535 frames; one divide per axis per tick
+    int32_t sum[3] = {0, 0, 0};
+    for (uint16_t f = 0; f < frames; f++) {
+        const uint8_t* p = data + f * kFrameBytes;
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            sum[axis] += static_cast<int16_t>((p[axis * 2] << 8) | p[axis * 2 + 1]);
+        }
+    }
+    const float k = invScale_ / static_cast<float>(frames);
+    rollRate_  = static_cast<float>(sum[0]) * k;
+    pitchRate_ = static_cast<float>(sum[1]) * k;
+    yawRate_   = static_cast<float>(sum[2]) * k;
+    return frames;
+}
+
+void GyroFifoDecimator::getRates(float& r, float& p, float& y) const {
+    r = rollRate_;
+    p = pitchRate_;
+    y = yawRate_;
+}
@@ -0,0 +1,70 @@
+#include "core/HarmonicNotch.h"
+
+void HarmonicNotch::configure(const HarmonicNotchConfig& config, float sampleHz) {
+    config_ = config;
+    if (config_.harmonics > kHarmonics) config_.harmonics = kHarmonics;
+    sampleHz_ = sampleHz;
+    const float dt = 1.0f / sampleHz;
+    lagAlpha_ = config_.motorTauS > 0.0f ? dt / (dt + config_.motorTauS) : 1.0f;
+    reset();
+}
+
+void HarmonicNotch::reset() {
+    for (uint8_t m = 0; m < kMotors; ++m) {
+        fundamental_[m] = 0.0f;
+        for (uint8_t h = 0; h < kHarmonics; ++h) {
+            centers_[m][h] = 0.0f;
+            for (uint8_t a = 0; a < kAxes; ++a) {
+                notches_[a][m][h].setPassthrough();
+                notches_[a][m][h].reset();
+            }
+        }
+    }
+    nextRetune_ = 0;
+}
+
+void HarmonicNotch::setMotorFundamentals(const float* hz, uint8_t count) {
+    if (!config_.enabled || count == 0) return;
+    if (count > kMotors) count = kMotors;
+    // Motors leaving the frame are bypassed now, so they re-enter with a clean state
+    for (uint8_t i = count; i < active_; ++i) { fundamental_[i] = 0.0f; retuneMotor(i); }
+    active_ = count;
+    for (uint8_t i = 0; i < count; ++i) fundamental_[i] = hz[i];
+    if (nextRetune_ >= count) nextRetune_ = 0;
+    retuneMotor(nextRetune_);
+    nextRetune_ = (nextRetune_ + 1) % count;
+}
+
+void HarmonicNotch::retuneMotor(uint8_t motor) {
+    const float maxHz = 0.45f * sampleHz_;
+    for (uint8_t h = 0; h < config_.harmonics; ++h) {
+        const float hz = fundamental_[motor] * (h + 1);
+        BiquadFilter& lead = notches_[0][motor][h];
+        if (hz >= config_.minHz && hz <= maxHz) {
+            // A bypassed section was not clocked, so drop its stale state on re-entry
+            if (centers_[motor][h] == 0.0f) {
+                for (uint8_t a = 0; a < kAxes; ++a) notches_[a][motor][h].reset();
+            }
+            lead.setNotch(hz, config_.q, sampleHz_);
+            centers_[motor][h] = hz;
+        } else {
+            lead.setPassthrough();
+            centers_[motor][h] = 0.0f;
+        }
+        for (uint8_t a = 1; a < kAxes; ++a) notches_[a][motor][h].copyCoefficients(lead);
+    }
+}
+
+void HarmonicNotch::apply(float& roll, float& pitch, float& yaw) {
+    if (!config_.enabled) return;
+    float* axes[kAxes] = {&roll, &pitch, &yaw};
+    for (uint8_t a = 0; a < kAxes; ++a) {
+        float x = *axes[a];
+        for (uint8_t m = 0; m < active_; ++m) {
+            for (uint8_t h = 0; h < config_.harmonics; ++h) {
+                if (centers_[m][h] > 0.0f) x = notches_[a][m][h].apply(x);
+            }
+        }
+        *axes[a] = x;
+    }
+}
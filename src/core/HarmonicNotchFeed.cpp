@@ -0,0 +1,33 @@
+#include "core/HarmonicNotch.h"
+
+// Inputs that move the notch centres: commands through the map, or measured rotor speeds
+
+float HarmonicNotch::fundamentalForCommand(int us) const {
+    constexpr float kStepUs = 1000.0f / (HarmonicNotchConfig::kMapPoints - 1);
+    float x = (us - 1000) / kStepUs;
+    if (x <= 0.0f) return config_.fundamentalHz[0];
+    if (x >= HarmonicNotchConfig::kMapPoints - 1) return config_.fundamentalHz[HarmonicNotchConfig::kMapPoints - 1];
+    const int i = static_cast<int>(x);
+    const float f = x - i;
+    return config_.fundamentalHz[i] + f * (config_.fundamentalHz[i + 1] - config_.fundamentalHz[i]);
+}
+
+void HarmonicNotch::setMotorCommands(const int* m, uint8_t count) {
+    if (!config_.enabled) return;
+    if (count > kMotors) count = kMotors;
+    float hz[kMotors];
+    for (uint8_t i = 0; i < count; ++i) {
+        // First-order lag stands in for the rotor spooling toward the new command
+        const float target = fundamentalForCommand(m[i]);
+        hz[i] = fundamental_[i] + lagAlpha_ * (target - fundamental_[i]);
+    }
+    setMotorFundamentals(hz, count);
+}
+
+void HarmonicNotch::setMotorRpm(const float* rpm, uint8_t count) {
+    if (!config_.enabled) return;
+    if (count > kMotors) count = kMotors;
+    float hz[kMotors];
+    for (uint8_t i = 0; i < count; ++i) hz[i] = rpm[i] / 60.0f;
+    setMotorFundamentals(hz, count);
+}
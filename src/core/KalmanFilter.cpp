@@ -1,26 +1,38 @@
 #include "core/KalmanFilter.h"
 
-KalmanFilter::KalmanFilter(float initialState, float initialUncertainty)
+template <typename T>
+BasicKalmanFilter<T>::BasicKalmanFilter(T initialState, T initialUncertainty)
     : state_(initialState), uncertainty_(initialUncertainty) {}
 
-void KalmanFilter::update(float rate, float measurement, float dt) {
+template <typename T>
+void BasicKalmanFilter<T>::update(T rate, T measurement, float dt) {
+    if (dt != cachedDt_) {
+        cachedDt_ = dt;
+        dt_ = T(dt);
+        processNoise_ = T(dt * dt * 16.0f); // process noise standard deviation is 4 deg/s
+    }
+
     // 1. Predict state (prior)
-    state_ = state_ + dt * rate;
+    state_ = state_ + dt_ * rate;
 
-    // 2. Predict uncertainty (process noise standard deviation is 4 deg/s)
-    uncertainty_ = uncertainty_ + dt * dt * 16.0f;
+    // 2. Predict uncertainty
+    uncertainty_ = uncertainty_ + processNoise_;
 
     // 3. Compute Kalman Gain (measurement noise standard deviation is 3 deg)
-    float gain = uncertainty_ / (uncertainty_ + 9.0f);
+    T gain = uncertainty_ / (uncertainty_ + T(9.0f));
 
     // 4. Update state with measurement
     state_ = state_ + gain * (measurement - state_);
 
     // 5. Update uncertainty (posterior)
-    uncertainty_ = (1.0f - gain) * uncertainty_;
+    uncertainty_ = (T(1.0f) - gain) * uncertainty_;
 }
 
-void KalmanFilter::reset(float state, float uncertainty) {
+template <typename T>
+void BasicKalmanFilter<T>::reset(T state, T uncertainty) {
     state_ = state;
     uncertainty_ = uncertainty;
 }
+
+template class BasicKalmanFilter<float>;
+template class BasicKalmanFilter<Q16>;
@@ -0,0 +1,74 @@
+#include "core/LoopTimingStats.h"
+
+namespace {
+constexpr auto kRelaxed = std::memory_order_relaxed;
+constexpr const char* kStageNames[] = {
+    "imu", "rc", "filter", "estimator", "pid", "mixer", "motors", "logging", "total", "late"};
+} // namespace
+
+LoopTimingStats::LoopTimingStats() { clear(); }
+
+void LoopTimingStats::clear() {
+    for (Stage& s : stages_) {
+        s.count.store(0, kRelaxed);
+        s.minUs.store(UINT32_MAX, kRelaxed);
+        s.maxUs.store(0, kRelaxed);
+        for (auto& b : s.buckets) b.store(0, kRelaxed);
+    }
+}
+
+int LoopTimingStats::bucketFor(uint32_t us) {
+    if (us < 4) return static_cast<int>(us);
+    const int octave = 31 - __builtin_clz(us);            // floor(log2(us)), ≥ 2
+    const int sub    = static_cast<int>(us >> (octave - 2)) & 3;
+    const int bucket = (octave - 1) * 4 + sub;
+    return bucket < kBucketCount ? bucket : kBucketCount - 1;
+}
+
+uint32_t LoopTimingStats::bucketUpperUs(int bucket) {
+    if (bucket < 4) return static_cast<uint32_t>(bucket);
+    const int octave = bucket / 4 + 1;
+    const uint32_t sub = static_cast<uint32_t>(bucket % 4);
+    return ((5u + sub) << (octave - 2)) - 1u;
+}
+
+void LoopTimingStats::record(LoopStage stage, uint32_t us) {
+    // exchange, not load + store: a reset requested between the two would be lost
+    if (resetPending_.exchange(false, kRelaxed)) clear();
+    // Sole writer: plain load/store pairs are enough, no read-modify-write needed
+    Stage& s = stages_[static_cast<int>(stage)];
+    s.count.store(s.count.load(kRelaxed) + 1, kRelaxed);
+    if (us < s.minUs.load(kRelaxed)) s.minUs.store(us, kRelaxed);
+    if (us > s.maxUs.load(kRelaxed)) s.maxUs.store(us, kRelaxed);
+    auto& b = s.buckets[bucketFor(us)];
+    b.store(b.load(kRelaxed) + 1, kRelaxed);
+}
+
+StageTimingSnapshot LoopTimingStats::snapshot(LoopStage stage) const {
+    const Stage& s = stages_[static_cast<int>(stage)];
+    StageTimingSnapshot snap{};
+    uint32_t hist[kBucketCount];
+    uint32_t total = 0;
+    for (int i = 0; i < kBucketCount; ++i) { hist[i] = s.buckets[i].load(kRelaxed); total += hist[i]; }
+    snap.count = s.count.load(kRelaxed);
+    snap.maxUs = s.maxUs.load(kRelaxed);
+    snap.minUs = total ? s.minUs.load(kRelaxed) : 0;
+    if (total == 0) return snap;
+
+    const uint32_t targets[3] = {(total * 50 + 99) / 100, (total * 90 + 99) / 100, (total * 99 + 99) / 100};
+    uint32_t* outputs[3] = {&snap.p50Us, &snap.p90Us, &snap.p99Us};
+    uint32_t seen = 0;
+    int next = 0;
+    for (int i = 0; i < kBucketCount && next < 3; ++i) {
+        seen += hist[i];
+        while (next < 3 && seen >= targets[next]) {
+            const uint32_t upper = bucketUpperUs(i);
+            *outputs[next++] = upper < snap.maxUs ? upper : snap.maxUs;
+        }
+    }
+    return snap;
+}
+
+const char* LoopTimingStats::stageName(LoopStage stage) {
+    return kStageNames[static_cast<int>(stage)];
+}
@@ -0,0 +1,70 @@
+#include "core/MahonyEstimator.h"
+#include <cmath>
+
+namespace {
+constexpr float kDegToRad = 0.0174532925f;
+}
+
+MahonyEstimator::MahonyEstimator(const MahonyConfig& config) : config_(config) {}
+
+void MahonyEstimator::reset() {
+    q_ = Quaternion();
+    integral_[0] = integral_[1] = integral_[2] = 0.0f;
+}
+
+void MahonyEstimator::alignToAccel(float ax, float ay, float az) {
+    reset();
+    const float roll  = std::atan2(ay, az);
+    const float pitch = std::atan2(-ax, std::sqrt(ay * ay + az * az));
+    const float cr = std::cos(roll * 0.5f),  sr = std::sin(roll * 0.5f);
+    const float cp = std::cos(pitch * 0.5f), sp = std::sin(pitch * 0.5f);
+    q_.w = cr * cp; q_.x = sr * cp; q_.y = cr * sp; q_.z = -sr * sp;
+}
+
+void MahonyEstimator::update(float gx, float gy, float gz, float ax, float ay, float az, float dt,
+                             const float* mag) {
+    const float q0 = q_.w, q1 = q_.x, q2 = q_.y, q3 = q_.z;
+    // Estimated "up" in body axes: third row of the body-to-world rotation
+    const float vx = 2.0f * (q1 * q3 - q0 * q2);
+    const float vy = 2.0f * (q0 * q1 + q2 * q3);
+    const float vz = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+
+    float ex = 0.0f, ey = 0.0f, ez = 0.0f;
+    const float aNorm2 = ax * ax + ay * ay + az * az;
+    if (aNorm2 > 1e-6f) {
+        const float inv = 1.0f / std::sqrt(aNorm2);
+        const float dev = std::fabs(aNorm2 * inv - 1.0f);
+        const float trust = dev < config_.accelGateG ? 1.0f - dev / config_.accelGateG : 0.0f;
+        ax *= inv; ay *= inv; az *= inv;
+        ex = trust * (ay * vz - az * vy);
+        ey = trust * (az * vx - ax * vz);
+        ez = trust * (ax * vy - ay * vx);
+    }
+    if (mag) {
+        // Heading error applied about "up" only: a disturbed compass can turn, never tilt
+        const float yawErr = config_.magWeight * magYawError(mag);
+        ex += yawErr * vx; ey += yawErr * vy; ez += yawErr * vz;
+    }
+
+    gx *= kDegToRad; gy *= kDegToRad; gz *= kDegToRad;
+    if (config_.ki > 0.0f) {
+        integral_[0] += config_.ki * ex * dt;
+        integral_[1] += config_.ki * ey * dt;
+        integral_[2] += config_.ki * ez * dt;
+        gx += integral_[0]; gy += integral_[1]; gz += integral_[2];
+    }
+    gx += config_.kp * ex; gy += config_.kp * ey; gz += config_.kp * ez;
+
+    // q̇ = ½ q ⊗ (0, ω)
+    const float h = 0.5f * dt;
+    float w = q0 + (-q1 * gx - q2 * gy - q3 * gz) * h;
+    float x = q1 + ( q0 * gx + q2 * gz - q3 * gy) * h;
+    float y = q2 + ( q0 * gy - q1 * gz + q3 * gx) * h;
+    float z = q3 + ( q0 * gz + q1 * gy - q2 * gx) * h;
+    const float n = 1.0f / std::sqrt(w * w + x * x + y * y + z * z);
+    q_.w = w * n; q_.x = x * n; q_.y = y * n; q_.z = z * n;
+}
+
+void MahonyEstimator::getRollPitchDeg(float& roll, float& pitch) const { rollPitchDegFromQuaternion(q_, roll, pitch); }
+
+float MahonyEstimator::getYawDeg() const { return yawDegFromQuaternion(q_); }
@@ -0,0 +1,15 @@
+#include "core/MahonyEstimator.h"
+#include <cmath>
+
+// Heading error about world "up" (sin of the angle, rad-equivalent for small errors):
+// the measured field is rotated into the world frame and only its horizontal part is
+// compared with magnetic north (+x). Dip and field strength drop out of the gain.
+float MahonyEstimator::magYawError(const float* mag) const {
+    const float q0 = q_.w, q1 = q_.x, q2 = q_.y, q3 = q_.z;
+    const float mx = mag[0], my = mag[1], mz = mag[2];
+    const float hx = 2.0f * (mx * (0.5f - q2 * q2 - q3 * q3) + my * (q1 * q2 - q0 * q3) + mz * (q1 * q3 + q0 * q2));
+    const float hy = 2.0f * (mx * (q1 * q2 + q0 * q3) + my * (0.5f - q1 * q1 - q3 * q3) + mz * (q2 * q3 - q0 * q1));
+    const float h2 = hx * hx + hy * hy;
+    if (h2 < 1e-12f) return 0.0f;
+    return -hy / std::sqrt(h2);
+}
@@ -0,0 +1,78 @@
+#include "core/MotorMixer.h"
+#include "core/FlightControlConstants.h"
+
+MotorMixer::MotorMixer(FrameType frame)
+    : lo_(FlightControlConstants::MOTOR_MIN_ARMED_US), hi_(FlightControlConstants::MOTOR_MAX_US) {
+    setFrame(frame);
+}
+
+void MotorMixer::setFrame(FrameType frame) {
+    const MixerTable& t = mixerTable(frame);
+    frame_ = frame;
+    count_ = t.motors;
+    float norm[3] = {0.0f, 0.0f, 0.0f};
+    for (uint8_t i = 0; i < kMaxMotors; ++i) {
+        roll_[i] = t.rows[i].roll;
+        pitch_[i] = t.rows[i].pitch;
+        yaw_[i] = t.rows[i].yaw;
+        norm[0] += roll_[i] * roll_[i]; norm[1] += pitch_[i] * pitch_[i]; norm[2] += yaw_[i] * yaw_[i];
+    }
+    for (int a = 0; a < 3; ++a) invNorm_[a] = 1.0f / (norm[a] * FlightControlConstants::MIXING_SCALE);
+}
+
+bool MotorMixer::setCompensation(const ThrustCompensationConfig& config, float sampleHz) {
+    const bool ok = comp_.configure(config, sampleHz);
+    lo_ = FlightControlConstants::MOTOR_MIN_ARMED_US;
+    hi_ = FlightControlConstants::MOTOR_MAX_US;
+    return ok;
+}
+
+void MotorMixer::updateVoltage(float volts) {
+    if (!comp_.active()) return;
+    comp_.updateVoltage(volts);
+    lo_ = comp_.inputFor(FlightControlConstants::MOTOR_MIN_ARMED_US);
+    hi_ = comp_.inputFor(FlightControlConstants::MOTOR_MAX_US);
+}
+
+// Unclipped, every correction went through (the shift only moves throttle); clipped, the
+// throttle cancels out of each column projection and what is left is the axis's share.
+void MotorMixer::writeFeedback(bool clipped, float roll, float pitch, float yaw, const int out[kMaxMotors],
+                               MixerFeedback& fb) const {
+    fb.saturated = clipped;
+    if (!clipped) { fb.applied[0] = roll; fb.applied[1] = pitch; fb.applied[2] = yaw; return; }
+    float sum[3] = {0.0f, 0.0f, 0.0f};
+    for (uint8_t i = 0; i < kMaxMotors; ++i) {
+        const float v = static_cast<float>(out[i]);
+        sum[0] += roll_[i] * v; sum[1] += pitch_[i] * v; sum[2] += yaw_[i] * v;
+    }
+    for (int a = 0; a < 3; ++a) fb.applied[a] = sum[a] * invNorm_[a];
+}
+
+void MotorMixer::mix(float throttle, float roll, float pitch, float yaw, int out[kMaxMotors],
+                     MixerFeedback* feedback) const {
+    using K = FlightControlConstants;
+    // Fixed trip count and no branches: one multiply-add chain per lane
+    for (uint8_t i = 0; i < kMaxMotors; ++i) {
+        out[i] = static_cast<int>(K::MIXING_SCALE * (throttle + roll_[i] * roll + pitch_[i] * pitch + yaw_[i] * yaw));
+    }
+    // Rescale all motors together to preserve attitude authority at saturation
+    int hi = out[0], lo = out[0];
+    for (uint8_t i = 1; i < kMaxMotors; ++i) { hi = out[i] > hi ? out[i] : hi; lo = out[i] < lo ? out[i] : lo; }
+    int shift = 0;
+    if (hi > hi_) shift -= hi - hi_;
+    if (lo < lo_) shift += lo_ - lo;
+    bool clipped = false;
+    for (uint8_t i = 0; i < kMaxMotors; ++i) {
+        const int v = out[i] + shift;
+        out[i] = v > hi_ ? hi_ : (v < lo_ ? lo_ : v);
+        clipped |= out[i] != v;
+    }
+    if (feedback) writeFeedback(clipped, roll, pitch, yaw, out, *feedback);
+    if (comp_.active()) {
+        for (uint8_t i = 0; i < count_; ++i) {
+            const int v = comp_.apply(out[i]); // limits were mapped back, so only rounding is left
+            out[i] = v > K::MOTOR_MAX_US ? K::MOTOR_MAX_US : (v < K::MOTOR_MIN_ARMED_US ? K::MOTOR_MIN_ARMED_US : v);
+        }
+    }
+    for (uint8_t i = count_; i < kMaxMotors; ++i) out[i] = K::MOTOR_OFF_US;
+}
@@ -1,56 +1,93 @@
 #include "core/PIDController.h"
 
-PIDController::PIDController(float kp, float ki, float kd, float dAlpha)
-    : kp_(kp), ki_(ki), kd_(kd), dAlpha_(dAlpha) {}
+template <typename T>
+BasicPIDController<T>::BasicPIDController(float kp, float ki, float kd, float dAlpha) {
+    setGains(kp, ki, kd);
+    dFilter_.setGain(dAlpha);
+}
 
-float PIDController::update(float error, float measurement, float dt) {
-    float pTerm = kp_ * error;
+template <typename T>
+void BasicPIDController<T>::cacheDt(float dt) {
+    if (dt == cachedDt_) return;
+    cachedDt_ = dt;
+    halfKiDt_ = T(ki_ * dt / 2.0f);
+    kdOverDt_ = T(dt > 0.0f ? kd_ / dt : 0.0f);
+    awDt_ = T(antiWindup_ * dt);
+}
 
-    float newIterm = iterm_ + ki_ * (error + prevError_) * dt / 2.0f;
-    if (newIterm > kOutputLimit) newIterm = kOutputLimit;
-    else if (newIterm < -kOutputLimit) newIterm = -kOutputLimit;
-    iterm_ = newIterm;
+template <typename T>
+T BasicPIDController<T>::clampOutput(T v) {
+    const T limit(kOutputLimit);
+    if (v > limit) return limit;
+    if (v < -limit) return -limit;
+    return v;
+}
 
-    // D-on-measurement: negate to suppress derivative kick when setpoint changes
-    float dRaw = (dt > 0.0f) ? -kd_ * (measurement - prevMeasurement_) / dt : 0.0f;
-    dFiltered_ = dAlpha_ * dRaw + (1.0f - dAlpha_) * dFiltered_;
+template <typename T>
+T BasicPIDController<T>::update(T error, T measurement, float dt) {
+    cacheDt(dt);
+    T pTerm = kpT_ * error;
+
+    T iDelta = halfKiDt_ * (error + prevError_);
+    if (itermRelax_) { // all in T: no float round trip or divide in the Q16 path
+        const T zero(0.0f);
+        const T setpoint = error + measurement;
+        const T fast = setpoint - setpointLpf_.apply(setpoint);
+        const T relax = T(1.0f) - (fast < zero ? -fast : fast) * invRelax_;
+        iDelta = relax > zero ? iDelta * relax : zero;
+    }
+    iterm_ = clampOutput(iterm_ + iDelta);
 
-    float output = pTerm + iterm_ + dFiltered_;
-    if (output > kOutputLimit) output = kOutputLimit;
-    else if (output < -kOutputLimit) output = -kOutputLimit;
+    // D-on-measurement: negate to suppress derivative kick when setpoint changes
+    T dRaw = -(kdOverDt_ * (measurement - prevMeasurement_));
+    T dTerm = dFilter_.apply(dRaw);
 
     prevError_ = error;
     prevMeasurement_ = measurement;
-    return output;
+    return clampOutput(pTerm + iterm_ + dTerm);
 }
 
-float PIDController::update(float error, float prevError, float prevIterm, float dt) {
-    float pTerm = kp_ * error;
-
-    float newIterm = prevIterm + ki_ * (error + prevError) * dt / 2.0f;
-    if (newIterm > kOutputLimit) newIterm = kOutputLimit;
-    else if (newIterm < -kOutputLimit) newIterm = -kOutputLimit;
-    iterm_ = newIterm;
+template <typename T>
+T BasicPIDController<T>::update(T error, T prevError, T prevIterm, float dt) {
+    cacheDt(dt);
+    T pTerm = kpT_ * error;
 
-    float dTerm = (dt > 0.0f) ? kd_ * (error - prevError) / dt : 0.0f;
+    iterm_ = clampOutput(prevIterm + halfKiDt_ * (error + prevError));
 
-    float output = pTerm + iterm_ + dTerm;
-    if (output > kOutputLimit) output = kOutputLimit;
-    else if (output < -kOutputLimit) output = -kOutputLimit;
+    T dTerm = kdOverDt_ * (error - prevError);
 
     prevError_ = error;
-    return output;
+    return clampOutput(pTerm + iterm_ + dTerm);
 }
 
-void PIDController::reset() {
-    prevError_ = 0.0f;
-    prevMeasurement_ = 0.0f;
-    iterm_ = 0.0f;
-    dFiltered_ = 0.0f;
+template <typename T>
+void BasicPIDController<T>::applySaturation(T commanded, T applied, float dt) {
+    if (antiWindup_ <= 0.0f) return;
+    cacheDt(dt);
+    const T zero(0.0f);
+    const T bleed = awDt_ * (applied - commanded); // opposes the clipped direction
+    // Only unwind an I-term that pushes the same way as the clipped command
+    if (iterm_ > zero && bleed < zero) iterm_ = iterm_ + bleed > zero ? iterm_ + bleed : zero;
+    else if (iterm_ < zero && bleed > zero) iterm_ = iterm_ + bleed < zero ? iterm_ + bleed : zero;
 }
 
-void PIDController::setGains(float kp, float ki, float kd) {
+template <typename T>
+void BasicPIDController<T>::reset() {
+    prevError_ = T(0.0f);
+    prevMeasurement_ = T(0.0f);
+    iterm_ = T(0.0f);
+    dFilter_.reset();
+    setpointLpf_.reset();
+}
+
+template <typename T>
+void BasicPIDController<T>::setGains(float kp, float ki, float kd) {
     kp_ = kp;
     ki_ = ki;
     kd_ = kd;
+    kpT_ = T(kp);
+    cachedDt_ = -1.0f;
 }
+
+template class BasicPIDController<float>;
+template class BasicPIDController<Q16>;
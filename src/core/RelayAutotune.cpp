@@ -0,0 +1,94 @@
+#include "core/RelayAutotune.h"
+#include <cmath>
+
+void RelayAutotune::poll() {
+    const uint8_t req = request_.exchange(0, std::memory_order_acquire);
+    if (req == kCancel) {
+        if (running_) finish(AutotuneState::Failed);
+    } else if (req != 0 && !running_) {
+        start(static_cast<uint8_t>(req - 1));
+    }
+}
+
+void RelayAutotune::abort() {
+    if (running_) finish(AutotuneState::Failed);
+}
+
+void RelayAutotune::start(uint8_t axis) {
+    progress_ = AutotuneResult();
+    progress_.state = AutotuneState::Running;
+    progress_.axis = axis;
+    running_ = true;
+    primed_ = sawRise_ = false;
+    elapsedS_ = sinceRiseS_ = 0.0f;
+    periodSum_ = amplitudeSum_ = 0.0f;
+    measured_ = 0;
+    result_.write(progress_);
+}
+
+void RelayAutotune::step(const float error[kAxes], float out[kAxes], float dt) {
+    if (!running_) return;
+    const float e = error[progress_.axis];
+    elapsedS_ += dt;
+    sinceRiseS_ += dt;
+    if (std::fabs(e) > config_.abortRateDps || elapsedS_ > config_.timeoutS) {
+        finish(AutotuneState::Failed);
+        return;
+    }
+    if (!primed_) { relayHigh_ = e >= 0.0f; maxError_ = minError_ = e; primed_ = true; }
+    if (e > maxError_) maxError_ = e;
+    if (e < minError_) minError_ = e;
+
+    bool high = relayHigh_;
+    if (e > config_.hysteresisDps) high = true;
+    else if (e < -config_.hysteresisDps) high = false;
+    if (high && !relayHigh_) { // rising switch: one full cycle since the previous one
+        if (sawRise_) completeCycle(sinceRiseS_, 0.5f * (maxError_ - minError_));
+        sawRise_ = true;
+        sinceRiseS_ = 0.0f;
+        maxError_ = minError_ = e;
+    }
+    relayHigh_ = high;
+    if (running_) out[progress_.axis] = high ? config_.relayUs : -config_.relayUs;
+}
+
+void RelayAutotune::completeCycle(float period, float amplitude) {
+    ++progress_.cycles;
+    progress_.periodS = period;
+    progress_.amplitudeDps = amplitude;
+    if (progress_.cycles > config_.settleCycles) {
+        periodMin_ = measured_ ? std::fmin(periodMin_, period) : period;
+        periodMax_ = measured_ ? std::fmax(periodMax_, period) : period;
+        periodSum_ += period;
+        amplitudeSum_ += amplitude;
+        ++measured_;
+    }
+    if (measured_ < config_.measureCycles) {
+        result_.write(progress_);
+        return;
+    }
+    const float tu = periodSum_ / measured_;
+    const float a = amplitudeSum_ / measured_;
+    const float eps = config_.hysteresisDps;
+    if ((periodMax_ - periodMin_) > config_.maxPeriodSpread * tu || a <= eps) {
+        // Not a steady limit cycle yet (gusts, throttle changes): measure again
+        periodSum_ = amplitudeSum_ = 0.0f;
+        measured_ = 0;
+        result_.write(progress_);
+        return;
+    }
+    const float ku = 4.0f * config_.relayUs / (3.14159265f * std::sqrt(a * a - eps * eps));
+    progress_.ultimateGain = ku;
+    progress_.periodS = tu;
+    progress_.amplitudeDps = a;
+    progress_.kp = 0.2f * ku;
+    progress_.ki = 0.4f * ku / tu;
+    progress_.kd = 0.066f * ku * tu;
+    finish(AutotuneState::Done);
+}
+
+void RelayAutotune::finish(AutotuneState state) {
+    running_ = false;
+    progress_.state = state;
+    result_.write(progress_);
+}
@@ -0,0 +1,75 @@
+#include "core/TelemetryPacket.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+void putU16(uint8_t* p, uint16_t v) { p[0] = static_cast<uint8_t>(v); p[1] = static_cast<uint8_t>(v >> 8); }
+uint16_t getU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+// Scales and saturates into [lo, hi]
+int32_t quantize(float v, float scale, int32_t lo, int32_t hi) {
+    const float q = std::round(v * scale);
+    if (!(q > lo)) return lo; // also catches NaN
+    if (q > hi) return hi;
+    return static_cast<int32_t>(q);
+}
+void putScaledI16(uint8_t* p, float v, float scale) { putU16(p, static_cast<uint16_t>(quantize(v, scale, -32768, 32767))); }
+void putScaledU16(uint8_t* p, float v, float scale) { putU16(p, static_cast<uint16_t>(quantize(v, scale, 0, 65535))); }
+float getScaledI16(const uint8_t* p, float scale) { return static_cast<int16_t>(getU16(p)) / scale; }
+
+constexpr char kBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+}
+
+void packTelemetry(const VehicleState& s, uint8_t* out) {
+    out[0] = kTelemetryPacketVersion;
+    for (int i = 0; i < 4; ++i) out[1 + i] = static_cast<uint8_t>(s.tick >> (8 * i));
+    float roll, pitch, yaw, accRoll, accPitch; // converted here, on the reader's core
+    s.attitudeDeg(roll, pitch, yaw);
+    s.accAnglesDeg(accRoll, accPitch);
+    putScaledI16(out + 5, roll, 100); putScaledI16(out + 7, pitch, 100); putScaledI16(out + 9, yaw, 100);
+    putScaledI16(out + 11, accRoll, 100); putScaledI16(out + 13, accPitch, 100);
+    for (int i = 0; i < 3; ++i) putScaledI16(out + 15 + 2 * i, s.gyro[i], 10);
+    for (int i = 0; i < VehicleState::kChannels; ++i) putScaledU16(out + 21 + 2 * i, s.rc[i], 1);
+    for (int i = 0; i < VehicleState::kMotors; ++i) putScaledU16(out + 33 + 2 * i, s.motors[i], 1);
+    putScaledU16(out + 49, s.voltage, 1000);
+    out[51] = static_cast<uint8_t>((s.armed ? 1u : 0u) | (s.signalLost ? 2u : 0u));
+    out[52] = s.motorCount;
+}
+
+bool unpackTelemetry(const uint8_t* in, size_t len, VehicleState& s) {
+    if (len < kTelemetryPacketBytes || in[0] != kTelemetryPacketVersion) return false;
+    s.tick = static_cast<uint32_t>(in[1]) | static_cast<uint32_t>(in[2]) << 8
+           | static_cast<uint32_t>(in[3]) << 16 | static_cast<uint32_t>(in[4]) << 24;
+    s.attitude = quaternionFromEulerDeg(getScaledI16(in + 5, 100), getScaledI16(in + 7, 100), getScaledI16(in + 9, 100));
+    accelFromAccAngles(getScaledI16(in + 11, 100), getScaledI16(in + 13, 100), s.accel[0], s.accel[1], s.accel[2]);
+    for (int i = 0; i < 3; ++i) s.gyro[i] = getScaledI16(in + 15 + 2 * i, 10);
+    for (int i = 0; i < VehicleState::kChannels; ++i) s.rc[i] = static_cast<int16_t>(getU16(in + 21 + 2 * i));
+    for (int i = 0; i < VehicleState::kMotors; ++i) s.motors[i] = static_cast<int16_t>(getU16(in + 33 + 2 * i));
+    s.voltage = getU16(in + 49) / 1000.0f;
+    s.armed = (in[51] & 1u) != 0;
+    s.signalLost = (in[51] & 2u) != 0;
+    s.motorCount = in[52];
+    return true;
+}
+
+size_t formatTelemetryEvent(const VehicleState& state, char* out, size_t cap) {
+    if (cap < kTelemetryEventBytes + 1) return 0;
+    uint8_t packet[kTelemetryPacketBytes];
+    packTelemetry(state, packet);
+    std::memcpy(out, "data:", 5);
+    size_t n = 5;
+    for (size_t i = 0; i < kTelemetryPacketBytes; i += 3) {
+        const size_t left = kTelemetryPacketBytes - i;
+        const uint32_t b = static_cast<uint32_t>(packet[i]) << 16
+                         | (left > 1 ? static_cast<uint32_t>(packet[i + 1]) << 8 : 0)
+                         | (left > 2 ? packet[i + 2] : 0);
+        out[n++] = kBase64[(b >> 18) & 63];
+        out[n++] = kBase64[(b >> 12) & 63];
+        out[n++] = left > 1 ? kBase64[(b >> 6) & 63] : '=';
+        out[n++] = left > 2 ? kBase64[b & 63] : '=';
+    }
+    out[n++] = '\n';
+    out[n++] = '\n';
+    out[n] = '\0';
+    return n;
+}
@@ -0,0 +1,68 @@
+#include "core/ThrustCompensation.h"
+#include <cmath>
+
+namespace {
+constexpr int kOffUs = 1000; // 0 % command
+constexpr float kSpanUs = 1000.0f;
+
+float clamp01(float x) { return x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x); }
+
+// Piecewise-linear lookup on n uniformly spaced points over 0..1
+float lookup(const float* table, uint8_t n, float x) {
+    const float pos = clamp01(x) * (n - 1);
+    const int i = pos >= n - 1 ? n - 2 : static_cast<int>(pos);
+    return table[i] + (pos - i) * (table[i + 1] - table[i]);
+}
+}
+
+bool ThrustCompensation::configure(const ThrustCompensationConfig& config, float sampleHz) {
+    config_ = config;
+    voltage_.configure(config.voltageCutoffHz, sampleHz);
+    primed_ = false;
+    scale_ = 1.0f;
+    const float* t = config.thrust;
+    const uint8_t n = ThrustCompensationConfig::kCurvePoints;
+    valid_ = t[0] == 0.0f && t[n - 1] == 1.0f;
+    for (uint8_t i = 1; i < n; ++i) valid_ = valid_ && t[i] > t[i - 1];
+    if (!valid_) return false;
+
+    // Invert at uniform thrust steps: find the curve segment, then interpolate inside it
+    uint8_t seg = 0;
+    for (uint8_t k = 0; k < kInversePoints; ++k) {
+        const float target = static_cast<float>(k) / (kInversePoints - 1);
+        while (seg < n - 2 && t[seg + 1] < target) ++seg;
+        const float f = (target - t[seg]) / (t[seg + 1] - t[seg]);
+        inverse_[k] = (seg + clamp01(f)) / (n - 1);
+    }
+    return true;
+}
+
+void ThrustCompensation::updateVoltage(float volts) {
+    if (!active() || !config_.sagCompensation || volts < config_.minVoltage) { scale_ = 1.0f; return; }
+    if (!primed_) { voltage_.reset(volts); primed_ = true; }
+    const float v = voltage_.apply(volts);
+    const float ratio = config_.referenceVoltage / v;
+    // Sag only: a fresh pack above Vref keeps its full thrust rather than being cut to match
+    const float s = ratio * ratio;
+    scale_ = s > config_.maxBoost ? config_.maxBoost : (s < 1.0f ? 1.0f : s);
+}
+
+float ThrustCompensation::curveThrust(float command) const {
+    return lookup(config_.thrust, ThrustCompensationConfig::kCurvePoints, command);
+}
+
+float ThrustCompensation::curveCommand(float thrust) const {
+    return lookup(inverse_, kInversePoints, thrust);
+}
+
+int ThrustCompensation::apply(int us) const {
+    const float u = (us - kOffUs) / kSpanUs;
+    const float t = (config_.linearize ? clamp01(u) : curveThrust(u)) * scale_;
+    return kOffUs + static_cast<int>(std::lround(kSpanUs * curveCommand(t)));
+}
+
+int ThrustCompensation::inputFor(int us) const {
+    const float t = curveThrust((us - kOffUs) / kSpanUs) / scale_;
+    const float in = config_.linearize ? clamp01(t) : curveCommand(t);
+    return kOffUs + static_cast<int>(std::lround(kSpanUs * in));
+}
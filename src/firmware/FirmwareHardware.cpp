@@ -0,0 +1,20 @@
+#include "firmware/FirmwareHardware.h"
+#include "firmware/FirmwareConfig.h"
+
+#ifndef NATIVE_BUILD
+#include <Arduino.h>
+
+MPU6500IMU physicalImu(5, 34); // CS GPIO5, INT (data-ready) GPIO34
+IBusReceiverDriver physicalPpm(&Serial2);
+DShotESP32Motors dshotMotors({25, 27, 4, 14}, DShotRate::DShot600, kDShotBidirectional, kMotorPoles);
+PWMESP32Motors pwmMotors({25, 27, 4, 14});
+IMotors& physicalMotors = kDShot ? static_cast<IMotors&>(dshotMotors) : pwmMotors;
+ADCBatteryMonitor physicalBattery(33, 3.3f, 77600.0f, 29400.0f);
+ESP32LEDIndicator physicalIndicator(2);
+QMC5883LCompass physicalCompass;
+WebDashboardServer webServer;
+BlackboxLog blackbox;
+TelemetryRing telemetry;
+
+FlightController fc(physicalImu, physicalPpm, physicalMotors, physicalBattery);
+#endif // NATIVE_BUILD
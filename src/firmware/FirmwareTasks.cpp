@@ -0,0 +1,90 @@
+#include "firmware/FirmwareTasks.h"
+#include "firmware/FirmwareHardware.h"
+#include "firmware/FirmwareConfig.h"
+
+#ifndef NATIVE_BUILD
+#include <Arduino.h>
+#include "network/WebDashboardHandlers.h"
+
+void batteryMonitorTask(void *pvParameters) {
+    physicalIndicator.init();
+    while (1) {
+        physicalBattery.update(); // sole writer of currentVoltage_ — Core 0 only
+        
+        physicalIndicator.setLowBattery(physicalBattery.isLow());
+        const VehicleState state = fc.vehicleState().read(); // never the receiver driver itself
+        physicalIndicator.setArmed(state.armed && !state.signalLost);
+        physicalIndicator.update();
+        
+        delay(20); // 50Hz polling rate for smooth non-blocking execution
+    }
+}
+
+void flightControlTask(void *pvParameters) {
+    constexpr uint32_t kPeriodUs = kLoopRates.periodUs();
+    constexpr float    kDt       = kLoopRates.gyroDt();
+    fc.setTimingClock([]() -> uint32_t { return micros(); });
+    if (physicalImu.mode() == ImuAcquisitionMode::DataReady) {
+        while (1) {
+            // Timeout still ticks the FC so failsafe runs if the sensor stops interrupting
+            if (physicalImu.waitForSample(kPeriodUs * 2)) {
+                fc.timingStats().record(LoopStage::TickLateness,
+                                        micros() - physicalImu.lastSampleUs());
+            }
+            fc.update(kDt);
+        }
+    }
+    uint32_t loopTimer = micros();
+    while (1) {
+        fc.timingStats().record(LoopStage::TickLateness, micros() - loopTimer);
+        fc.update(kDt);
+        while ((micros() - loopTimer) < kPeriodUs);
+        loopTimer += kPeriodUs;
+    }
+}
+
+// FFT peak search for the gyro notch bank; the flight task only applies the notches
+void gyroAnalysisTask(void *pvParameters) {
+    while (1) {
+        fc.gyroFilters().dynamicNotch().analyse();
+        vTaskDelay(pdMS_TO_TICKS(10)); // 100 Hz retune, 128-sample (128 ms) window
+    }
+}
+
+// I2C compass read off the flight core; the estimator only sees the cached field
+void compassTask(void *pvParameters) {
+    while (1) {
+        physicalCompass.update();
+        vTaskDelay(pdMS_TO_TICKS(20)); // 50 Hz, QMC5883L output data rate
+    }
+}
+
+// Sole consumer of the flight task's frame ring; encodes into the blackbox off the flight core.
+// Priority 2 so the web task (same core) can't preempt it halfway through a record().
+void telemetryTask(void *pvParameters) {
+    while (1) {
+        drainTelemetry(telemetry, blackbox);
+        vTaskDelay(pdMS_TO_TICKS(5)); // ≤5 frames queued at 1 kHz; ring holds 128
+    }
+}
+
+void webDashboardTask(void *pvParameters) {
+    WebDashboardHandlers::init(physicalPpm, physicalMotors, physicalBattery, fc.vehicleState());
+    WebDashboardHandlers::setTimingStats(fc.timingStats());
+    WebDashboardHandlers::setParams(fc.params());
+    WebDashboardHandlers::setAutotune(fc.autotune());
+    WebDashboardHandlers::setBlackbox(blackbox, telemetry, kLoopRates.gyroHz);
+    while (1) {
+        const bool armed = fc.vehicleState().read().rc[FlightController::ARM_CHANNEL] > FlightController::ARM_THRESHOLD;
+        if (armed && !kLiveTuning) {
+            webServer.stop();
+            delay(500);
+        } else {
+            webServer.begin();
+            webServer.handleClient(); // non-blocking: one pass over every open connection
+            WebDashboardHandlers::commitPendingParams(); // flash write only once disarmed
+            delay(armed ? 20 : 5);
+        }
+    }
+}
+#endif // NATIVE_BUILD
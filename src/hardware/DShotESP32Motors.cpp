@@ -0,0 +1,81 @@
+#include "hardware/DShotESP32Motors.h"
+#include "core/FlightControlConstants.h"
+
+#ifndef NATIVE_BUILD
+#include <Arduino.h>
+#include <driver/rmt.h>
+static_assert(sizeof(rmt_item32_t) == sizeof(uint32_t), "DShotEncoder items are rmt_item32_t");
+#endif
+
+DShotESP32Motors::DShotESP32Motors(std::initializer_list<int> pins, DShotRate rate, bool bidirectional,
+                                   uint8_t motorPoles)
+    : encoder_(rate, bidirectional), bidirectional_(bidirectional), motorPoles_(motorPoles) {
+    const int limit = bidirectional ? kMaxBidirectional : kMaxMotors;
+    for (int pin : pins) {
+        if (count_ < limit) pins_[count_++] = pin;
+    }
+    for (uint8_t& age : rpmAge_) age = kRpmStaleTicks;
+}
+
+void DShotESP32Motors::init() {
+    for (int i = 0; i < count_; ++i) initChannel(i);
+    const int stop[kMaxMotors] = {1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000};
+    writeMotors(stop, count_);
+}
+
+// A queued command takes the place of the stop frame; a spinning motor never sees one
+uint16_t DShotESP32Motors::nextFrame(int motorIdx) {
+    const int us = oActive_[motorIdx] ? oVal_[motorIdx] : outputs_[motorIdx];
+    const uint16_t value = dshotThrottle(us);
+    const uint8_t left = commandTicks_[motorIdx].load(std::memory_order_acquire);
+    if (value != 0 || left == 0) return dshotFrame(value, false, bidirectional_);
+    commandTicks_[motorIdx].store(left - 1, std::memory_order_relaxed);
+    return dshotCommandFrame(static_cast<DShotCommand>(command_[motorIdx]), bidirectional_);
+}
+
+void DShotESP32Motors::writeMotors(const int* us, int count) {
+    if (count > count_) count = count_;
+    for (int i = 0; i < count; ++i) outputs_[i] = us[i];
+    if (bidirectional_) readTelemetry(); // last tick's replies, before this frame's capture starts
+    for (int i = 0; i < count_; ++i) encoder_.encode(nextFrame(i), items_[i]);
+
+#ifndef NATIVE_BUILD
+    // Fill every channel first so the starts below are only register writes
+    for (int i = 0; i < count_; ++i) {
+        rmt_fill_tx_items(static_cast<rmt_channel_t>(i), reinterpret_cast<const rmt_item32_t*>(items_[i]),
+                          DShotEncoder::kItems, 0);
+    }
+    for (int i = 0; i < count_; ++i) rmt_tx_start(static_cast<rmt_channel_t>(i), true);
+#endif
+}
+
+bool DShotESP32Motors::sendCommand(uint8_t command, int motorIdx) {
+    if (command >= kDShotThrottleMin || motorIdx < -1 || motorIdx >= count_) return false;
+    const int first = motorIdx < 0 ? 0 : motorIdx, last = motorIdx < 0 ? count_ - 1 : motorIdx;
+    for (int i = first; i <= last; ++i) {
+        if (getMotorOutput(i) > FlightControlConstants::MOTOR_OFF_US) return false; // spinning
+    }
+    for (int i = first; i <= last; ++i) {
+        command_[i] = command;
+        commandTicks_[i].store(dshotCommandRepeats(static_cast<DShotCommand>(command)), std::memory_order_release);
+    }
+    return true;
+}
+
+void DShotESP32Motors::setOverride(int motorIdx, int value, bool active) {
+    if (motorIdx >= 0 && motorIdx < count_) {
+        oActive_[motorIdx] = active;
+        oVal_[motorIdx] = value;
+    }
+}
+
+int DShotESP32Motors::getMotorOutput(int motorIdx) const {
+    if (motorIdx >= 0 && motorIdx < count_) {
+        return oActive_[motorIdx] ? oVal_[motorIdx] : outputs_[motorIdx];
+    }
+    return 1000;
+}
+
+bool DShotESP32Motors::isMotorOverridden(int motorIdx) const {
+    return (motorIdx >= 0 && motorIdx < count_) ? oActive_[motorIdx] : false;
+}
@@ -0,0 +1,90 @@
+#include "hardware/DShotESP32Motors.h"
+#include <cstddef>
+
+#ifndef NATIVE_BUILD
+#include <Arduino.h>
+#include <driver/rmt.h>
+#include <freertos/ringbuf.h>
+#endif
+
+namespace {
+constexpr int kRxChannelOffset = DShotESP32Motors::kMaxMotors / 2;
+constexpr uint8_t kRxFilterApbTicks = 40;  // 0.5 µs glitch filter
+constexpr uint16_t kRxIdleTicks = 400;     // 10 µs quiet ends a capture: frame and reply split
+constexpr size_t kRxRingBytes = 512;
+}
+
+void DShotESP32Motors::initChannel(int motorIdx) {
+#ifndef NATIVE_BUILD
+    const gpio_num_t pin = static_cast<gpio_num_t>(pins_[motorIdx]);
+    const rmt_channel_t tx = static_cast<rmt_channel_t>(motorIdx);
+    const rmt_channel_t rx = static_cast<rmt_channel_t>(motorIdx + kRxChannelOffset);
+    if (bidirectional_) {
+        // RX first: its rmt_config turns the pin into an input, fixed up below
+        rmt_config_t config = RMT_DEFAULT_CONFIG_RX(pin, rx);
+        config.clk_div = DShotEncoder::kClockDivider;
+        config.rx_config.filter_en = true;
+        config.rx_config.filter_ticks_thresh = kRxFilterApbTicks;
+        config.rx_config.idle_threshold = kRxIdleTicks;
+        rmt_config(&config);
+        rmt_driver_install(rx, kRxRingBytes, 0);
+        RingbufHandle_t ring = nullptr;
+        rmt_get_ringbuf_handle(rx, &ring);
+        rx_[motorIdx] = ring;
+    }
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX(pin, tx);
+    config.clk_div = DShotEncoder::kClockDivider;
+    config.tx_config.idle_output_en = true;
+    config.tx_config.idle_level = bidirectional_ ? RMT_IDLE_LEVEL_HIGH : RMT_IDLE_LEVEL_LOW;
+    rmt_config(&config);
+    rmt_driver_install(tx, 0, 0);
+    if (bidirectional_) {
+        // One wire both ways: open-drain with pull-up, TX driving and RX listening
+        gpio_set_direction(pin, GPIO_MODE_INPUT_OUTPUT_OD);
+        gpio_pullup_en(pin);
+        gpio_matrix_out(pin, RMT_SIG_OUT0_IDX + tx, false, false);
+        gpio_matrix_in(pin, RMT_SIG_IN0_IDX + (motorIdx + kRxChannelOffset), false);
+        rmt_rx_start(static_cast<rmt_channel_t>(motorIdx + kRxChannelOffset), true);
+    }
+#else
+    (void)motorIdx;
+#endif
+}
+
+// Every capture since the last tick: our own frame (refused) and, ~30 µs later, the reply
+void DShotESP32Motors::readTelemetry() {
+    const float ticksPerBit = DShotTelemetry::ticksPerBit(encoder_.rate());
+    for (int i = 0; i < count_; ++i) {
+        bool fresh = false;
+#ifndef NATIVE_BUILD
+        size_t bytes = 0;
+        while (void* items = xRingbufferReceive(static_cast<RingbufHandle_t>(rx_[i]), &bytes, 0)) {
+            uint32_t edges[DShotTelemetry::kMaxEdges];
+            const uint8_t n = DShotTelemetry::edgesFromItems(static_cast<const uint32_t*>(items),
+                                                             static_cast<uint8_t>(bytes / sizeof(uint32_t)), edges);
+            uint32_t periodUs = 0;
+            if (DShotTelemetry::decode(edges, n, ticksPerBit, periodUs)) {
+                rpm_[i] = DShotTelemetry::rpmFromPeriod(periodUs, motorPoles_);
+                fresh = true;
+            }
+            vRingbufferReturnItem(static_cast<RingbufHandle_t>(rx_[i]), items);
+        }
+#else
+        (void)ticksPerBit;
+#endif
+        if (fresh) rpmAge_[i] = 0;
+        else {
+            ++telemetryErrors_;
+            if (rpmAge_[i] < kRpmStaleTicks) ++rpmAge_[i];
+        }
+    }
+}
+
+bool DShotESP32Motors::getMotorRpm(float* rpm) const {
+    if (!bidirectional_) return false;
+    for (int i = 0; i < count_; ++i) {
+        if (rpmAge_[i] >= kRpmStaleTicks) return false;
+        rpm[i] = rpm_[i];
+    }
+    return true;
+}
@@ -1,4 +1,5 @@
 #include "hardware/MPU6050IMU.h"
+#include "core/AttitudeMath.h"
 #include <cmath>
 
 #ifndef NATIVE_BUILD
@@ -38,6 +39,7 @@ void MPU6050IMU::readSensor() {
     float accX = static_cast<float>(accXLSB) / 4096.0f - 0.02f;
     float accY = static_cast<float>(accYLSB) / 4096.0f;
     float accZ = static_cast<float>(accZLSB) / 4096.0f - 0.08f;
+    accel_[0] = accX; accel_[1] = accY; accel_[2] = accZ;
 
     rollAngle_ = std::atan(accY / std::sqrt(accX * accX + accZ * accZ)) * (180.0f / 3.142f);
     pitchAngle_ = -std::atan(accX / std::sqrt(accY * accY + accZ * accZ)) * (180.0f / 3.142f);
@@ -60,6 +62,14 @@ void MPU6050IMU::getAccAngles(float& rollAngle, float& pitchAngle) const {
     }
 }
 
+void MPU6050IMU::getAccel(float& ax, float& ay, float& az) const {
+    if (overrideActive_) {
+        accelFromAccAngles(oRollAngle_, oPitchAngle_, ax, ay, az);
+    } else {
+        ax = accel_[0]; ay = accel_[1]; az = accel_[2];
+    }
+}
+
 void MPU6050IMU::setOverride(float rollRate, float pitchRate, float yawRate,
                               float rollAngle, float pitchAngle) {
     oRollRate_ = rollRate; oPitchRate_ = pitchRate; oYawRate_ = yawRate;
@@ -1,26 +1,40 @@
 #include "hardware/MPU6500IMU.h"
-#include <cmath>
 
 #ifndef NATIVE_BUILD
 #include <SPI.h>
 #endif
 
-#ifndef NATIVE_BUILD
-MPU6500IMU::MPU6500IMU(uint8_t csPin) : cs_(csPin) {}
+MPU6500IMU::MPU6500IMU(uint8_t csPin, int8_t intPin) : cs_(csPin), intPin_(intPin) {}
 
-void MPU6500IMU::begin() {
-    SPI.begin(18, 19, 23, cs_);
-    pinMode(cs_, OUTPUT);
-    digitalWrite(cs_, HIGH);
+#ifndef NATIVE_BUILD
+void MPU6500IMU::begin(ImuAcquisitionMode mode) {
+    mode_ = (mode == ImuAcquisitionMode::DataReady && intPin_ < 0) ? ImuAcquisitionMode::Polled : mode;
+    const bool dma = mode_ != ImuAcquisitionMode::Polled && beginDmaBus();
+    if (!dma) {
+        // FIFO draining works over Arduino SPI too; interrupt pacing needs the DMA device
+        if (mode_ == ImuAcquisitionMode::DataReady) mode_ = ImuAcquisitionMode::Polled;
+        SPI.begin(18, 19, 23, cs_);
+        pinMode(cs_, OUTPUT);
+        digitalWrite(cs_, HIGH);
+    }
     delay(10);
     writeReg(0x6B, 0x80); // Device reset
     delay(100);            // Wait for reset to complete
     writeReg(0x6B, 0x00); // Wake up (internal 20MHz clock)
     delay(100);            // Wait for oscillator to stabilize
-    writeReg(0x19, 0x00); // Sample rate divider = 0 (max rate)
+    writeReg(0x19, 0x00); // Sample rate divider = 0 (1 kHz with DLPF on)
     writeReg(0x1A, 0x03); // DLPF_CFG=3: Gyro BW 41Hz, 5.9ms delay
     writeReg(0x1B, 0x08); // Gyro ±500dps
     writeReg(0x1C, 0x08); // Accel ±4g
+    if (mode_ == ImuAcquisitionMode::Fifo) {
+        beginFifo();
+    } else if (mode_ == ImuAcquisitionMode::DataReady) {
+        writeReg(0x37, 0x00); // INT_PIN_CFG: active-high push-pull, 50µs pulse
+        writeReg(0x38, 0x01); // INT_ENABLE: RAW_RDY_EN
+        pinMode(intPin_, INPUT);
+        xTaskCreatePinnedToCore(kickBursts, "IMU DMA", 2048, this, configMAX_PRIORITIES - 1, &kicker_, 1);
+        attachInterruptArg(intPin_, onDataReady, this, RISING);
+    }
 }
 
 bool MPU6500IMU::isConnected() {
@@ -29,11 +43,29 @@ bool MPU6500IMU::isConnected() {
 
 void MPU6500IMU::readSensor() {
     if (oActive_) return;
+    if (mode_ == ImuAcquisitionMode::DataReady && waiter_) {
+        // No bus traffic here: DMA finished this sample's burst before waitForSample() returned
+        convertSample(burstRx_[frontIdx_.load(std::memory_order_acquire)]);
+        return;
+    }
+    if (mode_ == ImuAcquisitionMode::Fifo) {
+        drainFifo();
+        return;
+    }
+    // Polled, or DataReady before the flight task waits on samples (setup()'s gyro calibration)
     uint8_t buffer[14];
     readBytes(0x3B, buffer, 14);
-    int16_t ax = (buffer[0] << 8) | buffer[1];
-    int16_t ay = (buffer[2] << 8) | buffer[3];
-    int16_t az = (buffer[4] << 8) | buffer[5];
+    convertSample(buffer);
+}
+#else
+void MPU6500IMU::begin(ImuAcquisitionMode) {}
+bool MPU6500IMU::isConnected() { return true; }
+void MPU6500IMU::readSensor() {}
+bool MPU6500IMU::waitForSample(uint32_t) { return true; }
+#endif
+
+void MPU6500IMU::convertSample(const uint8_t* buffer) {
+    convertAccel(buffer);
     int16_t gx = (buffer[8] << 8) | buffer[9];
     int16_t gy = (buffer[10] << 8) | buffer[11];
     int16_t gz = (buffer[12] << 8) | buffer[13];
@@ -41,20 +73,7 @@ void MPU6500IMU::readSensor() {
     rollRate_ = static_cast<float>(gx) / GYRO_SCALE;
     pitchRate_ = static_cast<float>(gy) / GYRO_SCALE;
     yawRate_ = static_cast<float>(gz) / GYRO_SCALE;
-
-    float accX = static_cast<float>(ax) / ACCEL_SCALE;
-    float accY = static_cast<float>(ay) / ACCEL_SCALE;
-    float accZ = static_cast<float>(az) / ACCEL_SCALE;
-
-    rollAngle_  =  std::atan2(accY, std::sqrt(accX * accX + accZ * accZ)) * kRadToDeg;
-    pitchAngle_ = -std::atan2(accX, std::sqrt(accY * accY + accZ * accZ)) * kRadToDeg;
 }
-#else
-MPU6500IMU::MPU6500IMU(uint8_t csPin) : cs_(csPin) {}
-void MPU6500IMU::begin() {}
-bool MPU6500IMU::isConnected() { return true; }
-void MPU6500IMU::readSensor() {}
-#endif
 
 void MPU6500IMU::getGyroRates(float& r, float& p, float& y) const {
     r = oActive_ ? oRollRate_ : rollRate_;
@@ -63,43 +82,16 @@ void MPU6500IMU::getGyroRates(float& r, float& p, float& y) const {
 }
 
 void MPU6500IMU::getAccAngles(float& r, float& p) const {
-    r = oActive_ ? oRollAngle_ : rollAngle_;
-    p = oActive_ ? oPitchAngle_ : pitchAngle_;
+    if (oActive_) { r = oRollAngle_; p = oPitchAngle_; return; }
+    accAnglesFromAccel(accel_[0], accel_[1], accel_[2], r, p);
+}
+
+void MPU6500IMU::getAccel(float& x, float& y, float& z) const {
+    if (oActive_) { accelFromAccAngles(oRollAngle_, oPitchAngle_, x, y, z); return; }
+    x = accel_[0]; y = accel_[1]; z = accel_[2];
 }
 
 void MPU6500IMU::setOverride(float rR, float pR, float yR, float rA, float pA) {
     oRollRate_ = rR; oPitchRate_ = pR; oYawRate_ = yR;
     oRollAngle_ = rA; oPitchAngle_ = pA;
 }
-
-#ifndef NATIVE_BUILD
-void MPU6500IMU::writeReg(uint8_t reg, uint8_t val) {
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE3));
-    digitalWrite(cs_, LOW);
-    SPI.transfer(reg & 0x7F);
-    SPI.transfer(val);
-    digitalWrite(cs_, HIGH);
-    SPI.endTransaction();
-}
-
-uint8_t MPU6500IMU::readReg(uint8_t reg) {
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE3));
-    digitalWrite(cs_, LOW);
-    SPI.transfer(reg | 0x80);
-    uint8_t val = SPI.transfer(0x00);
-    digitalWrite(cs_, HIGH);
-    SPI.endTransaction();
-    return val;
-}
-
-void MPU6500IMU::readBytes(uint8_t reg, uint8_t *buf, uint8_t len) {
-    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE3));
-    digitalWrite(cs_, LOW);
-    SPI.transfer(reg | 0x80);
-    for (uint8_t i = 0; i < len; i++) {
-        buf[i] = SPI.transfer(0x00);
-    }
-    digitalWrite(cs_, HIGH);
-    SPI.endTransaction();
-}
-#endif
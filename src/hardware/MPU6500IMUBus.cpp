@@ -0,0 +1,52 @@
+#include "hardware/MPU6500IMU.h"
+
+#ifndef NATIVE_BUILD
+#include <SPI.h>
+
+// Register I/O. Polled mode keeps the Arduino SPI path; DataReady and Fifo modes own VSPI
+// through spi_master so configuration writes and the DMA burst reads share one device handle.
+
+void MPU6500IMU::writeReg(uint8_t reg, uint8_t val) {
+    if (dmaDev_) {
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_TXDATA;
+        t.addr = reg & 0x7F;
+        t.length = 8;
+        t.tx_data[0] = val;
+        spi_device_polling_transmit(dmaDev_, &t);
+        return;
+    }
+    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE3));
+    digitalWrite(cs_, LOW);
+    SPI.transfer(reg & 0x7F);
+    SPI.transfer(val);
+    digitalWrite(cs_, HIGH);
+    SPI.endTransaction();
+}
+
+uint8_t MPU6500IMU::readReg(uint8_t reg) {
+    uint8_t val = 0;
+    readBytes(reg, &val, 1);
+    return val;
+}
+
+void MPU6500IMU::readBytes(uint8_t reg, uint8_t *buf, uint16_t len) {
+    if (dmaDev_) {
+        // Register address goes out in the device's 8-bit address phase; MOSI is idle after
+        spi_transaction_t t = {};
+        t.addr = reg | 0x80;
+        t.length = len * 8;
+        t.rx_buffer = buf;
+        spi_device_polling_transmit(dmaDev_, &t);
+        return;
+    }
+    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE3));
+    digitalWrite(cs_, LOW);
+    SPI.transfer(reg | 0x80);
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = SPI.transfer(0x00);
+    }
+    digitalWrite(cs_, HIGH);
+    SPI.endTransaction();
+}
+#endif
@@ -0,0 +1,80 @@
+#include "hardware/MPU6500IMU.h"
+
+#ifndef NATIVE_BUILD
+#include <esp_timer.h>
+
+bool MPU6500IMU::beginDmaBus() {
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = 23;
+    bus.miso_io_num = 19;
+    bus.sclk_io_num = 18;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = kFifoBytes;
+    if (spi_bus_initialize(VSPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+
+    spi_device_interface_config_t dev = {};
+    dev.address_bits = 8; // register address + R/W bit
+    dev.mode = 3;
+    dev.clock_speed_hz = 8000000;
+    dev.spics_io_num = cs_;
+    dev.queue_size = 1;
+    dev.post_cb = onBurstDone;
+    if (spi_bus_add_device(VSPI_HOST, &dev, &dmaDev_) != ESP_OK) {
+        spi_bus_free(VSPI_HOST);
+        dmaDev_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+// INT edge. spi_master cannot be driven from a GPIO ISR, so the edge goes to kickBursts()
+void IRAM_ATTR MPU6500IMU::onDataReady(void* arg) {
+    MPU6500IMU* self = static_cast<MPU6500IMU*>(arg);
+    self->lastSampleUs_ = static_cast<uint32_t>(esp_timer_get_time());
+    if (!self->waiter_) return; // setup()'s calibration still reads the bus directly
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->kicker_, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Top priority on the flight core, a few µs per edge: queues the burst into the back buffer
+// and blocks again while the SPI/DMA hardware clocks it in. The previous burst finished a
+// sample period ago, so collecting its result never waits.
+void MPU6500IMU::kickBursts(void* arg) {
+    MPU6500IMU* self = static_cast<MPU6500IMU*>(arg);
+    self->burst_.addr = 0x3B | 0x80; // ACCEL_XOUT_H, read
+    self->burst_.length = kBurstLen * 8;
+    self->burst_.user = self;        // marks the burst for onBurstDone()
+    bool inFlight = false;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        spi_transaction_t* done;
+        if (inFlight) spi_device_get_trans_result(self->dmaDev_, &done, portMAX_DELAY);
+        self->burst_.rx_buffer = self->burstRx_[self->frontIdx_.load(std::memory_order_relaxed) ^ 1];
+        inFlight = spi_device_queue_trans(self->dmaDev_, &self->burst_, 0) == ESP_OK;
+    }
+}
+
+// SPI ISR after every transaction on the device; only the burst carries user
+void IRAM_ATTR MPU6500IMU::onBurstDone(spi_transaction_t* t) {
+    MPU6500IMU* self = static_cast<MPU6500IMU*>(t->user);
+    if (!self) return;
+    self->frontIdx_.store(self->frontIdx_.load(std::memory_order_relaxed) ^ 1, std::memory_order_release);
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->waiter_, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+bool MPU6500IMU::waitForSample(uint32_t timeoutUs) {
+    if (mode_ != ImuAcquisitionMode::DataReady) return false;
+    if (!waiter_) waiter_ = xTaskGetCurrentTaskHandle(); // from here on every edge starts a burst
+
+    TickType_t ticks = pdMS_TO_TICKS((timeoutUs + 999) / 1000);
+    uint32_t pending = ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);
+    if (pending == 0) return false;
+    // More than one completed burst since the last take means the task overran a sample period
+    if (pending > 1) missedSamples_.fetch_add(pending - 1, std::memory_order_relaxed);
+    return true;
+}
+#endif
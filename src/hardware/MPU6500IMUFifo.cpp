@@ -0,0 +1,48 @@
+#include "hardware/MPU6500IMU.h"
+#include <cmath>
+
+#ifndef NATIVE_BUILD
+// FIFO acquisition: the gyro runs at 8 kHz with only its 250 Hz internal DLPF, every
+// sample is queued, and the control loop averages whatever accumulated since its last tick.
+// Accel stays on the data registers; the estimator only needs it at loop rate.
+
+void MPU6500IMU::beginFifo() {
+    writeReg(0x1A, 0x40); // CONFIG: FIFO_MODE=1 (stop when full), DLPF_CFG=0: 250Hz BW, 8kHz
+    writeReg(0x23, 0x70); // FIFO_EN: gyro X/Y/Z (6 bytes per frame)
+    writeReg(0x6A, 0x44); // USER_CTRL: FIFO_EN | FIFO_RST
+}
+
+void MPU6500IMU::drainFifo() {
+    // INT_STATUS (0x3A) sits right before ACCEL_XOUT_H, so one burst gets both
+    uint8_t head[7];
+    readBytes(0x3A, head, sizeof(head));
+    convertAccel(&head[1]);
+
+    uint8_t countBuf[2];
+    readBytes(0x72, countBuf, 2); // FIFO_COUNT_H/L
+    uint16_t count = ((countBuf[0] << 8) | countBuf[1]) & 0x1FFF;
+
+    // FIFO_OFLOW_INT: frames were dropped, so the batch no longer spans one tick. Restart
+    // the FIFO and hold the previous rates rather than feed a stale average to the PIDs.
+    if ((head[0] & 0x10) || count >= kFifoBytes) {
+        fifoOverflows_.fetch_add(1, std::memory_order_relaxed);
+        writeReg(0x6A, 0x44);
+        return;
+    }
+    count = GyroFifoDecimator::wholeFrameBytes(count); // keep X/Y/Z aligned for the next drain
+    if (count) readBytes(0x74, fifoBuf_, count); // FIFO_R_W
+    fifo_.consume(fifoBuf_, count);
+    fifo_.getRates(rollRate_, pitchRate_, yawRate_);
+}
+
+void MPU6500IMU::convertAccel(const uint8_t* buffer) {
+    int16_t ax = (buffer[0] << 8) | buffer[1];
+    int16_t ay = (buffer[2] << 8) | buffer[3];
+    int16_t az = (buffer[4] << 8) | buffer[5];
+
+    accel_[0] = static_cast<float>(ax) / ACCEL_SCALE;
+    accel_[1] = static_cast<float>(ay) / ACCEL_SCALE;
+    accel_[2] = static_cast<float>(az) / ACCEL_SCALE;
+}
+
+#endif
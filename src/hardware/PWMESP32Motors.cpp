@@ -4,13 +4,15 @@
 #include <Arduino.h>
 #endif
 
-PWMESP32Motors::PWMESP32Motors(int pinM1, int pinM2, int pinM3, int pinM4) {
-    pins_[0] = pinM1; pins_[1] = pinM2; pins_[2] = pinM3; pins_[3] = pinM4;
+PWMESP32Motors::PWMESP32Motors(std::initializer_list<int> pins) {
+    for (int pin : pins) {
+        if (count_ < kMaxMotors) pins_[count_++] = pin;
+    }
 }
 
 void PWMESP32Motors::init() {
 #ifndef NATIVE_BUILD
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < count_; ++i) {
         pinMode(pins_[i], OUTPUT);
         ledcSetup(i, LEDC_FREQ_HZ, LEDC_BITS);
         ledcAttachPin(pins_[i], i);
@@ -18,11 +20,12 @@ void PWMESP32Motors::init() {
 #endif
 }
 
-void PWMESP32Motors::writeMotors(int m1, int m2, int m3, int m4) {
-    outputs_[0] = m1; outputs_[1] = m2; outputs_[2] = m3; outputs_[3] = m4;
-    
+void PWMESP32Motors::writeMotors(const int* us, int count) {
+    if (count > count_) count = count_;
+    for (int i = 0; i < count; ++i) outputs_[i] = us[i];
+
 #ifndef NATIVE_BUILD
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < count_; ++i) {
         int speed = oActive_[i] ? oVal_[i] : outputs_[i];
         ledcWrite(i, usToDuty(speed));
     }
@@ -30,19 +33,19 @@ void PWMESP32Motors::writeMotors(int m1, int m2, int m3, int m4) {
 }
 
 void PWMESP32Motors::setOverride(int motorIdx, int value, bool active) {
-    if (motorIdx >= 0 && motorIdx < 4) {
+    if (motorIdx >= 0 && motorIdx < count_) {
         oActive_[motorIdx] = active;
         oVal_[motorIdx] = value;
     }
 }
 
 int PWMESP32Motors::getMotorOutput(int motorIdx) const {
-    if (motorIdx >= 0 && motorIdx < 4) {
+    if (motorIdx >= 0 && motorIdx < count_) {
         return oActive_[motorIdx] ? oVal_[motorIdx] : outputs_[motorIdx];
     }
     return 1000;
 }
 
 bool PWMESP32Motors::isMotorOverridden(int motorIdx) const {
-    return (motorIdx >= 0 && motorIdx < 4) ? oActive_[motorIdx] : false;
+    return (motorIdx >= 0 && motorIdx < count_) ? oActive_[motorIdx] : false;
 }
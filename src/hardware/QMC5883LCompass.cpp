@@ -5,7 +5,9 @@
 #include <Wire.h>
 #endif
 
-QMC5883LCompass::QMC5883LCompass() {}
+QMC5883LCompass::QMC5883LCompass() {
+    for (auto& c : cached_) c.store(0.0f, std::memory_order_relaxed);
+}
 
 bool QMC5883LCompass::begin() {
 #ifndef NATIVE_BUILD
@@ -18,14 +20,14 @@ bool QMC5883LCompass::begin() {
     return true;
 }
 
-void QMC5883LCompass::readMag(float &mx, float &my, float &mz) {
+bool QMC5883LCompass::readMag(float &mx, float &my, float &mz) {
     mx = 0.0f; my = 0.0f; mz = 0.0f;
 #ifndef NATIVE_BUILD
     uint8_t status = 0;
     readRegs(0x06, &status, 1);
-    if (!(status & 0x01)) return; // Data not ready
+    if (!(status & 0x01)) return false; // Data not ready
     uint8_t buf[6];
-    if (!readRegs(0x00, buf, 6)) return;
+    if (!readRegs(0x00, buf, 6)) return false;
     int16_t x = (int16_t)(buf[1] << 8 | buf[0]);
     int16_t y = (int16_t)(buf[3] << 8 | buf[2]);
     int16_t z = (int16_t)(buf[5] << 8 | buf[4]);
@@ -34,9 +36,27 @@ void QMC5883LCompass::readMag(float &mx, float &my, float &mz) {
     mx = (static_cast<float>(x) - offset_[0]) * scale_[0] * (2.0f / 32768.0f);
     my = (static_cast<float>(y) - offset_[1]) * scale_[1] * (2.0f / 32768.0f);
     mz = (static_cast<float>(z) - offset_[2]) * scale_[2] * (2.0f / 32768.0f);
+    return true;
+#else
+    return false;
 #endif
 }
 
+void QMC5883LCompass::update() {
+    float m[3];
+    if (!readMag(m[0], m[1], m[2])) return;
+    for (int i = 0; i < 3; ++i) cached_[i].store(m[i], std::memory_order_relaxed);
+    valid_.store(true, std::memory_order_release);
+}
+
+bool QMC5883LCompass::getMag(float& mx, float& my, float& mz) const {
+    if (!valid_.load(std::memory_order_acquire)) return false;
+    mx = cached_[0].load(std::memory_order_relaxed);
+    my = cached_[1].load(std::memory_order_relaxed);
+    mz = cached_[2].load(std::memory_order_relaxed);
+    return true;
+}
+
 float QMC5883LCompass::getHeading() {
     float mx = 0, my = 0, mz = 0;
     readMag(mx, my, mz);
@@ -1,78 +1,45 @@
 #ifndef NATIVE_BUILD
 #include <Arduino.h>
 #include <Wire.h>
-#include "hardware/MPU6500IMU.h"
-#include "hardware/IBusReceiverDriver.h"
-#include "hardware/PWMESP32Motors.h"
-#include "hardware/ADCBatteryMonitor.h"
-#include "hardware/QMC5883LCompass.h"
-#include "hardware/ESP32LEDIndicator.h"
-#include "network/WebDashboardServer.h"
-#include "network/WebDashboardHandlers.h"
-#include "core/FlightController.h"
-
-MPU6500IMU physicalImu(5);
-IBusReceiverDriver physicalPpm(&Serial2);
-PWMESP32Motors physicalMotors(25, 27, 4, 14);
-ADCBatteryMonitor physicalBattery(33, 3.3f, 77600.0f, 29400.0f);
-ESP32LEDIndicator physicalIndicator(2);
-QMC5883LCompass physicalCompass;
-WebDashboardServer webServer;
-
-FlightController fc(physicalImu, physicalPpm, physicalMotors, physicalBattery);
-uint32_t loopTimer = 0;
-
-void batteryMonitorTask(void *pvParameters) {
-    physicalIndicator.init();
-    while (1) {
-        physicalBattery.update(); // sole writer of currentVoltage_ — Core 0 only
-        
-        physicalIndicator.setLowBattery(physicalBattery.isLow());
-        physicalIndicator.setArmed(physicalPpm.getChannel(FlightController::ARM_CHANNEL) > FlightController::ARM_THRESHOLD && !physicalPpm.isSignalLost());
-        physicalIndicator.update();
-        
-        delay(20); // 50Hz polling rate for smooth non-blocking execution
-    }
-}
-
-void flightControlTask(void *pvParameters) {
-    constexpr uint32_t kPeriodUs = 4000; // 250Hz
-    constexpr float    kDt       = kPeriodUs * 1e-6f;
-    loopTimer = micros();
-    while (1) {
-        fc.update(kDt);
-        while ((micros() - loopTimer) < kPeriodUs);
-        loopTimer += kPeriodUs;
-    }
-}
-
-void webDashboardTask(void *pvParameters) {
-    WebDashboardHandlers::init(physicalPpm, physicalMotors, physicalBattery, physicalImu);
-    while (1) {
-        if (physicalPpm.getChannel(4) > 1500) {
-            webServer.stop();
-            delay(500);
-        } else {
-            webServer.begin();
-            webServer.handleClient();
-            delay(5);
-        }
-    }
-}
+#include "firmware/FirmwareConfig.h"
+#include "firmware/FirmwareHardware.h"
+#include "firmware/FirmwareTasks.h"
 
 void setup() {
     Serial.begin(115200);
     Wire.begin();
     delay(250);
 
-    physicalImu.begin();
+    physicalImu.begin(kImuMode);
     physicalCompass.begin();
-    physicalMotors.init();
+    if (kDShot) dshotMotors.init(); else pwmMotors.init();
     physicalBattery.init();
     physicalPpm.begin();
+    fc.setLoopRates(kLoopRates);
+    if (!fc.setFrame(kFrame)) Serial.println("Frame needs more motor pins; flying QuadX");
+    // Keep rate-loop gain flat as the pack sags. linearize stays off until thrust[] holds a
+    // thrust-stand curve for these motors/props (it also moves hover to a lower stick).
+    ThrustCompensationConfig thrustComp;
+    thrustComp.sagCompensation = true;
+    fc.setThrustCompensation(thrustComp);
+    DynamicNotchConfig notch;
+    notch.enabled = true;
+    fc.gyroFilters().setDynamicNotch(notch);
+    fc.gyroFilters().setLowpass(kGyroLowpassPt1Hz, kGyroLowpassBiquadHz);
+    if (kDShot && kDShotBidirectional) {
+        // eRPM centres these notches every tick; fundamentalHz[] only covers telemetry dropouts
+        HarmonicNotchConfig harmonic;
+        harmonic.enabled = true;
+        fc.gyroFilters().setHarmonicNotch(harmonic);
+    }
+    fc.setCompass(&physicalCompass);
+    fc.setTelemetry(&telemetry);
     fc.init();
 
     xTaskCreatePinnedToCore(batteryMonitorTask, "Battery Task", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(gyroAnalysisTask, "Gyro FFT Task", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(compassTask, "Compass Task", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(telemetryTask, "Telemetry Task", 4096, NULL, 2, NULL, 0);
     xTaskCreatePinnedToCore(webDashboardTask, "Web Task", 8192, NULL, 1, NULL, 0);
     xTaskCreatePinnedToCore(flightControlTask, "Flight Task", 8192, NULL, 2, NULL, 1);
 }
@@ -0,0 +1,96 @@
+#include "network/HttpExchange.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+const char* reason(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        case 503: return "Service Unavailable";
+        default:  return code < 400 ? "OK" : "Internal Server Error";
+    }
+}
+}
+
+void HttpExchange::open(int fd, uint32_t nowMs) {
+    endBody();
+    fd_ = fd;
+    phase_ = Phase::Reading;
+    lastActivityMs_ = nowMs;
+    rxLen_ = 0;
+    method_ = HttpMethod::Other;
+    path_ = "";
+    ifNoneMatch_ = "";
+    argCount_ = 0;
+    txLen_ = txPos_ = 0;
+    static_ = nullptr;
+    staticLen_ = staticPos_ = 0;
+    responded_ = false;
+}
+
+void HttpExchange::endBody() {
+    if (body_) body_->~IHttpBody();
+    body_ = nullptr;
+}
+
+HttpArg HttpExchange::arg(const char* name) const {
+    for (uint8_t i = 0; i < argCount_; ++i) {
+        if (std::strcmp(argName_[i], name) == 0) return HttpArg(argValue_[i]);
+    }
+    return HttpArg(nullptr);
+}
+
+bool HttpExchange::writeHeader(int code, const char* contentType, long contentLength, const char* extraHeaders) {
+    if (responded_) return false;
+    responded_ = true;
+    int n = std::snprintf(tx_, sizeof(tx_), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code, reason(code), contentType);
+    if (contentLength >= 0) n += std::snprintf(tx_ + n, sizeof(tx_) - n, "Content-Length: %ld\r\n", contentLength);
+    n += std::snprintf(tx_ + n, sizeof(tx_) - n, "%sConnection: close\r\n\r\n", extraHeaders);
+    txLen_ = static_cast<size_t>(n);
+    txPos_ = 0;
+    return true;
+}
+
+void HttpExchange::send(int code, const char* contentType, const char* content) {
+    const size_t len = std::strlen(content);
+    if (!writeHeader(code, contentType, static_cast<long>(len))) return;
+    if (txLen_ + len > sizeof(tx_)) {
+        static const char kTooLarge[] = "Response too large";
+        responded_ = false;
+        writeHeader(500, "text/plain", sizeof(kTooLarge) - 1);
+        std::memcpy(tx_ + txLen_, kTooLarge, sizeof(kTooLarge) - 1);
+        txLen_ += sizeof(kTooLarge) - 1;
+        return;
+    }
+    std::memcpy(tx_ + txLen_, content, len);
+    txLen_ += len;
+}
+
+void HttpExchange::sendStatic(int code, const char* contentType, const char* content, size_t len) {
+    if (!writeHeader(code, contentType, static_cast<long>(len))) return;
+    static_ = content;
+    staticLen_ = len;
+    staticPos_ = 0;
+}
+
+// The If-None-Match list is matched as a substring: ETags are quoted hashes, and "*"
+// is never sent for a GET of a known path.
+void HttpExchange::sendAsset(const HttpAsset& asset) {
+    char headers[160];
+    std::snprintf(headers, sizeof(headers), "ETag: %s\r\nCache-Control: %s\r\n", asset.etag, asset.cacheControl);
+    if (*ifNoneMatch_ && std::strstr(ifNoneMatch_, asset.etag)) {
+        writeHeader(304, asset.contentType, -1, headers);
+        return;
+    }
+    const size_t n = std::strlen(headers);
+    std::snprintf(headers + n, sizeof(headers) - n, "Content-Encoding: gzip\r\n");
+    if (!writeHeader(200, asset.contentType, static_cast<long>(asset.len), headers)) return;
+    static_ = reinterpret_cast<const char*>(asset.data);
+    staticLen_ = asset.len;
+    staticPos_ = 0;
+}
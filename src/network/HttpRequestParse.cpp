@@ -0,0 +1,89 @@
+#include "network/HttpExchange.h"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+namespace {
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    return (std::tolower(static_cast<unsigned char>(c)) - 'a') + 10;
+}
+
+// application/x-www-form-urlencoded → plain text, in place
+void urlDecode(char* s) {
+    char* out = s;
+    for (; *s; ++s) {
+        if (*s == '+') {
+            *out++ = ' ';
+        } else if (*s == '%' && std::isxdigit(static_cast<unsigned char>(s[1]))
+                   && std::isxdigit(static_cast<unsigned char>(s[2]))) {
+            *out++ = static_cast<char>(hexValue(s[1]) * 16 + hexValue(s[2]));
+            s += 2;
+        } else {
+            *out++ = *s;
+        }
+    }
+    *out = '\0';
+}
+}
+
+void HttpExchange::addArgs(char* encoded) {
+    char* save = nullptr;
+    for (char* pair = strtok_r(encoded, "&", &save); pair && argCount_ < kMaxArgs;
+         pair = strtok_r(nullptr, "&", &save)) {
+        char* eq = std::strchr(pair, '=');
+        char* value = eq ? eq + 1 : pair + std::strlen(pair);
+        if (eq) *eq = '\0';
+        urlDecode(pair);
+        urlDecode(value);
+        argName_[argCount_] = pair;
+        argValue_[argCount_] = value;
+        ++argCount_;
+    }
+}
+
+// Waits for the blank line and Content-Length bytes of body, then splits the request
+// line and decodes query + form arguments in place. Headers other than
+// Content-Length and If-None-Match are not kept.
+HttpExchange::Parse HttpExchange::parse() {
+    rx_[rxLen_] = '\0';
+    char* headerEnd = std::strstr(rx_, "\r\n\r\n");
+    if (!headerEnd) return rxLen_ >= kRequestBytes ? Parse::TooLarge : Parse::Incomplete;
+    const size_t headerLen = static_cast<size_t>(headerEnd - rx_) + 4;
+
+    size_t bodyLen = 0;
+    char* etagLine = nullptr;
+    for (char* line = std::strstr(rx_, "\r\n"); line && line < headerEnd; line = std::strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Length:", 15) == 0) bodyLen = std::strtoul(line + 17, nullptr, 10);
+        if (strncasecmp(line + 2, "If-None-Match:", 14) == 0) etagLine = line + 16;
+    }
+    if (bodyLen > kRequestBytes - headerLen) return Parse::TooLarge;
+    if (rxLen_ < headerLen + bodyLen) return Parse::Incomplete;
+
+    *headerEnd = '\0';
+    if (etagLine) {
+        etagLine[std::strcspn(etagLine, "\r")] = '\0'; // ends this header line only
+        ifNoneMatch_ = etagLine + std::strspn(etagLine, " ");
+    }
+    char* target = std::strchr(rx_, ' ');
+    if (!target) return Parse::Malformed;
+    *target++ = '\0';
+    char* version = std::strchr(target, ' ');
+    if (!version || std::strncmp(version + 1, "HTTP/", 5) != 0) return Parse::Malformed;
+    *version = '\0';
+    method_ = std::strcmp(rx_, "GET") == 0 ? HttpMethod::Get
+            : std::strcmp(rx_, "POST") == 0 ? HttpMethod::Post : HttpMethod::Other;
+
+    argCount_ = 0;
+    char* query = std::strchr(target, '?');
+    if (query) *query++ = '\0';
+    path_ = target;
+    if (query) addArgs(query);
+    if (bodyLen) {
+        char* body = rx_ + headerLen;
+        body[bodyLen] = '\0';
+        addArgs(body);
+    }
+    return Parse::Ready;
+}
@@ -0,0 +1,81 @@
+#include "network/HttpServer.h"
+#include "network/HttpSocket.h"
+#include <cstring>
+
+bool HttpServer::on(HttpMethod method, const char* path, Handler handler) {
+    if (routeCount_ >= kMaxRoutes) return false;
+    routes_[routeCount_++] = Route{method, path, handler};
+    return true;
+}
+
+bool HttpServer::begin(uint16_t port) {
+    if (listenFd_ >= 0) return true;
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    socklen_t addrLen = sizeof(addr);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0
+        || listen(fd, kMaxConnections) < 0 || !httpSetNonBlocking(fd)
+        || getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addrLen) < 0) {
+        close(fd);
+        return false;
+    }
+    listenFd_ = fd;
+    port_ = ntohs(addr.sin_port);
+    return true;
+}
+
+void HttpServer::stop() {
+    for (HttpExchange& c : conns_) {
+        if (c.fd_ >= 0) drop(c);
+    }
+    if (listenFd_ >= 0) close(listenFd_);
+    listenFd_ = -1;
+}
+
+uint8_t HttpServer::openConnections() const {
+    uint8_t n = 0;
+    for (const HttpExchange& c : conns_) n += c.fd_ >= 0 ? 1 : 0;
+    return n;
+}
+
+void HttpServer::poll(uint32_t nowMs) {
+    if (listenFd_ < 0) return;
+    acceptPending(nowMs);
+    for (HttpExchange& c : conns_) {
+        if (c.phase_ == HttpExchange::Phase::Reading) readRequest(c, nowMs);
+        if (c.phase_ == HttpExchange::Phase::Writing) writeResponse(c, nowMs);
+    }
+}
+
+void HttpServer::acceptPending(uint32_t nowMs) {
+    for (;;) {
+        const int fd = accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) return;
+        HttpExchange* slot = nullptr;
+        for (HttpExchange& c : conns_) {
+            if (c.fd_ < 0) { slot = &c; break; }
+        }
+        if (!slot || !httpSetNonBlocking(fd)) {
+            static const char kBusy[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            ::send(fd, kBusy, sizeof(kBusy) - 1, MSG_NOSIGNAL | MSG_DONTWAIT);
+            close(fd);
+            ++rejected_;
+            continue;
+        }
+        slot->open(fd, nowMs);
+    }
+}
+
+void HttpServer::drop(HttpExchange& c) {
+    c.endBody();
+    close(c.fd_);
+    c.fd_ = -1;
+    c.phase_ = HttpExchange::Phase::Idle;
+}
@@ -0,0 +1,70 @@
+#include "network/HttpServer.h"
+#include "network/HttpSocket.h"
+#include <cstring>
+
+void HttpServer::readRequest(HttpExchange& c, uint32_t nowMs) {
+    const ssize_t n = recv(c.fd_, c.rx_ + c.rxLen_, HttpExchange::kRequestBytes - c.rxLen_, 0);
+    if (n == 0 || (n < 0 && !httpWouldBlock())) { drop(c); return; }
+    if (n < 0) {
+        if (nowMs - c.lastActivityMs_ > kRequestTimeoutMs) drop(c); // stalled half-request
+        return;
+    }
+    c.rxLen_ += static_cast<size_t>(n);
+    c.lastActivityMs_ = nowMs;
+    switch (c.parse()) {
+        case HttpExchange::Parse::Incomplete: return;
+        case HttpExchange::Parse::Ready:      dispatch(c); break;
+        case HttpExchange::Parse::TooLarge:   c.send(413, "text/plain", "Request too large"); break;
+        case HttpExchange::Parse::Malformed:  c.send(400, "text/plain", "Bad request"); break;
+    }
+    c.phase_ = HttpExchange::Phase::Writing;
+}
+
+void HttpServer::dispatch(HttpExchange& c) {
+    bool pathKnown = false;
+    for (uint8_t i = 0; i < routeCount_; ++i) {
+        if (std::strcmp(routes_[i].path, c.path_) != 0) continue;
+        pathKnown = true;
+        if (routes_[i].method != c.method_) continue;
+        routes_[i].handler(c);
+        if (!c.responded()) c.send(500, "text/plain", "No response");
+        return;
+    }
+    c.send(pathKnown ? 405 : 404, "text/plain", pathKnown ? "Method not allowed" : "Not found");
+}
+
+// Header + copied body, then the static body, then body chunks, at most
+// kSendBudgetBytes per poll; the connection closes once everything is out. A full socket
+// for kWriteStallTimeoutMs means the client stopped reading: the slot goes to someone else.
+void HttpServer::writeResponse(HttpExchange& c, uint32_t nowMs) {
+    size_t budget = kSendBudgetBytes;
+    while (budget) {
+        const char* data;
+        size_t* pos;
+        size_t len;
+        if (c.txPos_ < c.txLen_) {
+            data = c.tx_; pos = &c.txPos_; len = c.txLen_;
+        } else if (c.staticPos_ < c.staticLen_) {
+            data = c.static_; pos = &c.staticPos_; len = c.staticLen_;
+        } else if (c.body_) {
+            const int n = c.body_->read(c.tx_, sizeof(c.tx_), nowMs);
+            if (n == IHttpBody::kDone) { c.endBody(); continue; }
+            if (n == 0) { c.lastActivityMs_ = nowMs; return; } // stream idle, not stalled
+            c.txPos_ = 0;
+            c.txLen_ = static_cast<size_t>(n);
+            continue;
+        } else {
+            drop(c);
+            return;
+        }
+        const size_t want = len - *pos < budget ? len - *pos : budget;
+        const ssize_t sent = ::send(c.fd_, data + *pos, want, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (!httpWouldBlock() || nowMs - c.lastActivityMs_ > kWriteStallTimeoutMs) drop(c);
+            return;
+        }
+        c.lastActivityMs_ = nowMs;
+        *pos += static_cast<size_t>(sent);
+        budget -= static_cast<size_t>(sent);
+    }
+}
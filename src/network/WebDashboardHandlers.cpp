@@ -1,78 +1,42 @@
 #include "network/WebDashboardHandlers.h"
-#include "network/WebDashboardPage.h"
+#include "network/WebAssets.h"
 #include "core/FlightController.h"
-#ifndef NATIVE_BUILD
-#include <Preferences.h>
-#endif
+#include <cstdio>
+#include <cstring>
 
 IPPM* WebDashboardHandlers::ppm_ = nullptr;
 IMotors* WebDashboardHandlers::motors_ = nullptr;
 IBattery* WebDashboardHandlers::battery_ = nullptr;
-IIMU* WebDashboardHandlers::imu_ = nullptr;
+const VehicleStateLock* WebDashboardHandlers::state_ = nullptr;
 
-void WebDashboardHandlers::init(IPPM& ppm, IMotors& motors, IBattery& battery, IIMU& imu) {
-    ppm_ = &ppm; motors_ = &motors; battery_ = &battery; imu_ = &imu;
-#ifndef NATIVE_BUILD
-    if (!logMutex_) logMutex_ = xSemaphoreCreateMutex();
-#endif
-    clearFlightLog();
+void WebDashboardHandlers::init(IPPM& ppm, IMotors& motors, IBattery& battery, const VehicleStateLock& state) {
+    ppm_ = &ppm; motors_ = &motors; battery_ = &battery; state_ = &state;
 }
 
-void WebDashboardHandlers::handleRoot(WebServer& server) {
-    server.send(200, "text/html", kDashboardHTML);
+bool WebDashboardHandlers::transmitterArmed() {
+    return state_->read().rc[FlightController::ARM_CHANNEL] > FlightController::ARM_THRESHOLD;
 }
 
-void WebDashboardHandlers::handleGetPID(WebServer& server) {
-    float r_kp=FlightController::kDefaultRateKp,  r_ki=FlightController::kDefaultRateKi,  r_kd=FlightController::kDefaultRateKd;
-    float p_kp=FlightController::kDefaultRateKp,  p_ki=FlightController::kDefaultRateKi,  p_kd=FlightController::kDefaultRateKd;
-    float y_kp=FlightController::kDefaultYawKp,   y_ki=FlightController::kDefaultYawKi,   y_kd=FlightController::kDefaultYawKd;
-    float ra_kp=FlightController::kDefaultAngleKp, ra_kd=FlightController::kDefaultAngleKd;
-    float pa_kp=FlightController::kDefaultAngleKp, pa_kd=FlightController::kDefaultAngleKd;
-#ifndef NATIVE_BUILD
-    Preferences prefs;
-    prefs.begin("pid", true);
-    r_kp = prefs.getFloat("r_kp", r_kp); r_ki = prefs.getFloat("r_ki", r_ki); r_kd = prefs.getFloat("r_kd", r_kd);
-    p_kp = prefs.getFloat("p_kp", p_kp); p_ki = prefs.getFloat("p_ki", p_ki); p_kd = prefs.getFloat("p_kd", p_kd);
-    y_kp = prefs.getFloat("y_kp", y_kp); y_ki = prefs.getFloat("y_ki", y_ki); y_kd = prefs.getFloat("y_kd", y_kd);
-    ra_kp = prefs.getFloat("ra_kp", ra_kp); ra_kd = prefs.getFloat("ra_kd", ra_kd);
-    pa_kp = prefs.getFloat("pa_kp", pa_kp); pa_kd = prefs.getFloat("pa_kd", pa_kd);
-    prefs.end();
-#endif
-    char buf[256];
-    snprintf(buf, sizeof(buf), "{\"r_kp\":%.3f,\"r_ki\":%.3f,\"r_kd\":%.3f,\"p_kp\":%.3f,\"p_ki\":%.3f,\"p_kd\":%.3f,\"y_kp\":%.3f,\"y_ki\":%.3f,\"y_kd\":%.3f,\"ra_kp\":%.1f,\"ra_kd\":%.1f,\"pa_kp\":%.1f,\"pa_kd\":%.1f}",
-             r_kp, r_ki, r_kd, p_kp, p_ki, p_kd, y_kp, y_ki, y_kd, ra_kp, ra_kd, pa_kp, pa_kd);
-    server.send(200, "application/json", buf);
-}
-
-void WebDashboardHandlers::handleSetPID(WebServer& server) {
-#ifndef NATIVE_BUILD
-    Preferences prefs;
-    prefs.begin("pid", false);
-    const char* keys[] = {"r_kp", "r_ki", "r_kd", "p_kp", "p_ki", "p_kd", "y_kp", "y_ki", "y_kd", "ra_kp", "ra_kd", "pa_kp", "pa_kd"};
-    for (const char* k : keys) {
-        String val = server.arg(k);
-        if (val.length() == 0) continue;
-        float v = val.toFloat();
-        if (v >= 0.0f && v <= 20.0f) prefs.putFloat(k, v); // reject out-of-range gains
+void WebDashboardHandlers::handleAsset(HttpExchange& server) {
+    for (const HttpAsset& asset : kWebAssets) {
+        if (std::strcmp(asset.path, server.path()) == 0) return server.sendAsset(asset);
     }
-    prefs.end();
-#endif
-    server.send(200, "application/json", "{\"status\":\"success\"}");
+    server.send(404, "text/plain", "Not found");
 }
 
-void WebDashboardHandlers::handleGetReceiver(WebServer& server) {
-    if (!ppm_) { server.send(500, "text/plain", "Not initialized"); return; }
+void WebDashboardHandlers::handleGetReceiver(HttpExchange& server) {
+    if (!state_) { server.send(500, "text/plain", "Not initialized"); return; }
+    const VehicleState s = state_->read();
     char buf[128];
     snprintf(buf, sizeof(buf), "{\"channels\":[%d,%d,%d,%d,%d,%d]}",
-             ppm_->getChannel(0), ppm_->getChannel(1), ppm_->getChannel(2),
-             ppm_->getChannel(3), ppm_->getChannel(4), ppm_->getChannel(5));
+             s.rc[0], s.rc[1], s.rc[2], s.rc[3], s.rc[4], s.rc[5]);
     server.send(200, "application/json", buf);
 }
 
-void WebDashboardHandlers::handleSetReceiver(WebServer& server) {
-    if (!ppm_) { server.send(500, "text/plain", "Not initialized"); return; }
+void WebDashboardHandlers::handleSetReceiver(HttpExchange& server) {
+    if (!ppm_ || !state_) { server.send(500, "text/plain", "Not initialized"); return; }
     bool act = server.arg("active") == "true";
-    if (act && ppm_->getChannel(FlightController::ARM_CHANNEL) > FlightController::ARM_THRESHOLD) {
+    if (act && transmitterArmed()) {
         server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Cannot override: Transmitter is ARMED!\"}");
         return;
     }
@@ -85,65 +49,34 @@ void WebDashboardHandlers::handleSetReceiver(WebServer& server) {
     server.send(200, "application/json", "{\"ok\":true}");
 }
 
-void WebDashboardHandlers::handleMotorTest(WebServer& server) {
-    if (!ppm_ || !motors_) { server.send(500, "text/plain", "Not initialized"); return; }
+void WebDashboardHandlers::handleMotorTest(HttpExchange& server) {
+    if (!state_ || !motors_) { server.send(500, "text/plain", "Not initialized"); return; }
     bool act = server.arg("active") == "true";
     int idx = server.arg("motorIdx").toInt();
     int val = server.arg("value").toInt();
     if (val > 1150) val = 1150;
     if (val < 1000) val = 1000;
-    if (act && ppm_->getChannel(FlightController::ARM_CHANNEL) > FlightController::ARM_THRESHOLD) {
+    if (act && transmitterArmed()) {
         server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Cannot override: Transmitter is ARMED!\"}");
         return;
     }
     if (idx == -1) {
-        for (int i = 0; i < 4; i++) motors_->setOverride(i, 1000, false);
-    } else if (idx >= 0 && idx < 4) {
+        for (int i = 0; i < motors_->motorCount(); i++) motors_->setOverride(i, 1000, false);
+    } else if (idx >= 0 && idx < motors_->motorCount()) {
         motors_->setOverride(idx, val, act);
     }
     server.send(200, "application/json", "{\"ok\":true}");
 }
 
-void WebDashboardHandlers::handleCalibrateESC(WebServer& server) {
-    if (!ppm_ || !motors_) { server.send(500, "text/plain", "Not initialized"); return; }
-    
-    // Safety check: only allow calibration if drone is DISARMED
-    if (ppm_->getChannel(FlightController::ARM_CHANNEL) > FlightController::ARM_THRESHOLD) {
-        server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Cannot calibrate: Transmitter is ARMED!\"}");
-        return;
-    }
-    
-    String cmd = server.arg("cmd");
-    if (cmd == "max") {
-        for (int i = 0; i < 4; i++) motors_->setOverride(i, 2000, true);
-    } else if (cmd == "min") {
-        for (int i = 0; i < 4; i++) motors_->setOverride(i, 1000, true);
-    } else if (cmd == "finish") {
-        for (int i = 0; i < 4; i++) motors_->setOverride(i, 1000, false);
-    } else {
-        server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Invalid command\"}");
-        return;
-    }
-    
-    server.send(200, "application/json", "{\"ok\":true}");
-}
-
-void WebDashboardHandlers::handleGetIMU(WebServer& server) {
-    if (!imu_) { server.send(500, "text/plain", "Not initialized"); return; }
-    
-    // We only poll the IMU if we want fresh data, but typically the flight controller loop
-    // already polls it. If the flight task isn't running (e.g. config mode only), we might
-    // need to read it. To be safe and show live data, we call readSensor().
-    imu_->readSensor();
-    
-    float aRoll = 0, aPitch = 0;
-    float gRoll = 0, gPitch = 0, gYaw = 0;
-    
-    imu_->getAccAngles(aRoll, aPitch);
-    imu_->getGyroRates(gRoll, gPitch, gYaw);
+void WebDashboardHandlers::handleGetIMU(HttpExchange& server) {
+    if (!state_) { server.send(500, "text/plain", "Not initialized"); return; }
     
+    // Values from the flight task's last tick; this core never touches the IMU or its bus
+    const VehicleState s = state_->read();
+    float accRoll, accPitch;
+    s.accAnglesDeg(accRoll, accPitch);
     char buf[128];
     snprintf(buf, sizeof(buf), "{\"a_r\":%.1f,\"a_p\":%.1f,\"g_r\":%.1f,\"g_p\":%.1f,\"g_y\":%.1f}",
-             aRoll, aPitch, gRoll, gPitch, gYaw);
+             accRoll, accPitch, s.gyro[0], s.gyro[1], s.gyro[2]);
     server.send(200, "application/json", buf);
 }
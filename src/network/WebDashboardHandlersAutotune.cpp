@@ -0,0 +1,66 @@
+#include "network/WebDashboardHandlers.h"
+#include <cstdio>
+
+RelayAutotune* WebDashboardHandlers::autotune_ = nullptr;
+
+namespace {
+const char* stateName(AutotuneState s) {
+    switch (s) {
+        case AutotuneState::Running: return "running";
+        case AutotuneState::Done:    return "done";
+        case AutotuneState::Failed:  return "failed";
+        default:                     return "idle";
+    }
+}
+}
+
+void WebDashboardHandlers::handleGetAutotune(HttpExchange& server) {
+    if (!autotune_) { server.send(500, "text/plain", "Not initialized"); return; }
+    const AutotuneResult r = autotune_->result();
+    char buf[224];
+    snprintf(buf, sizeof(buf),
+             "{\"state\":\"%s\",\"axis\":%u,\"cycles\":%u,\"ku\":%.3f,\"tu_ms\":%.1f,\"amp\":%.1f,"
+             "\"kp\":%.3f,\"ki\":%.3f,\"kd\":%.4f}",
+             stateName(r.state), r.axis, r.cycles, r.ultimateGain, r.periodS * 1000.0f, r.amplitudeDps,
+             r.kp, r.ki, r.kd);
+    server.send(200, "application/json", buf);
+}
+
+// start needs the quad armed and hovering: the flight task runs the relay in place of
+// the axis's rate PID. apply stages a finished result like POST /api/pid.
+void WebDashboardHandlers::handleAutotune(HttpExchange& server) {
+    if (!autotune_ || !params_ || !state_) { server.send(500, "text/plain", "Not initialized"); return; }
+    const HttpArg cmd = server.arg("cmd");
+    if (cmd == "cancel") {
+        autotune_->cancel();
+    } else if (cmd == "start") {
+        const int axis = server.arg("axis").toInt();
+        if (!transmitterArmed()) {
+            server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Arm and hover first\"}");
+            return;
+        }
+        if (axis < 0 || axis >= RelayAutotune::kAxes) { server.send(400, "text/plain", "Invalid axis"); return; }
+        autotune_->request(static_cast<uint8_t>(axis));
+    } else if (cmd == "apply") {
+        const AutotuneResult r = autotune_->result();
+        if (r.state != AutotuneState::Done) {
+            server.send(200, "application/json", "{\"ok\":false,\"msg\":\"No finished autotune\"}");
+            return;
+        }
+        static_assert(static_cast<int>(ParamId::YawRateKd) == static_cast<int>(ParamId::RollRateKp) + 8,
+                      "rate gains are consecutive kp, ki, kd triples in roll, pitch, yaw order");
+        const uint8_t first = static_cast<uint8_t>(ParamId::RollRateKp) + 3 * r.axis;
+        FlightParams p = params_->read();
+        if (!p.set(static_cast<ParamId>(first), r.kp) || !p.set(static_cast<ParamId>(first + 1), r.ki)
+            || !p.set(static_cast<ParamId>(first + 2), r.kd)) {
+            server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Suggested gains out of range\"}");
+            return;
+        }
+        stageParams(server, p);
+        return;
+    } else {
+        server.send(400, "text/plain", "Invalid command");
+        return;
+    }
+    server.send(200, "application/json", "{\"ok\":true}");
+}
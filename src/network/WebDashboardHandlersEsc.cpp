@@ -0,0 +1,43 @@
+#include "network/WebDashboardHandlers.h"
+#include "core/DShot.h"
+
+// POST /api/calibrate: PWM endpoint calibration (cmd=max|min|finish) or DShot ESC commands
+void WebDashboardHandlers::handleCalibrateESC(HttpExchange& server) {
+    if (!state_ || !motors_) { server.send(500, "text/plain", "Not initialized"); return; }
+    
+    // Safety check: only allow calibration if drone is DISARMED
+    if (transmitterArmed()) {
+        server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Cannot calibrate: Transmitter is ARMED!\"}");
+        return;
+    }
+    
+    const HttpArg cmd = server.arg("cmd");
+    // DShot ESCs have no endpoints to learn (2000 would just spin them up); they take commands
+    if (motors_->isDigital() && (cmd == "max" || cmd == "min")) {
+        server.send(200, "application/json", "{\"ok\":false,\"msg\":\"DShot ESCs need no calibration\"}");
+        return;
+    }
+    const struct { const char* name; DShotCommand command; } kEscCommands[] = {
+        {"beacon", DShotCommand::Beacon1}, {"spin_normal", DShotCommand::SpinDirectionNormal},
+        {"spin_reversed", DShotCommand::SpinDirectionReversed}, {"esc_save", DShotCommand::SaveSettings},
+    };
+    for (const auto& c : kEscCommands) {
+        if (!(cmd == c.name)) continue;
+        const bool sent = motors_->sendCommand(static_cast<uint8_t>(c.command), -1);
+        server.send(200, "application/json", sent ? "{\"ok\":true}"
+                    : "{\"ok\":false,\"msg\":\"ESC commands need DShot and stopped motors\"}");
+        return;
+    }
+    if (cmd == "max") {
+        for (int i = 0; i < motors_->motorCount(); i++) motors_->setOverride(i, 2000, true);
+    } else if (cmd == "min") {
+        for (int i = 0; i < motors_->motorCount(); i++) motors_->setOverride(i, 1000, true);
+    } else if (cmd == "finish") {
+        for (int i = 0; i < motors_->motorCount(); i++) motors_->setOverride(i, 1000, false);
+    } else {
+        server.send(200, "application/json", "{\"ok\":false,\"msg\":\"Invalid command\"}");
+        return;
+    }
+    
+    server.send(200, "application/json", "{\"ok\":true}");
+}
@@ -1,62 +1,66 @@
 #include "network/WebDashboardHandlers.h"
-#include "core/FlightController.h"
+#include "core/BlackboxCsv.h"
 
-FlightLogEntry WebDashboardHandlers::logBuffer_[WebDashboardHandlers::MAX_LOGS];
-int WebDashboardHandlers::logIndex_ = 0;
-int WebDashboardHandlers::logCount_ = 0;
+BlackboxLog* WebDashboardHandlers::blackbox_ = nullptr;
+TelemetryRing* WebDashboardHandlers::telemetry_ = nullptr;
+uint16_t WebDashboardHandlers::blackboxHz_ = 0;
 
-#ifndef NATIVE_BUILD
-SemaphoreHandle_t WebDashboardHandlers::logMutex_ = nullptr;
-#endif
-
-void WebDashboardHandlers::handleGetLog(WebServer& server) {
-    String csv = "time_ms,roll_sp,roll_act,pitch_sp,pitch_act,yaw_sp,yaw_act,throttle,m1,m2,m3,m4,voltage\n";
-#ifndef NATIVE_BUILD
-    if (xSemaphoreTake(logMutex_, pdMS_TO_TICKS(10)) != pdTRUE) {
-        server.send(503, "text/plain", "Log busy");
-        return;
+namespace {
+// Per-connection CSV cursor; its segment copy lives in the connection's body state
+class CsvBody : public IHttpBody {
+public:
+    CsvBody(BlackboxLog& log, uint16_t loopHz, uint32_t step) : stream_(log, loopHz, segment_, step) {}
+    int read(char* out, size_t cap, uint32_t) override {
+        const size_t n = stream_.read(out, cap);
+        return n ? static_cast<int>(n) : kDone;
     }
-#endif
-    int startIdx = logCount_ < MAX_LOGS ? 0 : logIndex_;
-    int count = logCount_;
-    for (int i = 0; i < count; i++) {
-        int idx = (startIdx + i) % MAX_LOGS;
-        const FlightLogEntry& e = logBuffer_[idx];
-        char line[192];
-        snprintf(line, sizeof(line),
-                 "%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%d,%d,%d,%.2f\n",
-                 (unsigned long)e.timeMs,
-                 e.rollSp, e.rollAct, e.pitchSp, e.pitchAct,
-                 e.yawSp, e.yawAct, e.throttle,
-                 e.m1, e.m2, e.m3, e.m4, e.voltage);
-        csv += line;
+
+private:
+    uint8_t segment_[BlackboxLog::kSegmentBytes];
+    BlackboxCsvStream stream_;
+};
+
+// Header, then [u16 length][bytes] per segment copied straight into the send buffer
+class RawBody : public IHttpBody {
+public:
+    RawBody(BlackboxLog& log, uint16_t loopHz) : log_(log), loopHz_(loopHz) {}
+    int read(char* out, size_t cap, uint32_t) override {
+        uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+        size_t n = 0;
+        if (!started_) {
+            started_ = true;
+            seq_ = log_.oldestSegment();
+            last_ = log_.currentSegment();
+            n = writeBlackboxHeader(dst, loopHz_);
+        }
+        while (seq_ != last_ + 1 && cap - n >= 2u + BlackboxLog::kSegmentBytes) {
+            const uint16_t len = log_.copySegment(seq_++, dst + n + 2);
+            if (!len) continue;
+            dst[n] = static_cast<uint8_t>(len);
+            dst[n + 1] = static_cast<uint8_t>(len >> 8);
+            n += 2u + len;
+        }
+        return n ? static_cast<int>(n) : kDone;
     }
-#ifndef NATIVE_BUILD
-    xSemaphoreGive(logMutex_);
-#endif
-    server.send(200, "text/plain", csv);
+
+private:
+    BlackboxLog& log_;
+    uint16_t loopHz_;
+    uint32_t seq_ = 0, last_ = 0;
+    bool started_ = false;
+};
 }
 
-void WebDashboardHandlers::logFlightData(float rSp, float rAct, float pSp, float pAct,
-                                         float ySp, float yAct, int16_t throttle,
-                                         int16_t m1, int16_t m2, int16_t m3, int16_t m4,
-                                         float voltage) {
-    if (!ppm_ || ppm_->getChannel(FlightController::ARM_CHANNEL) <= FlightController::ARM_THRESHOLD) return;
-#ifndef NATIVE_BUILD
-    if (xSemaphoreTake(logMutex_, 0) != pdTRUE) return; // skip if log is being read
-#endif
-    logBuffer_[logIndex_] = {
-        static_cast<uint32_t>(millis()),
-        rSp, rAct, pSp, pAct, ySp, yAct,
-        throttle, m1, m2, m3, m4, voltage
-    };
-    logIndex_ = (logIndex_ + 1) % MAX_LOGS;
-    if (logCount_ < MAX_LOGS) logCount_++;
-#ifndef NATIVE_BUILD
-    xSemaphoreGive(logMutex_);
-#endif
+// CSV straight from the ring, formatted as the socket drains; ?hz=N decimates (default: every frame).
+void WebDashboardHandlers::handleGetLog(HttpExchange& server) {
+    if (!blackbox_) { server.send(500, "text/plain", "Not initialized"); return; }
+    const int hz = server.arg("hz").toInt();
+    const uint32_t step = hz > 0 && hz < blackboxHz_ ? blackboxHz_ / hz : 1;
+    server.stream<CsvBody>(200, "text/csv", *blackbox_, blackboxHz_, step);
 }
 
-void WebDashboardHandlers::clearFlightLog() {
-    logIndex_ = 0; logCount_ = 0;
+// Oldest segment first; decode with tools/blackbox_decode.
+void WebDashboardHandlers::handleGetBlackbox(HttpExchange& server) {
+    if (!blackbox_) { server.send(500, "text/plain", "Not initialized"); return; }
+    server.stream<RawBody>(200, "application/octet-stream", *blackbox_, blackboxHz_);
 }
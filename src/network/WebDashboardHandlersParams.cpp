@@ -0,0 +1,61 @@
+#include "network/WebDashboardHandlers.h"
+#include <cstdio>
+
+FlightParamsLock* WebDashboardHandlers::params_ = nullptr;
+bool WebDashboardHandlers::paramsPending_ = false;
+
+// Every parameter in one object, keyed like the dashboard form
+void WebDashboardHandlers::handleGetPID(HttpExchange& server) {
+    if (!params_) { server.send(500, "text/plain", "Not initialized"); return; }
+    const FlightParams p = params_->read();
+    char buf[384];
+    size_t n = 0;
+    for (size_t i = 0; i < kParamCount; ++i) {
+        n += snprintf(buf + n, sizeof(buf) - n, "%c\"%s\":%.3f", i ? ',' : '{',
+                      FlightParams::spec(static_cast<ParamId>(i)).key, p.values[i]);
+    }
+    snprintf(buf + n, sizeof(buf) - n, "}");
+    server.send(200, "application/json", buf);
+}
+
+// Any subset of keys in one request. All values are range-checked before anything is
+// applied, so a batch lands whole or not at all: one seqlock write, which the flight task
+// swaps in at its next tick. persist=0 tries a set without saving it; otherwise it goes to
+// NVS now, or at disarm if flying (a flash write stalls both cores' cache).
+void WebDashboardHandlers::handleSetPID(HttpExchange& server) {
+    if (!params_) { server.send(500, "text/plain", "Not initialized"); return; }
+    FlightParams p = params_->read();
+    for (size_t i = 0; i < kParamCount; ++i) {
+        const ParamId id = static_cast<ParamId>(i);
+        const HttpArg val = server.arg(FlightParams::spec(id).key);
+        if (val.length() == 0) continue;
+        if (!p.set(id, val.toFloat())) {
+            char buf[96];
+            snprintf(buf, sizeof(buf), "{\"status\":\"out of range\",\"key\":\"%s\",\"min\":%g,\"max\":%g}",
+                     FlightParams::spec(id).key, FlightParams::spec(id).min, FlightParams::spec(id).max);
+            server.send(400, "application/json", buf);
+            return;
+        }
+    }
+    stageParams(server, p);
+}
+
+void WebDashboardHandlers::stageParams(HttpExchange& server, const FlightParams& p) {
+    params_->write(p);
+    paramsPending_ = !(server.arg("persist") == "0");
+    bool saved = false;
+    if (paramsPending_ && !(state_ && transmitterArmed())) {
+        saved = saveParams(p);
+        paramsPending_ = false;
+    }
+    char buf[80];
+    snprintf(buf, sizeof(buf), "{\"status\":\"success\",\"saved\":%s,\"pending\":%s}",
+             saved ? "true" : "false", paramsPending_ ? "true" : "false");
+    server.send(200, "application/json", buf);
+}
+
+void WebDashboardHandlers::commitPendingParams() {
+    if (!paramsPending_ || !params_ || !state_ || transmitterArmed()) return;
+    saveParams(params_->read());
+    paramsPending_ = false;
+}
@@ -0,0 +1,51 @@
+#include "network/WebDashboardHandlers.h"
+#include "core/TelemetryPacket.h"
+#include <cstring>
+
+namespace {
+constexpr int kDefaultStreamHz = 25;
+constexpr int kMaxStreamHz = 100;
+
+// One packed VehicleState per period, base64 in an SSE event (see TelemetryPacket.h).
+// Counts its live instances: the web task is the only one that builds or ends them.
+class TelemetryEventBody : public IHttpBody {
+public:
+    static uint8_t open;
+    TelemetryEventBody(const VehicleStateLock& state, uint32_t periodMs) : state_(state), periodMs_(periodMs) { ++open; }
+    ~TelemetryEventBody() override { --open; }
+    int read(char* out, size_t cap, uint32_t nowMs) override {
+        if (!primed_) {
+            static const char kRetry[] = "retry: 1000\n\n"; // EventSource reconnect delay
+            primed_ = true;
+            lastMs_ = nowMs - periodMs_;
+            std::memcpy(out, kRetry, sizeof(kRetry) - 1);
+            return sizeof(kRetry) - 1;
+        }
+        if (nowMs - lastMs_ < periodMs_) return 0;
+        lastMs_ = nowMs;
+        const VehicleState s = state_.read();
+        if (primedTick_ && s.tick == lastTick_) return 0; // flight task stalled: nothing new
+        primedTick_ = true;
+        lastTick_ = s.tick;
+        return static_cast<int>(formatTelemetryEvent(s, out, cap));
+    }
+
+private:
+    const VehicleStateLock& state_;
+    uint32_t periodMs_;
+    uint32_t lastMs_ = 0, lastTick_ = 0;
+    bool primed_ = false, primedTick_ = false;
+};
+uint8_t TelemetryEventBody::open = 0;
+}
+
+// Never finishes on its own: the connection stays open until the page goes away.
+void WebDashboardHandlers::handleStream(HttpExchange& server) {
+    if (!state_) { server.send(500, "text/plain", "Not initialized"); return; }
+    // Every dashboard tab holds a stream; past the cap they would starve everything else
+    if (TelemetryEventBody::open >= kMaxStreamClients) { server.send(503, "text/plain", "Too many streams"); return; }
+    int hz = server.arg("hz").toInt();
+    if (hz <= 0) hz = kDefaultStreamHz;
+    if (hz > kMaxStreamHz) hz = kMaxStreamHz;
+    server.stream<TelemetryEventBody>(200, "text/event-stream", *state_, 1000u / hz);
+}
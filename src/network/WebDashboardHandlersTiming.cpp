@@ -0,0 +1,30 @@
+#include "network/WebDashboardHandlers.h"
+#include <cstdio>
+
+LoopTimingStats* WebDashboardHandlers::timing_ = nullptr;
+
+void WebDashboardHandlers::handleGetTiming(HttpExchange& server) {
+    if (!timing_) { server.send(500, "text/plain", "Not initialized"); return; }
+
+    // ~80-100 bytes per stage; fixed buffer keeps the web task off the heap
+    char buf[1280];
+    int len = snprintf(buf, sizeof(buf), "{\"stages\":[");
+    for (int i = 0; i < LoopTimingStats::kStageCount && len < static_cast<int>(sizeof(buf)); ++i) {
+        const LoopStage stage = static_cast<LoopStage>(i);
+        const StageTimingSnapshot s = timing_->snapshot(stage);
+        len += snprintf(buf + len, sizeof(buf) - len,
+                        "%s{\"name\":\"%s\",\"n\":%lu,\"min\":%lu,\"max\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu}",
+                        i ? "," : "", LoopTimingStats::stageName(stage),
+                        (unsigned long)s.count, (unsigned long)s.minUs, (unsigned long)s.maxUs,
+                        (unsigned long)s.p50Us, (unsigned long)s.p90Us, (unsigned long)s.p99Us);
+    }
+    if (len < static_cast<int>(sizeof(buf))) {
+        // dropped: frames the flight task found the telemetry ring full for
+        len += snprintf(buf + len, sizeof(buf) - len, "],\"blackbox\":{\"frames\":%lu,\"dropped\":%lu}}",
+                        blackbox_ ? (unsigned long)blackbox_->framesRecorded() : 0UL,
+                        telemetry_ ? (unsigned long)telemetry_->dropped() : 0UL);
+    }
+
+    if (server.arg("reset") == "1") timing_->requestReset();
+    server.send(200, "application/json", buf);
+}
@@ -0,0 +1,19 @@
+#include "network/WebDashboardHandlers.h"
+#include "network/WebAssets.h"
+
+void WebDashboardHandlers::registerRoutes(HttpServer& server) {
+    for (const HttpAsset& asset : kWebAssets) server.on(HttpMethod::Get, asset.path, handleAsset);
+    server.on(HttpMethod::Get,  "/api/pid",       handleGetPID);
+    server.on(HttpMethod::Post, "/api/pid",       handleSetPID);
+    server.on(HttpMethod::Get,  "/api/receiver",  handleGetReceiver);
+    server.on(HttpMethod::Post, "/api/receiver",  handleSetReceiver);
+    server.on(HttpMethod::Post, "/api/motor",     handleMotorTest);
+    server.on(HttpMethod::Post, "/api/calibrate", handleCalibrateESC);
+    server.on(HttpMethod::Get,  "/api/imu",       handleGetIMU);
+    server.on(HttpMethod::Get,  "/api/log",       handleGetLog);
+    server.on(HttpMethod::Get,  "/api/blackbox",  handleGetBlackbox);
+    server.on(HttpMethod::Get,  "/api/timing",    handleGetTiming);
+    server.on(HttpMethod::Get,  "/api/stream",    handleStream);
+    server.on(HttpMethod::Get,  "/api/autotune",  handleGetAutotune);
+    server.on(HttpMethod::Post, "/api/autotune",  handleAutotune);
+}
@@ -2,35 +2,23 @@
 #include "network/WebDashboardHandlers.h"
 
 #ifndef NATIVE_BUILD
-WebDashboardServer::WebDashboardServer() : server_(80) {}
+#include <Arduino.h>
+#include <WiFi.h>
 
-void WebDashboardServer::registerRoutes() {
-    server_.on("/", HTTP_GET, [this]() { WebDashboardHandlers::handleRoot(this->server_); });
-    server_.on("/api/pid", HTTP_GET, [this]() { WebDashboardHandlers::handleGetPID(this->server_); });
-    server_.on("/api/pid", HTTP_POST, [this]() { WebDashboardHandlers::handleSetPID(this->server_); });
-    server_.on("/api/receiver", HTTP_GET, [this]() { WebDashboardHandlers::handleGetReceiver(this->server_); });
-    server_.on("/api/receiver", HTTP_POST, [this]() { WebDashboardHandlers::handleSetReceiver(this->server_); });
-    server_.on("/api/motor", HTTP_POST, [this]() { WebDashboardHandlers::handleMotorTest(this->server_); });
-    server_.on("/api/calibrate", HTTP_POST, [this]() { WebDashboardHandlers::handleCalibrateESC(this->server_); });
-    server_.on("/api/imu", HTTP_GET, [this]() { WebDashboardHandlers::handleGetIMU(this->server_); });
-    server_.on("/api/log", HTTP_GET, [this]() { WebDashboardHandlers::handleGetLog(this->server_); });
-    routesRegistered_ = true;
+WebDashboardServer::WebDashboardServer() {
+    WebDashboardHandlers::registerRoutes(server_);
 }
 
 void WebDashboardServer::begin() {
     if (isRunning_) return;
     WiFi.softAP("ESP32_Drone_Config", "12345678");
-    delay(100);
-    if (!routesRegistered_) registerRoutes();
-    server_.begin();
+    if (!server_.begin(kPort)) return; // retried on the next call
     isRunning_ = true;
     Serial.println("Web Dashboard server started (SoftAP: ESP32_Drone_Config)");
 }
 
 void WebDashboardServer::handleClient() {
-    if (isRunning_) {
-        server_.handleClient();
-    }
+    if (isRunning_) server_.poll(millis());
 }
 
 void WebDashboardServer::stop() {
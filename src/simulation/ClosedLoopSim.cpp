@@ -0,0 +1,93 @@
+#include "simulation/ClosedLoopSim.h"
+#include <chrono>
+#include <cmath>
+
+namespace {
+constexpr float kRadToDeg = 57.2957795f;
+
+// Host wall clock so LoopTimingStats reports real update() cost on the build machine
+uint32_t hostMicros() {
+    using namespace std::chrono;
+    return static_cast<uint32_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+ClosedLoopSim::ClosedLoopSim(const ClosedLoopSimConfig& config)
+    : config_(config), motors_(mixerTable(config.quad.frame).motors), plant_(config.quad), noise_(config.seed),
+      fc_(imu_, ppm_, motors_, battery_) {
+    substeps_ = static_cast<int>(config.physicsHz / config.rates.gyroHz + 0.5f);
+    if (substeps_ < 1) substeps_ = 1;
+    controlDt_ = config.rates.gyroDt();
+    physicsDt_ = controlDt_ / static_cast<float>(substeps_);
+
+    ppm_.setOverrideActive(true);
+    imu_.setOverrideActive(true);
+    // Calibrate on a still, noise-free frame so only the configured bias is learned
+    publishSensors(false);
+    fc_.setLoopRates(config.rates);
+    fc_.setFrame(config.quad.frame); // the plant's motor layout
+    if (config.compass) fc_.setCompass(&compass_);
+    fc_.init();
+    fc_.setTimingClock(&hostMicros);
+}
+
+void ClosedLoopSim::arm() {
+    setStick(2, 1000);
+    setStick(FlightController::ARM_CHANNEL, 2000);
+    stepControl();
+}
+
+void ClosedLoopSim::disarm() {
+    setStick(FlightController::ARM_CHANNEL, 1000);
+    stepControl();
+}
+
+void ClosedLoopSim::stepControl() {
+    fc_.update(controlDt_);
+    int cmd[QuadPhysics::kMaxMotors];
+    for (int i = 0; i < plant_.motorCount(); ++i) cmd[i] = motors_.getMotorOutput(i);
+    plant_.setPackVoltage(battery_.readVoltage()); // override it to fly a sagging pack
+    for (int s = 0; s < substeps_; ++s) plant_.step(physicsDt_, cmd);
+    time_ += controlDt_;
+    publishSensors(true);
+    if (config_.rpmTelemetry) publishRpmTelemetry();
+    if (++analysisTicks_ >= config_.notchAnalysisDivider) {
+        analysisTicks_ = 0;
+        fc_.gyroFilters().dynamicNotch().analyse();
+    }
+}
+
+void ClosedLoopSim::run(float seconds) {
+    const int ticks = static_cast<int>(seconds / controlDt_ + 0.5f);
+    for (int i = 0; i < ticks; ++i) stepControl();
+}
+
+void ClosedLoopSim::publishSensors(bool withNoise) {
+    const SensorNoiseParams& n = config_.noise;
+    float gyro[3], acc[3];
+    plant_.getBodyRatesDeg(gyro[0], gyro[1], gyro[2]);
+    plant_.getSpecificForceG(acc[0], acc[1], acc[2]);
+
+    float ripple = 0.0f;
+    for (int i = 0; i < plant_.motorCount(); ++i) {
+        const float phase = plant_.getRotorPhase(i);
+        ripple += plant_.getMotorThrustN(i) * (std::sin(phase) + n.vibrationHarmonics[0] * std::sin(2.0f * phase)
+                                               + n.vibrationHarmonics[1] * std::sin(3.0f * phase));
+    }
+    for (int i = 0; i < 3; ++i) {
+        gyro[i] += n.gyroBiasDegS[i];
+        if (!withNoise) continue;
+        gyro[i] += n.gyroNoiseDegS * noise_.gaussian() + n.vibrationDegSPerN * ripple;
+        acc[i]  += n.accelNoiseG * noise_.gaussian() + n.vibrationGPerN * ripple;
+    }
+
+    // Same accelerometer angle formulas as MPU6500IMU::readSensor()
+    const float accRoll  =  std::atan2(acc[1], std::sqrt(acc[0] * acc[0] + acc[2] * acc[2])) * kRadToDeg;
+    const float accPitch = -std::atan2(acc[0], std::sqrt(acc[1] * acc[1] + acc[2] * acc[2])) * kRadToDeg;
+    imu_.setOverride(gyro[0], gyro[1], gyro[2], accRoll, accPitch);
+    imu_.setAccelOverride(acc[0], acc[1], acc[2]);
+
+    float mag[3];
+    plant_.rotateToBody(config_.magFieldWorld, mag);
+    compass_.setOverride(mag[0], mag[1], mag[2]);
+}
@@ -0,0 +1,17 @@
+#include "simulation/ClosedLoopSim.h"
+#include "core/DShotTelemetry.h"
+
+// Each rotor speed makes the round trip an ESC reply would: eRPM period → GCR line → edge
+// times → DShotTelemetry::decode(), so the FC's RPM filter runs on decoded values.
+void ClosedLoopSim::publishRpmTelemetry() {
+    const float ticksPerBit = DShotTelemetry::ticksPerBit(DShotRate::DShot600);
+    float rpm[QuadPhysics::kMaxMotors];
+    for (int i = 0; i < plant_.motorCount(); ++i) {
+        const uint32_t sent = DShotTelemetry::periodFromRpm(plant_.getRotorHz(i) * 60.0f, config_.motorPoles);
+        uint32_t edges[DShotTelemetry::kMaxEdges], period = 0;
+        const uint8_t n = DShotTelemetry::edgesFromLine(DShotTelemetry::encodeLine(sent), ticksPerBit, edges);
+        const bool ok = DShotTelemetry::decode(edges, n, ticksPerBit, period);
+        rpm[i] = ok ? DShotTelemetry::rpmFromPeriod(period, config_.motorPoles) : 0.0f;
+    }
+    motors_.setMotorRpm(rpm);
+}
@@ -0,0 +1,86 @@
+#include "simulation/QuadPhysics.h"
+#include <cmath>
+
+namespace {
+constexpr float kTwoPi    = 6.28318531f;
+} // namespace
+
+QuadPhysics::QuadPhysics(const QuadPhysicsParams& params)
+    : params_(params), packVoltage_(params.nominalVoltage) { reset(); }
+
+void QuadPhysics::reset() {
+    q_[0] = 1.0f; q_[1] = q_[2] = q_[3] = 0.0f;
+    for (int i = 0; i < 3; ++i) { rates_[i] = pos_[i] = vel_[i] = forceBody_[i] = 0.0f; }
+    forceBody_[2] = params_.massKg * kGravity; // resting on the ground
+    for (int i = 0; i < kMaxMotors; ++i) { thrust_[i] = 0.0f; rotorPhase_[i] = 0.0f; }
+    grounded_ = true;
+}
+
+float QuadPhysics::thrustForCommand(int us) const {
+    float u = (us - 1000) * 0.001f;
+    u = u < 0.0f ? 0.0f : (u > 1.0f ? 1.0f : u);
+    const float v = packVoltage_ / params_.nominalVoltage; // rotor speed ∝ duty × voltage
+    return params_.maxThrustN * v * v * ((1.0f - params_.thrustExpo) * u + params_.thrustExpo * u * u);
+}
+
+float QuadPhysics::getRotorHz(int idx) const {
+    // Thrust scales with rotor speed squared; motorMaxHz is full command on a nominal pack
+    return params_.motorMaxHz * std::sqrt(thrust_[idx] / params_.maxThrustN);
+}
+
+void QuadPhysics::step(float dt, const int* motorUs) {
+    // Per-motor contribution to roll/pitch/yaw is the mixer row for this frame
+    const MixerTable& mix = mixerTable(params_.frame);
+    float k = dt / params_.motorTauS;
+    if (k > 1.0f) k = 1.0f;
+    float total = 0.0f, torque[3] = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < mix.motors; ++i) {
+        thrust_[i] += (thrustForCommand(motorUs[i]) - thrust_[i]) * k;
+        rotorPhase_[i] = std::fmod(rotorPhase_[i] + kTwoPi * getRotorHz(i) * dt, kTwoPi);
+        total     += thrust_[i];
+        torque[0] += mix.rows[i].roll  * params_.armLengthM * thrust_[i];
+        torque[1] += mix.rows[i].pitch * params_.armLengthM * thrust_[i];
+        torque[2] += mix.rows[i].yaw   * params_.yawTorquePerN * thrust_[i];
+    }
+
+    const float thrustBody[3] = {0.0f, 0.0f, total};
+    float force[3];
+    rotateToWorld(thrustBody, force);
+    for (int i = 0; i < 3; ++i) force[i] -= params_.linearDrag * vel_[i];
+
+    grounded_ = pos_[2] <= 0.0f && force[2] <= params_.massKg * kGravity;
+    if (grounded_) {
+        // Ground reaction cancels weight and holds the frame still
+        for (int i = 0; i < 3; ++i) { vel_[i] = 0.0f; rates_[i] = 0.0f; }
+        pos_[2] = 0.0f;
+        const float weight[3] = {0.0f, 0.0f, params_.massKg * kGravity};
+        rotateToBody(weight, forceBody_);
+        return;
+    }
+    rotateToBody(force, forceBody_);
+    force[2] -= params_.massKg * kGravity;
+    for (int i = 0; i < 3; ++i) {
+        vel_[i] += force[i] / params_.massKg * dt;
+        pos_[i] += vel_[i] * dt;
+    }
+
+    // Euler's rotation equations: I·ω̇ = τ − ω × (I·ω) − drag·ω
+    const float* J = params_.inertia;
+    const float h[3] = {J[0] * rates_[0], J[1] * rates_[1], J[2] * rates_[2]};
+    const float gyro[3] = {rates_[1] * h[2] - rates_[2] * h[1],
+                           rates_[2] * h[0] - rates_[0] * h[2],
+                           rates_[0] * h[1] - rates_[1] * h[0]};
+    for (int i = 0; i < 3; ++i) {
+        rates_[i] += (torque[i] - gyro[i] - params_.angularDrag * rates_[i]) / J[i] * dt;
+    }
+
+    // q̇ = ½ q ⊗ (0, ω)
+    const float w = q_[0], x = q_[1], y = q_[2], z = q_[3];
+    const float p = rates_[0] * 0.5f * dt, r = rates_[1] * 0.5f * dt, s = rates_[2] * 0.5f * dt;
+    q_[0] += -x * p - y * r - z * s;
+    q_[1] +=  w * p + y * s - z * r;
+    q_[2] +=  w * r - x * s + z * p;
+    q_[3] +=  w * s + x * r - y * p;
+    float n = 1.0f / std::sqrt(q_[0] * q_[0] + q_[1] * q_[1] + q_[2] * q_[2] + q_[3] * q_[3]);
+    for (int i = 0; i < 4; ++i) q_[i] *= n;
+}
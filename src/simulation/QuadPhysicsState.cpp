@@ -0,0 +1,54 @@
+#include "simulation/QuadPhysics.h"
+#include <cmath>
+
+namespace {
+constexpr float kDegToRad = 0.0174532925f;
+constexpr float kRadToDeg = 57.2957795f;
+constexpr float kGravity  = 9.80665f;
+} // namespace
+
+void QuadPhysics::getEulerDeg(float& roll, float& pitch, float& yaw) const {
+    const float w = q_[0], x = q_[1], y = q_[2], z = q_[3];
+    float sinPitch = 2.0f * (w * y - z * x);
+    sinPitch = sinPitch > 1.0f ? 1.0f : (sinPitch < -1.0f ? -1.0f : sinPitch);
+    roll  = std::atan2(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y)) * kRadToDeg;
+    pitch = std::asin(sinPitch) * kRadToDeg;
+    yaw   = std::atan2(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z)) * kRadToDeg;
+}
+
+void QuadPhysics::getBodyRatesDeg(float& roll, float& pitch, float& yaw) const {
+    roll = rates_[0] * kRadToDeg; pitch = rates_[1] * kRadToDeg; yaw = rates_[2] * kRadToDeg;
+}
+
+void QuadPhysics::getSpecificForceG(float& x, float& y, float& z) const {
+    const float scale = 1.0f / (params_.massKg * kGravity);
+    x = forceBody_[0] * scale; y = forceBody_[1] * scale; z = forceBody_[2] * scale;
+}
+
+void QuadPhysics::setAttitudeDeg(float roll, float pitch, float yaw) {
+    const float cr = std::cos(roll * kDegToRad * 0.5f),  sr = std::sin(roll * kDegToRad * 0.5f);
+    const float cp = std::cos(pitch * kDegToRad * 0.5f), sp = std::sin(pitch * kDegToRad * 0.5f);
+    const float cy = std::cos(yaw * kDegToRad * 0.5f),   sy = std::sin(yaw * kDegToRad * 0.5f);
+    q_[0] = cr * cp * cy + sr * sp * sy;
+    q_[1] = sr * cp * cy - cr * sp * sy;
+    q_[2] = cr * sp * cy + sr * cp * sy;
+    q_[3] = cr * cp * sy - sr * sp * cy;
+}
+
+void QuadPhysics::setBodyRatesDeg(float roll, float pitch, float yaw) {
+    rates_[0] = roll * kDegToRad; rates_[1] = pitch * kDegToRad; rates_[2] = yaw * kDegToRad;
+}
+
+void QuadPhysics::rotateToWorld(const float b[3], float w[3]) const {
+    const float qw = q_[0], x = q_[1], y = q_[2], z = q_[3];
+    w[0] = (1 - 2 * (y * y + z * z)) * b[0] + 2 * (x * y - qw * z) * b[1] + 2 * (x * z + qw * y) * b[2];
+    w[1] = 2 * (x * y + qw * z) * b[0] + (1 - 2 * (x * x + z * z)) * b[1] + 2 * (y * z - qw * x) * b[2];
+    w[2] = 2 * (x * z - qw * y) * b[0] + 2 * (y * z + qw * x) * b[1] + (1 - 2 * (x * x + y * y)) * b[2];
+}
+
+void QuadPhysics::rotateToBody(const float w[3], float b[3]) const {
+    const float qw = q_[0], x = q_[1], y = q_[2], z = q_[3];
+    b[0] = (1 - 2 * (y * y + z * z)) * w[0] + 2 * (x * y + qw * z) * w[1] + 2 * (x * z - qw * y) * w[2];
+    b[1] = 2 * (x * y - qw * z) * w[0] + (1 - 2 * (x * x + z * z)) * w[1] + 2 * (y * z + qw * x) * w[2];
+    b[2] = 2 * (x * z + qw * y) * w[0] + 2 * (y * z - qw * x) * w[1] + (1 - 2 * (x * x + y * y)) * w[2];
+}
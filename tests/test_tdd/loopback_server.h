@@ -0,0 +1,99 @@
+#ifndef LOOPBACK_SERVER_H
+#define LOOPBACK_SERVER_H
+
+// Shared by the test_http_*.cpp loopback tests: the real route table on a local socket
+#include "doctest.h"
+#include "network/WebDashboardHandlers.h"
+#include "network/HttpSocket.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+// The dashboard route table on an ephemeral port, polled from its own thread like the
+// web task. skewMs pushes the server's clock forward to exercise request timeouts.
+class LoopbackServer {
+public:
+    LoopbackServer() {
+        WebDashboardHandlers::registerRoutes(server_);
+        ok_ = server_.begin(0);
+        thread_ = std::thread([this] {
+            while (!stop_.load()) {
+                server_.poll(nowMs() + skewMs.load());
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+        });
+    }
+    ~LoopbackServer() {
+        stop_.store(true);
+        thread_.join();
+        server_.stop();
+    }
+    bool ok() const { return ok_; }
+    uint16_t port() const { return server_.port(); }
+    std::atomic<uint32_t> skewMs{0};
+
+private:
+    static uint32_t nowMs() {
+        using namespace std::chrono;
+        return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+    HttpServer server_;
+    bool ok_ = false;
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
+
+// rcvBufBytes > 0 shrinks the receive window, so a client that never reads stalls the sender
+inline int connectTo(uint16_t port, int rcvBufBytes = 0) {
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    timeval tv{2, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (rcvBufBytes > 0) setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvBufBytes, sizeof(rcvBufBytes));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    REQUIRE_EQ(connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    return fd;
+}
+
+inline void sendText(int fd, const std::string& text) {
+    REQUIRE_EQ(::send(fd, text.data(), text.size(), MSG_NOSIGNAL), static_cast<ssize_t>(text.size()));
+}
+
+// Until the server closes (or the 2 s receive timeout)
+inline std::string readToEnd(int fd) {
+    std::string out;
+    char buf[4096];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) out.append(buf, static_cast<size_t>(n));
+    return out;
+}
+
+inline std::string roundTrip(uint16_t port, const std::string& raw) {
+    const int fd = connectTo(port);
+    sendText(fd, raw);
+    std::string response = readToEnd(fd);
+    close(fd);
+    return response;
+}
+
+inline std::string get(uint16_t port, const std::string& path) {
+    return roundTrip(port, "GET " + path + " HTTP/1.1\r\nHost: drone\r\n\r\n");
+}
+
+inline std::string post(uint16_t port, const std::string& path, const std::string& form) {
+    return roundTrip(port, "POST " + path + " HTTP/1.1\r\nContent-Type: application/x-www-form-urlencoded\r\n"
+                           "Content-Length: " + std::to_string(form.size()) + "\r\n\r\n" + form);
+}
+
+inline int statusOf(const std::string& response) { return response.size() > 12 ? std::atoi(response.c_str() + 9) : 0; }
+
+inline std::string bodyOf(const std::string& response) {
+    const size_t split = response.find("\r\n\r\n");
+    return split == std::string::npos ? "" : response.substr(split + 4);
+}
+
+#endif // LOOPBACK_SERVER_H
@@ -0,0 +1,99 @@
+#include "doctest.h"
+#include "core/FlightController.h"
+#include "core/MotorMixer.h"
+#include "simulation/SimulatedHardware.h"
+#include <cmath>
+
+namespace {
+using K = FlightControlConstants;
+
+// Bench rig: gyro and sticks pinned, angle loop off so the rate PIDs chase a zero setpoint
+struct Rig {
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors motors;
+    SimulatedBatteryMonitor battery;
+    FlightController fc{imu, ppm, motors, battery};
+
+    explicit Rig(FlightParams p) {
+        p.set(ParamId::RollAngleKp, 0.0f);
+        p.set(ParamId::PitchAngleKp, 0.0f);
+        fc.params().write(p);
+        imu.setOverrideActive(true);
+        ppm.setOverride(K::THROTTLE_CHANNEL, 1000);
+        ppm.setOverride(K::ARM_CHANNEL, 1600);
+        ppm.setOverrideActive(true);
+        fc.update(0.004f); // arms at idle throttle
+    }
+    void ticks(int n, float rollRate, int throttle, float pitchRate = 0.0f) {
+        imu.setOverride(rollRate, pitchRate, 0.0f, 0.0f, 0.0f);
+        ppm.setOverride(K::THROTTLE_CHANNEL, throttle);
+        for (int i = 0; i < n; ++i) fc.update(0.004f);
+    }
+    int rollSplit() { return motors.getMotorOutput(2) - motors.getMotorOutput(0); } // +roll side minus -roll side
+};
+
+// Rate loop with stuck roll and pitch errors, then clean hover ticks: whatever roll
+// correction is left with zero error and a settled D is the wound-up I-term.
+int residualAfterSaturation(float antiWindup) {
+    FlightParams p;
+    p.set(ParamId::RollRateKp, 2.0f);
+    p.set(ParamId::RollRateKi, 5.0f);
+    p.set(ParamId::PitchRateKi, 5.0f);
+    p.set(ParamId::AntiWindup, antiWindup);
+    Rig rig(p);
+    rig.ticks(250, -150.0f, 1500, -150.0f); // motor 3 would need ±600 µs of the ±410 there is
+    rig.ticks(1, 0.0f, 1500);      // D kicks on the step
+    rig.ticks(10, 0.0f, 1500);
+    return rig.rollSplit();
+}
+}
+
+TEST_CASE("Mixer reports the share of each axis the outputs carry") {
+    MotorMixer mixer;
+    MixerFeedback fb;
+    int m[MotorMixer::kMaxMotors];
+    mixer.mix(1500.0f, 100.0f, -50.0f, 20.0f, m, &fb);
+    CHECK_FALSE(fb.saturated);
+    CHECK_EQ(fb.applied[0], 100.0f);
+    CHECK_EQ(fb.applied[1], -50.0f);
+
+    mixer.mix(1500.0f, 300.0f, 150.0f, 0.0f, m, &fb); // 2 × 461 µs spread > 2000 − 1180
+    CHECK(fb.saturated);
+    CHECK_GT(fb.applied[0], 150.0f);
+    CHECK_LT(fb.applied[0], 300.0f);
+    CHECK_GT(fb.applied[1], 0.0f);
+    CHECK_LT(fb.applied[1], 150.0f);
+}
+
+TEST_CASE("Back-calculation keeps the I-term from winding up in saturation") {
+    const int wound = residualAfterSaturation(0.0f);
+    const int bled = residualAfterSaturation(K::kDefaultAntiWindup);
+    CHECK_GT(wound, 100);
+    CHECK_LT(bled, wound / 2);
+    CHECK_GE(bled, 0); // bled toward zero, never past it
+}
+
+TEST_CASE("Airmode keeps PID authority at zero throttle once it has latched") {
+    FlightParams p;
+    SUBCASE("off: idle throttle cuts the motors") {
+        Rig rig(p);
+        rig.ticks(20, 50.0f, 1000);
+        for (int i = 0; i < 4; ++i) CHECK_EQ(rig.motors.getMotorOutput(i), K::MOTOR_OFF_US);
+    }
+    SUBCASE("on: idle until the first throttle-up, then full authority down to zero throttle") {
+        p.set(ParamId::Airmode, 1.0f);
+        Rig rig(p);
+        rig.ticks(20, 50.0f, 1000); // not latched yet: still safe on the pad
+        for (int i = 0; i < 4; ++i) CHECK_EQ(rig.motors.getMotorOutput(i), K::MOTOR_OFF_US);
+        rig.ticks(5, 0.0f, 1400);
+        rig.ticks(20, 50.0f, 1000);
+        CHECK_LT(rig.rollSplit(), -40); // rolling right at zero throttle: the left side pushes back
+        for (int i = 0; i < 4; ++i) CHECK_GE(rig.motors.getMotorOutput(i), K::MOTOR_MIN_ARMED_US);
+        rig.ppm.setOverride(K::ARM_CHANNEL, 1000);
+        rig.fc.update(0.004f); // disarm clears the latch
+        rig.ppm.setOverride(K::ARM_CHANNEL, 1600);
+        rig.ticks(20, 50.0f, 1000);
+        for (int i = 0; i < 4; ++i) CHECK_EQ(rig.motors.getMotorOutput(i), K::MOTOR_OFF_US);
+    }
+}
@@ -0,0 +1,129 @@
+#include "doctest.h"
+#include "core/RelayAutotune.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+#include <deque>
+
+namespace {
+// Rate axis as a pure integrator with transport delay: rate' = k·u(t − delay).
+// Under an ideal relay ±d it cycles with Tu = 4·delay and amplitude k·d·delay.
+struct DelayedIntegrator {
+    float k, rate = 0.0f;
+    std::deque<float> pipe;
+    DelayedIntegrator(float gain, float delayS, float dt) : k(gain), pipe(static_cast<size_t>(delayS / dt), 0.0f) {}
+    float step(float u, float dt) {
+        pipe.push_back(u);
+        rate += k * pipe.front() * dt;
+        pipe.pop_front();
+        return rate;
+    }
+};
+
+AutotuneResult runRelay(RelayAutotune& tune, DelayedIntegrator& plant, float dt, float seconds) {
+    float rate = 0.0f;
+    for (float t = 0.0f; t < seconds && (t == 0.0f || tune.running()); t += dt) {
+        tune.poll();
+        const float error[3] = {0.0f, -rate, 0.0f}; // hold zero pitch rate
+        float out[3] = {0.0f, 0.0f, 0.0f};
+        tune.step(error, out, dt);
+        rate = plant.step(out[1], dt);
+    }
+    return tune.result();
+}
+}
+
+TEST_CASE("Relay autotune recovers Ku and Tu of a known plant") {
+    const float dt = 0.0005f, k = 50.0f, delay = 0.01f;
+    RelayAutotuneConfig config;
+    config.hysteresisDps = 1.0f;
+    RelayAutotune tune;
+    tune.setConfig(config);
+    CHECK(tune.result().state == AutotuneState::Idle);
+
+    DelayedIntegrator plant(k, delay, dt);
+    plant.rate = 5.0f; // something for the relay to act on
+    tune.request(1);
+    const AutotuneResult r = runRelay(tune, plant, dt, 3.0f);
+    REQUIRE(r.state == AutotuneState::Done);
+    CHECK_EQ(r.axis, 1);
+    CHECK_EQ(r.cycles, config.settleCycles + config.measureCycles);
+    // Hysteresis adds 2ε/(k·d) per switch on top of the ideal 4·delay
+    CHECK_EQ(r.periodS, doctest::Approx(4.0f * delay + 4.0f * config.hysteresisDps / (k * config.relayUs)).epsilon(0.05));
+    CHECK_EQ(r.ultimateGain, doctest::Approx(4.0f / (3.14159265f * k * delay)).epsilon(0.08));
+    CHECK_EQ(r.kp, doctest::Approx(0.2f * r.ultimateGain));
+    CHECK_EQ(r.ki, doctest::Approx(0.4f * r.ultimateGain / r.periodS));
+    CHECK_EQ(r.kd, doctest::Approx(0.066f * r.ultimateGain * r.periodS));
+    CHECK_FALSE(tune.running());
+
+    SUBCASE("Cancel, timeout and runaway all end in Failed") {
+        DelayedIntegrator p2(k, delay, dt);
+        p2.rate = 5.0f;
+        tune.request(1);
+        tune.poll();
+        REQUIRE(tune.running());
+        tune.cancel();
+        CHECK(runRelay(tune, p2, dt, 0.1f).state == AutotuneState::Failed);
+
+        RelayAutotuneConfig shortConfig = config;
+        shortConfig.timeoutS = 0.05f;
+        tune.setConfig(shortConfig);
+        tune.request(1);
+        CHECK(runRelay(tune, p2, dt, 1.0f).state == AutotuneState::Failed);
+
+        RelayAutotuneConfig wild = config;
+        wild.relayUs = 2000.0f; // cycles beyond abortRateDps
+        tune.setConfig(wild);
+        tune.request(1);
+        const AutotuneResult runaway = runRelay(tune, p2, dt, 1.0f);
+        CHECK(runaway.state == AutotuneState::Failed);
+        CHECK_LT(runaway.cycles, config.settleCycles + config.measureCycles);
+    }
+}
+
+TEST_CASE("Relay autotune in the closed-loop sim suggests gains that fly") {
+    ClosedLoopSim sim;
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.run(1.5f);
+    FlightController& fc = sim.controller();
+
+    fc.autotune().request(0);
+    float worstBank = 0.0f;
+    for (int i = 0; i < 3000 && fc.autotune().result().state != AutotuneState::Done
+                    && fc.autotune().result().state != AutotuneState::Failed; ++i) {
+        sim.stepControl();
+        float r, p, y;
+        sim.plant().getEulerDeg(r, p, y);
+        worstBank = std::fmax(worstBank, std::fabs(r));
+    }
+    const AutotuneResult r = fc.autotune().result();
+    REQUIRE(r.state == AutotuneState::Done);
+    CHECK_LT(worstBank, 20.0f); // the relay test itself stays a gentle wobble
+    CHECK_GT(r.periodS, 0.05f); // the sim's roll-rate loop cycles at ~9 Hz
+    CHECK_LT(r.periodS, 0.3f);
+    CHECK_GT(r.kp, 0.0f);
+    CHECK_GT(r.ki, 0.0f);
+    CHECK_GT(r.kd, 0.0f);
+    CHECK_LT(r.kp, FlightParams::spec(ParamId::RollRateKp).max);
+
+    // Stage the suggestion exactly as the dashboard does and fly a disturbance on it
+    FlightParams p = fc.params().read();
+    REQUIRE(p.set(ParamId::RollRateKp, r.kp));
+    REQUIRE(p.set(ParamId::RollRateKi, r.ki));
+    REQUIRE(p.set(ParamId::RollRateKd, r.kd));
+    fc.params().write(p);
+    sim.run(1.0f);
+    sim.plant().setBodyRatesDeg(200.0f, 0.0f, 0.0f);
+    sim.run(0.5f);
+    float rr, pr, yr;
+    sim.plant().getBodyRatesDeg(rr, pr, yr);
+    CHECK_LT(std::fabs(rr), 20.0f);
+    float peak = 0.0f; // no sustained oscillation left over on the tuned axis
+    for (int i = 0; i < 250; ++i) {
+        sim.stepControl();
+        sim.plant().getBodyRatesDeg(rr, pr, yr);
+        peak = std::fmax(peak, std::fabs(rr));
+    }
+    CHECK_LT(peak, 20.0f);
+    CHECK_GT(sim.plant().getAltitudeM(), 0.5f);
+}
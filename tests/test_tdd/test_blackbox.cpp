@@ -0,0 +1,230 @@
+#include "doctest.h"
+#include "core/BlackboxLog.h"
+#include "core/BlackboxCsv.h"
+#include "core/FlightTelemetry.h"
+#include "simulation/ClosedLoopSim.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <thread>
+
+namespace {
+BlackboxFrame syntheticFrame(uint32_t loop) {
+    BlackboxFrame f;
+    f[BlackboxField::Iteration] = static_cast<int32_t>(loop);
+    for (uint8_t i = 1; i < kBlackboxFieldCount; ++i) {
+        f.v[i] = static_cast<int32_t>((loop * 37u + i * 101u) % 200u) - 100 + i * 1000;
+    }
+    return f;
+}
+
+// Decodes one copied segment; returns frames read, -1 if bytes were left over.
+int decodeSegment(const uint8_t* data, uint16_t len, BlackboxFrame* last = nullptr) {
+    BlackboxDecoder decoder;
+    BlackboxFrame f;
+    size_t pos = 0, used;
+    int frames = 0;
+    while ((used = decoder.decode(data + pos, len - pos, f)) != 0) { pos += used; ++frames; }
+    if (last && frames) *last = f;
+    return pos == len ? frames : -1;
+}
+}
+
+TEST_CASE("Blackbox zig-zag varints round trip at the extremes") {
+    const int32_t values[] = {0, 1, -1, 63, -64, 64, 8191, -8192, INT32_MAX, INT32_MIN};
+    for (int32_t v : values) {
+        uint8_t buf[5];
+        const size_t n = writeVarint(zigzagEncode(v), buf);
+        uint32_t u;
+        CHECK_EQ(readVarint(buf, n, u), n);
+        CHECK_EQ(zigzagDecode(u), v);
+    }
+    uint8_t buf[5];
+    CHECK_EQ(writeVarint(zigzagEncode(-64), buf), 1u);   // small residuals cost one byte
+    CHECK_EQ(writeVarint(zigzagEncode(INT32_MIN), buf), 5u);
+    uint32_t u;
+    CHECK_EQ(readVarint(buf, 4, u), 0u); // truncated
+}
+
+TEST_CASE("Blackbox codec reproduces every field and needs a keyframe to start") {
+    BlackboxEncoder enc;
+    BlackboxDecoder dec;
+    uint8_t buf[kBlackboxMaxFrameBytes];
+    for (uint32_t loop = 1; loop < 500; ++loop) {
+        BlackboxFrame in = syntheticFrame(loop), out;
+        if (loop == 250) in[BlackboxField::Motor1] = INT32_MIN; // residual wraps, still exact
+        if (loop % 100 == 0) enc.restart();
+        const size_t n = enc.encode(in, buf);
+        CHECK_EQ(buf[0], loop % 100 == 0 || loop == 1 ? kBlackboxKeyframe : kBlackboxDelta);
+        REQUIRE_EQ(dec.decode(buf, n, out), n);
+        CHECK_EQ(std::memcmp(in.v, out.v, sizeof(in.v)), 0);
+    }
+    BlackboxDecoder fresh;
+    BlackboxFrame out;
+    const size_t n = enc.encode(syntheticFrame(600), buf);
+    CHECK_EQ(fresh.decode(buf, n, out), 0u);
+}
+
+TEST_CASE("BlackboxLog drops whole segments when full and every survivor decodes") {
+    auto log = std::make_unique<BlackboxLog>();
+    constexpr uint32_t kFrames = 20000;
+    for (uint32_t loop = 1; loop <= kFrames; ++loop) log->record(syntheticFrame(loop));
+
+    CHECK_EQ(log->framesRecorded(), kFrames);
+    CHECK_EQ(log->currentSegment() - log->oldestSegment(), BlackboxLog::kSegments - 1u);
+    uint8_t seg[BlackboxLog::kSegmentBytes];
+    CHECK_EQ(log->copySegment(log->oldestSegment() - 1, seg), 0);
+
+    BlackboxFrame last;
+    int32_t prevLoop = -1;
+    for (uint32_t s = log->oldestSegment(); s <= log->currentSegment(); ++s) {
+        const uint16_t len = log->copySegment(s, seg);
+        REQUIRE_GT(len, 0);
+        CHECK_EQ(seg[0], kBlackboxKeyframe);
+        CHECK_GT(decodeSegment(seg, len, &last), 0);
+        if (prevLoop >= 0) CHECK_EQ(last[BlackboxField::Iteration] > prevLoop, true);
+        prevLoop = last[BlackboxField::Iteration];
+    }
+    CHECK_EQ(std::memcmp(last.v, syntheticFrame(kFrames).v, sizeof(last.v)), 0);
+}
+
+TEST_CASE("BlackboxLog reader never sees a torn segment while the writer runs") {
+    auto log = std::make_unique<BlackboxLog>();
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0}, copies{0};
+    std::thread reader([&] {
+        uint8_t seg[BlackboxLog::kSegmentBytes];
+        while (!done.load()) {
+            const uint16_t len = log->copySegment(log->currentSegment(), seg);
+            if (len && decodeSegment(seg, len) < 0) torn.fetch_add(1);
+            copies.fetch_add(1);
+        }
+    });
+    // Writer paced like a (fast-forwarded) flight loop: a short critical section, then idle
+    constexpr uint32_t kFrames = 50000;
+    for (uint32_t loop = 1; loop <= kFrames; ++loop) {
+        while (!log->record(syntheticFrame(loop))) {} // the drain task retries the same way
+        const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+        while (std::chrono::steady_clock::now() < until) {}
+    }
+    done.store(true);
+    reader.join();
+
+    CHECK_EQ(torn.load(), 0);
+    CHECK_GT(copies.load(), 100);
+    CHECK_EQ(log->framesRecorded(), kFrames);
+}
+
+TEST_CASE("Blackbox records the 1 kHz closed loop at every tick") {
+    ClosedLoopSimConfig cfg;
+    cfg.rates.gyroHz = 1000;
+    cfg.rates.attitudeDivider = 4;
+    cfg.rates.rcDivider = 4;
+    cfg.rates.logDivider = 1;
+    ClosedLoopSim sim(cfg);
+    auto log = std::make_unique<BlackboxLog>();
+    TelemetryRing ring;
+    sim.controller().setTelemetry(&ring);
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.setStick(0, 1600);
+    for (int i = 0; i < 200; ++i) {  // drain every 5 ms like the Telemetry Task
+        sim.run(0.005f);
+        drainTelemetry(ring, *log);
+    }
+    CHECK_EQ(ring.dropped(), 0u);
+    CHECK_EQ(ring.size(), 0u);
+
+    const uint32_t frames = log->framesRecorded();
+    CHECK_GE(frames, 999u);
+    uint32_t bytes = 0, decoded = 0;
+    uint8_t seg[BlackboxLog::kSegmentBytes];
+    BlackboxFrame last;
+    for (uint32_t s = log->oldestSegment(); s <= log->currentSegment(); ++s) {
+        const uint16_t len = log->copySegment(s, seg);
+        bytes += len;
+        decoded += decodeSegment(seg, len, &last);
+    }
+    const float perFrame = static_cast<float>(bytes) / frames;
+    CHECK_EQ(decoded, frames);
+    CHECK_LT(perFrame, 16.0f); // vs 42 B per FlightLogEntry; > 1.5 s of 1 kHz in the 24 KB ring
+
+    float r, p, y;
+    sim.controller().getAttitudeDeg(r, p, y);
+    CHECK_EQ(last[BlackboxField::AngleRoll], doctest::Approx(r * 100.0f).epsilon(0.01));
+    CHECK_EQ(last[BlackboxField::AngleSpRoll], 1000);  // +10° stick at ROLL_SENSITIVITY
+    CHECK_EQ(last[BlackboxField::Throttle], 1650);
+
+    char line[kBlackboxCsvRowBytes];
+    REQUIRE_GT(blackboxCsvRow(last, 1000, line, sizeof(line)), 0u);
+    CHECK_EQ(std::strncmp(line + std::strlen(line) - 7, ",", 1) != 0, true);
+    CHECK_NE(std::strstr(line, ",10.00,"), nullptr);  // angle setpoint column, exact text
+}
+
+namespace {
+struct StreamCapture {
+    std::string text;
+    size_t chunks = 0, largestChunk = 0;
+    BlackboxLog* log = nullptr;   // when set, the "network" is slow: flight ticks land per chunk
+    uint32_t nextLoop = 0;
+    int ticksPerChunk = 0;
+    uint32_t refused = 0;
+};
+
+void captureChunk(void* ctx, const char* data, size_t len) {
+    auto* c = static_cast<StreamCapture*>(ctx);
+    c->text.append(data, len);
+    ++c->chunks;
+    if (len > c->largestChunk) c->largestChunk = len;
+    for (int i = 0; c->log && i < c->ticksPerChunk; ++i) {
+        if (!c->log->record(syntheticFrame(c->nextLoop++))) ++c->refused;
+    }
+}
+
+size_t countLines(const std::string& s) { return static_cast<size_t>(std::count(s.begin(), s.end(), '\n')); }
+}
+
+TEST_CASE("BlackboxCsvStream serialises the ring in bounded chunks") {
+    auto log = std::make_unique<BlackboxLog>();
+    for (uint32_t loop = 1; loop <= 600; ++loop) log->record(syntheticFrame(loop));
+    uint8_t seg[BlackboxLog::kSegmentBytes];
+
+    StreamCapture all;
+    const auto res = BlackboxCsvStream(*log, 1000, seg).write(captureChunk, &all);
+    CHECK_EQ(res.rows, 600u);
+    CHECK_EQ(res.segmentsLost, 0u);
+    CHECK_EQ(countLines(all.text), 601u); // header + one row per frame
+    CHECK_LE(all.largestChunk, BlackboxCsvStream::kChunkBytes);
+    CHECK_GT(all.chunks, 40u);
+
+    char row[kBlackboxCsvRowBytes];
+    blackboxCsvRow(syntheticFrame(600), 1000, row, sizeof(row));
+    CHECK_EQ(all.text.compare(all.text.size() - std::strlen(row), std::strlen(row), row), 0);
+
+    SUBCASE("Decimation keeps one row per step") {
+        StreamCapture sparse;
+        CHECK_EQ(BlackboxCsvStream(*log, 1000, seg, 20).write(captureChunk, &sparse).rows, 30u);
+    }
+}
+
+TEST_CASE("Flight ticks keep recording while a slow download is in progress") {
+    auto log = std::make_unique<BlackboxLog>();
+    for (uint32_t loop = 1; loop <= 3000; ++loop) log->record(syntheticFrame(loop));
+    uint8_t seg[BlackboxLog::kSegmentBytes];
+
+    // Each 1 KB chunk "takes" 25 ms on the wire: 25 flight ticks land while it is sent
+    StreamCapture slow;
+    slow.log = log.get();
+    slow.nextLoop = 3001;
+    slow.ticksPerChunk = 25;
+    const uint32_t before = log->framesRecorded();
+    const auto res = BlackboxCsvStream(*log, 1000, seg).write(captureChunk, &slow);
+
+    CHECK_EQ(slow.refused, 0u);                               // no copy held across sends
+    CHECK_EQ(log->framesRecorded() - before, slow.chunks * 25u);
+    CHECK_EQ(countLines(slow.text), res.rows + 1u);
+    CHECK_GT(res.segmentsLost, 0u); // the writer lapped the oldest segments; skipped, not sent torn
+}
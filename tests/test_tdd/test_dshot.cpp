@@ -0,0 +1,101 @@
+#include "doctest.h"
+#include "core/DShot.h"
+#include "core/FlightController.h"
+#include "simulation/SimulatedHardware.h"
+
+namespace {
+// RMT item fields, rmt_item32_t layout
+uint32_t duration0(uint32_t item) { return item & 0x7FFF; }
+uint32_t level0(uint32_t item) { return (item >> 15) & 1; }
+uint32_t duration1(uint32_t item) { return (item >> 16) & 0x7FFF; }
+uint32_t level1(uint32_t item) { return item >> 31; }
+
+// What an ESC sees on the wire: a bit is 1 when its high time is past half the period
+uint16_t decode(const uint32_t items[DShotEncoder::kItems], const DShotEncoder::Timing& t) {
+    uint16_t frame = 0;
+    for (uint8_t b = 0; b < DShotEncoder::kFrameBits; ++b) {
+        frame = static_cast<uint16_t>(frame << 1 | (duration0(items[b]) * 2 > t.bitTicks ? 1 : 0));
+    }
+    return frame;
+}
+}
+
+TEST_CASE("DShot frame packs value, telemetry bit and nibble checksum") {
+    CHECK_EQ(dshotFrame(1046, false), 0x82C6); // 10000010110 0 0110
+    CHECK_EQ(dshotFrame(0, false), 0x0000);
+    CHECK_EQ(dshotFrame(2047, true), 0xFFFF);   // checksum of three 0xF nibbles is 0xF
+    CHECK_EQ(dshotCommandFrame(DShotCommand::Beacon1), (1 << 5 | 1 << 4) | 0x3);
+    for (uint16_t v = 0; v <= kDShotThrottleMax; ++v) {
+        for (bool t : {false, true}) {
+            const uint16_t f = dshotFrame(v, t);
+            CHECK_EQ(f >> 5, v);
+            CHECK_EQ((f >> 4) & 1, t ? 1 : 0);
+            CHECK_EQ((f ^ f >> 4 ^ f >> 8 ^ f >> 12) & 0xF, 0);
+        }
+    }
+    CHECK_EQ(dshotCommandRepeats(DShotCommand::Beacon3), 1);
+    CHECK_EQ(dshotCommandRepeats(DShotCommand::SpinDirectionReversed), 10);
+}
+
+TEST_CASE("Throttle maps 1000..2000 µs onto stop + 48..2047") {
+    CHECK_EQ(dshotThrottle(900), 0);
+    CHECK_EQ(dshotThrottle(1000), 0);
+    CHECK_EQ(dshotThrottle(1001), 49);
+    CHECK_EQ(dshotThrottle(1500), 1047);
+    CHECK_EQ(dshotThrottle(2000), kDShotThrottleMax);
+    CHECK_EQ(dshotThrottle(2100), kDShotThrottleMax);
+    for (int us = 1001; us < 2000; ++us) CHECK_LE(dshotThrottle(us), dshotThrottle(us + 1));
+}
+
+TEST_CASE("Encoder emits one RMT item per bit, MSB first, at every rate") {
+    for (DShotRate rate : {DShotRate::DShot150, DShotRate::DShot300, DShotRate::DShot600}) {
+        const DShotEncoder encoder(rate);
+        const DShotEncoder::Timing& t = DShotEncoder::timing(rate);
+        const float kbit[] = {150.0f, 300.0f, 600.0f};
+        CAPTURE(static_cast<int>(rate));
+        CHECK_EQ(DShotEncoder::kTickHz / 1000.0f / t.bitTicks, doctest::Approx(kbit[static_cast<int>(rate)]).epsilon(0.01));
+        CHECK_EQ(t.oneHighTicks / static_cast<float>(t.bitTicks), doctest::Approx(0.75f).epsilon(0.02));
+        CHECK_EQ(t.zeroHighTicks / static_cast<float>(t.bitTicks), doctest::Approx(0.375f).epsilon(0.02));
+
+        for (uint16_t frame : {uint16_t(0x82C6), uint16_t(0x0000), uint16_t(0xFFFF), uint16_t(0xA55A), dshotCommandFrame(DShotCommand::SpinDirectionNormal)}) {
+            uint32_t items[DShotEncoder::kItems];
+            encoder.encode(frame, items);
+            for (uint8_t b = 0; b < DShotEncoder::kFrameBits; ++b) {
+                const bool one = (frame >> (15 - b)) & 1;
+                CHECK_EQ(items[b], encoder.bitItem(one));
+                CHECK_EQ(duration0(items[b]), one ? t.oneHighTicks : t.zeroHighTicks);
+                CHECK_EQ(duration0(items[b]) + duration1(items[b]), t.bitTicks);
+                CHECK_EQ(level0(items[b]), 1);
+                CHECK_EQ(level1(items[b]), 0);
+            }
+            CHECK_EQ(items[DShotEncoder::kFrameBits], 0); // end marker
+            CHECK_EQ(decode(items, t), frame);
+        }
+    }
+}
+
+TEST_CASE("FlightController sends exactly one frame per tick in every state") {
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors motors;
+    SimulatedBatteryMonitor battery;
+    FlightController fc(imu, ppm, motors, battery);
+    fc.init();
+    ppm.setOverrideActive(true);
+    imu.setOverrideActive(true);
+
+    // {throttle, AUX1, signal lost}: disarmed, refused arm, arm at idle, idle cut, flying,
+    // back to idle, disarm, failsafe
+    const int ticks[][3] = {{1000, 1000, 0}, {1500, 1600, 0}, {1000, 1600, 0}, {1000, 1600, 0},
+                            {1500, 1600, 0}, {1000, 1600, 0}, {1000, 1000, 0}, {1000, 1000, 1}};
+    for (const auto& tick : ticks) {
+        ppm.setOverride(2, tick[0]);
+        ppm.setOverride(4, tick[1]);
+        ppm.setSignalLostOverride(tick[2] != 0);
+        const int before = motors.writes();
+        fc.update(0.001f);
+        CAPTURE(tick[0]);
+        CAPTURE(tick[1]);
+        CHECK_EQ(motors.writes() - before, 1);
+    }
+}
@@ -0,0 +1,97 @@
+#include "doctest.h"
+#include "core/DShotTelemetry.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+const float kTicksPerBit = DShotTelemetry::ticksPerBit(DShotRate::DShot600);
+
+// Capture of one reply as an RMT RX channel would time it: edges ±jitter ticks off the grid
+uint8_t capture(uint32_t periodUs, uint32_t edges[DShotTelemetry::kMaxEdges], int jitter, uint32_t t0 = 1000) {
+    const uint8_t n = DShotTelemetry::edgesFromLine(DShotTelemetry::encodeLine(periodUs), kTicksPerBit, edges);
+    for (uint8_t i = 0; i < n; ++i) edges[i] += t0 + (jitter ? std::rand() % (2 * jitter + 1) - jitter : 0);
+    return n;
+}
+
+// Motor-command ripple after settling at a hover-ish throttle, as in the harmonic notch test
+double commandJitter(bool rpmTelemetry, float mapScale) {
+    ClosedLoopSimConfig cfg;
+    cfg.rates = LoopRateConfig{1000, 4, 4, 20};
+    cfg.noise.vibrationDegSPerN = 3.0f;
+    cfg.rpmTelemetry = rpmTelemetry;
+    ClosedLoopSim sim(cfg);
+    HarmonicNotchConfig notch;
+    notch.enabled = true;
+    for (float& hz : notch.fundamentalHz) hz *= mapScale; // map measured on other props
+    sim.controller().gyroFilters().setHarmonicNotch(notch);
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.run(1.5f);
+    double sum = 0.0, sumSq = 0.0;
+    const int n = 500;
+    for (int i = 0; i < n; ++i) {
+        sim.stepControl();
+        const double m = sim.motors().getMotorOutput(0);
+        sum += m; sumSq += m * m;
+    }
+    return std::sqrt(sumSq / n - (sum / n) * (sum / n));
+}
+}
+
+TEST_CASE("eRPM reply decodes from edge timings") {
+    CHECK_EQ(DShotTelemetry::ticksPerBit(DShotRate::DShot600), doctest::Approx(53.6f)); // 750 kbit/s
+    uint32_t edges[DShotTelemetry::kMaxEdges], period = 1;
+
+    SUBCASE("Every period the 9-bit mantissa can hold survives the round trip") {
+        for (uint32_t sent = 16; sent < 65000; sent = sent * 21 / 20 + 1) {
+            const uint8_t n = capture(sent, edges, 8); // ±15 % of a bit
+            REQUIRE(DShotTelemetry::decode(edges, n, kTicksPerBit, period));
+            CHECK_LE(std::abs(static_cast<int>(period) - static_cast<int>(sent)), static_cast<int>(sent / 256));
+        }
+        CHECK(DShotTelemetry::decode(edges, capture(0, edges, 0), kTicksPerBit, period));
+        CHECK_EQ(period, 0u); // stopped
+        CHECK_EQ(DShotTelemetry::rpmFromPeriod(4286, 14), doctest::Approx(2000.0f).epsilon(0.001));
+    }
+
+    SUBCASE("The line release after the last bit is ignored") {
+        uint8_t n = capture(4286, edges, 0);
+        edges[n] = edges[n - 1] + static_cast<uint32_t>(6 * kTicksPerBit);
+        ++n;
+        REQUIRE(DShotTelemetry::decode(edges, n, kTicksPerBit, period));
+        CHECK_EQ(period, 4272u); // 267 << 4
+    }
+
+    SUBCASE("Corrupt captures are refused") {
+        const uint8_t n = capture(4286, edges, 0);
+        edges[5] += static_cast<uint32_t>(kTicksPerBit); // one edge a bit late: GCR or checksum breaks
+        CHECK_FALSE(DShotTelemetry::decode(edges, n, kTicksPerBit, period));
+        capture(4286, edges, 0);
+        CHECK_FALSE(DShotTelemetry::decode(edges, n - 3, kTicksPerBit, period)); // truncated
+        CHECK_FALSE(DShotTelemetry::decode(edges, 0, kTicksPerBit, period));
+        // Our own 16-bit DShot600 frame, seen by the same pin: pulses too short for reply bits
+        const uint32_t own[4] = {0, 25, 67, 117};
+        CHECK_FALSE(DShotTelemetry::decode(own, 4, kTicksPerBit, period));
+    }
+
+    SUBCASE("RMT RX runs turn into the same edges") {
+        const uint8_t n = capture(1234, edges, 0, 0);
+        uint32_t items[DShotTelemetry::kMaxEdges] = {};
+        for (uint8_t i = 0; i + 1 < n; ++i) { // runs between edges, two per item, then the idle
+            const uint32_t run = edges[i + 1] - edges[i];
+            items[i / 2] |= (i % 2 ? run << 16 : run) | (i % 2 ? 0u : 1u << 15);
+        }
+        uint32_t back[DShotTelemetry::kMaxEdges];
+        REQUIRE_EQ(DShotTelemetry::edgesFromItems(items, (n + 1) / 2, back), n);
+        for (uint8_t i = 0; i < n; ++i) CHECK_EQ(back[i], edges[i]);
+    }
+}
+
+TEST_CASE("Decoded eRPM drives the RPM filter in the closed-loop sim") {
+    const double matched = commandJitter(false, 1.0f);
+    const double offMap = commandJitter(false, 0.85f);
+    const double rpm = commandJitter(true, 0.85f);
+    CHECK_LT(matched, 5.0);            // µs of motor-command ripple left by a matched notch
+    CHECK_GT(offMap, 10.0 * matched);  // a wrong map leaves the vibration in the loop
+    CHECK_LT(rpm, 2.0 * matched);      // telemetry needs no map at all
+}
@@ -0,0 +1,103 @@
+#include "doctest.h"
+#include "core/DynamicNotch.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+
+namespace {
+constexpr float kTwoPi = 6.28318531f;
+
+float rms(const float* x, int n) {
+    double sum = 0.0;
+    for (int i = 0; i < n; ++i) sum += static_cast<double>(x[i]) * x[i];
+    return static_cast<float>(std::sqrt(sum / n));
+}
+}
+
+TEST_CASE("Fft and BiquadFilter building blocks") {
+    SUBCASE("A bin-centred sine lands in its bin") {
+        Fft fft;
+        float re[Fft::kSize], im[Fft::kSize];
+        for (int i = 0; i < Fft::kSize; ++i) {
+            re[i] = std::sin(kTwoPi * 10.0f * i / Fft::kSize);
+            im[i] = 0.0f;
+        }
+        fft.forward(re, im);
+        CHECK_EQ(std::hypot(re[10], im[10]), doctest::Approx(Fft::kSize / 2.0f).epsilon(0.001));
+        CHECK_LT(std::hypot(re[11], im[11]), 1e-3f);
+        CHECK_LT(std::hypot(re[0], im[0]), 1e-3f);
+    }
+
+    SUBCASE("Notch removes its centre and passes the control band") {
+        BiquadFilter notch;
+        notch.setNotch(200.0f, 3.5f, 1000.0f);
+        float atCentre[1000], lowBand[1000];
+        for (int i = 0; i < 1000; ++i) atCentre[i] = notch.apply(std::sin(kTwoPi * 200.0f * i / 1000.0f));
+        notch.reset();
+        for (int i = 0; i < 1000; ++i) lowBand[i] = notch.apply(std::sin(kTwoPi * 10.0f * i / 1000.0f));
+        CHECK_LT(rms(atCentre + 500, 500), 0.01f);                    // > 37 dB down
+        CHECK_GT(rms(lowBand + 500, 500), 0.98f * std::sqrt(0.5f));   // < 0.2 dB loss
+    }
+}
+
+TEST_CASE("DynamicNotch tracks and removes gyro noise peaks") {
+    DynamicNotch notch;
+    DynamicNotchConfig cfg;
+    cfg.enabled = true;
+    notch.configure(cfg, 1000.0f);
+
+    // Roll: 5 Hz manoeuvre + two motor lines; pitch carries one line; yaw is clean
+    float out[2000];
+    for (int i = 0; i < 2000; ++i) {
+        const float t = i / 1000.0f;
+        float r = 20.0f * std::sin(kTwoPi * 5.0f * t) + 8.0f * std::sin(kTwoPi * 213.0f * t)
+                + 4.0f * std::sin(kTwoPi * 341.0f * t);
+        float p = 6.0f * std::sin(kTwoPi * 157.0f * t), y = 0.0f;
+        notch.apply(r, p, y);
+        out[i] = r - 20.0f * std::sin(kTwoPi * 5.0f * t); // residual noise on roll
+        if (i % 10 == 9) notch.analyse();
+    }
+
+    CHECK_EQ(notch.centerHz(0, 0), doctest::Approx(213.0f).epsilon(0.01));
+    CHECK_EQ(notch.centerHz(0, 1), doctest::Approx(341.0f).epsilon(0.01));
+    CHECK_EQ(notch.centerHz(1, 0), doctest::Approx(157.0f).epsilon(0.01));
+    CHECK_EQ(notch.centerHz(2, 0), 0.0f); // nothing above the floor, stays bypassed
+
+    // Motor lines carried ~6.3 deg/s RMS before locking; the manoeuvre passes nearly intact
+    CHECK_LT(rms(out + 1500, 500), 1.5f);
+
+    SUBCASE("Disabled bank is an identity") {
+        cfg.enabled = false;
+        notch.configure(cfg, 1000.0f);
+        float r = 1.0f, p = 2.0f, y = 3.0f;
+        notch.apply(r, p, y);
+        CHECK_EQ(r, 1.0f);
+        CHECK_EQ(p, 2.0f);
+        CHECK_EQ(y, 3.0f);
+    }
+}
+
+TEST_CASE("DynamicNotch locks onto rotor vibration in the closed-loop sim") {
+    ClosedLoopSimConfig cfg;
+    cfg.rates = LoopRateConfig{1000, 4, 4, 20};
+    cfg.noise.vibrationDegSPerN = 3.0f;
+    ClosedLoopSim sim(cfg);
+    DynamicNotchConfig notch;
+    notch.enabled = true;
+    sim.controller().gyroFilters().setDynamicNotch(notch);
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.run(2.0f);
+
+    float rotorHz = 0.0f;
+    for (int i = 0; i < sim.plant().motorCount(); ++i) rotorHz += sim.plant().getRotorHz(i) / sim.plant().motorCount();
+    const DynamicNotch& bank = sim.controller().gyroFilters().dynamicNotch();
+    bool locked = false;
+    for (int n = 0; n < notch.notchCount; ++n) {
+        if (std::fabs(bank.centerHz(0, n) - rotorHz) < 15.0f) locked = true;
+    }
+    CHECK(locked);
+    float r, p, y;
+    sim.plant().getEulerDeg(r, p, y);
+    CHECK_LT(std::fabs(r), 3.0f);
+    CHECK_LT(std::fabs(p), 3.0f);
+}
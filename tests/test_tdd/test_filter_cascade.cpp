@@ -0,0 +1,78 @@
+#include "doctest.h"
+#include "core/FilterCascade.h"
+#include "core/GyroFilterStage.h"
+#include <cmath>
+#include <memory>
+
+// The 3-axis gyro chain as a compile-time cascade must compute exactly what the same stages
+// behind a virtual interface do. Timing lives in tools/filter_bench.cpp, not in the suite.
+
+namespace {
+struct IStage {
+    virtual ~IStage() = default;
+    virtual float apply(float x) = 0;
+};
+template <typename F>
+struct VirtualStage : IStage {
+    F f;
+    float apply(float x) override { return f.apply(x); }
+};
+
+using GyroChain = FilterCascade<Pt1Filter, BiquadNotch, BiquadNotch, BiquadLowpass>;
+}
+
+TEST_CASE("3-axis cascade matches the same stages behind virtual calls") {
+    AxisFilters<GyroChain> fast;
+    fast.configure([](GyroChain& c) {
+        c.stage<0>().configure(250.0f, 1000.0f);
+        c.stage<1>().configure(180.0f, 4.0f, 1000.0f);
+        c.stage<2>().configure(310.0f, 4.0f, 1000.0f);
+        c.stage<3>().configure(120.0f, 0.7071f, 1000.0f);
+    });
+    std::unique_ptr<IStage> slow[3][4];
+    for (auto& axis : slow) {
+        auto pt1 = std::make_unique<VirtualStage<Pt1Filter>>();  pt1->f.configure(250.0f, 1000.0f);
+        auto n1 = std::make_unique<VirtualStage<BiquadNotch>>(); n1->f.configure(180.0f, 4.0f, 1000.0f);
+        auto n2 = std::make_unique<VirtualStage<BiquadNotch>>(); n2->f.configure(310.0f, 4.0f, 1000.0f);
+        auto lp = std::make_unique<VirtualStage<BiquadLowpass>>(); lp->f.configure(120.0f, 0.7071f, 1000.0f);
+        axis[0] = std::move(pt1); axis[1] = std::move(n1); axis[2] = std::move(n2); axis[3] = std::move(lp);
+    }
+
+    bool same = true;
+    for (int i = 0; i < 5000; ++i) {
+        float x[3] = {std::sin(0.01f * i), std::sin(0.013f * i), std::sin(0.017f * i)};
+        float y[3] = {x[0], x[1], x[2]};
+        fast.apply(x);
+        for (int a = 0; a < 3; ++a) {
+            for (auto& stage : slow[a]) y[a] = stage->apply(y[a]);
+            same = same && x[a] == y[a];
+        }
+    }
+    CHECK(same);
+}
+
+TEST_CASE("Gyro stage lowpass: passthrough until set, then cuts above the cutoff") {
+    GyroFilterStage gyro;
+    float fs = 1000.0f;
+    gyro.setSampleRate(fs);
+    const auto peakAt = [&](float hz) {
+        float peak = 0.0f;
+        for (int i = 0; i < 2000; ++i) {
+            const float s = std::sin(6.28318531f * hz * i / fs);
+            float r = s, p = -s, y = 0.5f * s;
+            gyro.apply(r, p, y);
+            if (i >= 1000) peak = std::fmax(peak, std::fabs(p));
+        }
+        return peak;
+    };
+    CHECK_EQ(peakAt(250.0f), doctest::Approx(1.0f).epsilon(0.001));
+
+    gyro.setLowpass(150.0f, 100.0f);
+    CHECK_GT(peakAt(10.0f), 0.95f);
+    CHECK_LT(peakAt(250.0f), 0.15f);
+
+    gyro.setLowpass(0.0f, 100.0f);
+    fs = 2000.0f;
+    gyro.setSampleRate(fs); // the biquad is redesigned for the new rate: still -3 dB at 100 Hz
+    CHECK_EQ(peakAt(100.0f), doctest::Approx(0.7071f).epsilon(0.03));
+}
@@ -0,0 +1,90 @@
+#include "doctest.h"
+#include "core/FilterCascade.h"
+#include <cmath>
+
+namespace {
+constexpr float kTwoPi = 6.28318531f;
+constexpr float kFs = 1000.0f;
+
+// Steady-state output amplitude for a unit sine at `hz` (second half of 2 s).
+template <typename F>
+float gainAt(F& filter, float hz) {
+    filter.reset();
+    float peak = 0.0f;
+    for (int i = 0; i < 2000; ++i) {
+        const float y = filter.apply(std::sin(kTwoPi * hz * i / kFs));
+        if (i >= 1000 && std::fabs(y) > peak) peak = std::fabs(y);
+    }
+    return peak;
+}
+}
+
+TEST_CASE("PT1/PT2/PT3 hit -3 dB at the requested cutoff") {
+    Pt1Filter pt1; Pt2Filter pt2; Pt3Filter pt3;
+    pt1.configure(50.0f, kFs);
+    pt2.configure(50.0f, kFs);
+    pt3.configure(50.0f, kFs);
+
+    CHECK_EQ(gainAt(pt1, 50.0f), doctest::Approx(0.7071f).epsilon(0.01));
+    CHECK_EQ(gainAt(pt2, 50.0f), doctest::Approx(0.7071f).epsilon(0.01));
+    CHECK_EQ(gainAt(pt3, 50.0f), doctest::Approx(0.7071f).epsilon(0.01));
+
+    // Higher order rolls off harder above the cutoff
+    const float g1 = gainAt(pt1, 200.0f), g2 = gainAt(pt2, 200.0f), g3 = gainAt(pt3, 200.0f);
+    CHECK_GT(g1, g2);
+    CHECK_GT(g2, g3);
+
+    SUBCASE("Unity DC gain and reset to a value") {
+        pt3.reset(5.0f);
+        CHECK_EQ(pt3.apply(5.0f), doctest::Approx(5.0f));
+    }
+
+    SUBCASE("Gain 1 is a bypass (PIDController dAlpha = 1)") {
+        Pt1Filter bypass;
+        bypass.setGain(1.0f);
+        CHECK_EQ(bypass.apply(3.25f), 3.25f);
+    }
+}
+
+TEST_CASE("Biquad stages and compile-time cascades") {
+    SUBCASE("Lowpass, notch and bandpass responses") {
+        BiquadLowpass lp; BiquadNotch notch; BiquadBandpass bp;
+        lp.configure(100.0f, 0.7071f, kFs);
+        notch.configure(150.0f, 4.0f, kFs);
+        bp.configure(150.0f, 4.0f, kFs);
+        CHECK_EQ(gainAt(lp, 5.0f), doctest::Approx(1.0f).epsilon(0.01));
+        CHECK_EQ(gainAt(lp, 100.0f), doctest::Approx(0.7071f).epsilon(0.03));
+        CHECK_LT(gainAt(notch, 150.0f), 0.02f);
+        CHECK_EQ(gainAt(bp, 150.0f), doctest::Approx(1.0f).epsilon(0.02));
+        CHECK_LT(gainAt(bp, 20.0f), 0.1f);
+    }
+
+    SUBCASE("Cascade equals the stages applied by hand") {
+        FilterCascade<Pt1Filter, BiquadNotch, BiquadLowpass> chain;
+        Pt1Filter a; BiquadNotch b; BiquadLowpass c;
+        chain.stage<0>().configure(250.0f, kFs);       a.configure(250.0f, kFs);
+        chain.stage<1>().configure(180.0f, 4.0f, kFs); b.configure(180.0f, 4.0f, kFs);
+        chain.stage<2>().configure(120.0f, 0.7f, kFs); c.configure(120.0f, 0.7f, kFs);
+        static_assert(decltype(chain)::kStages == 3, "stage count is a compile-time constant");
+        for (int i = 0; i < 200; ++i) {
+            const float x = std::sin(0.37f * i) + 0.5f * std::sin(1.9f * i);
+            CHECK_EQ(chain.apply(x), c.apply(b.apply(a.apply(x))));
+        }
+        chain.reset();
+        CHECK_EQ(chain.apply(0.0f), 0.0f);
+    }
+
+    SUBCASE("AxisFilters keeps independent state per axis") {
+        AxisFilters<FilterCascade<Pt2Filter>> gyro;
+        gyro.configure([](auto& f) { f.template stage<0>().configure(80.0f, kFs); });
+        float x[3] = {1.0f, 0.0f, -1.0f};
+        for (int i = 0; i < 500; ++i) {
+            float s[3] = {x[0], x[1], x[2]};
+            gyro.apply(s);
+            if (i == 499) { x[0] = s[0]; x[1] = s[1]; x[2] = s[2]; }
+        }
+        CHECK_EQ(x[0], doctest::Approx(1.0f));
+        CHECK_EQ(x[1], 0.0f);
+        CHECK_EQ(x[2], doctest::Approx(-1.0f));
+    }
+}
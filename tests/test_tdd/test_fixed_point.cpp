@@ -0,0 +1,97 @@
+#include "doctest.h"
+#include "core/FixedPoint.h"
+#include "core/PIDController.h"
+#include "core/KalmanFilter.h"
+#include "simulation/SensorNoise.h"
+#include <cmath>
+
+TEST_CASE("Q16 arithmetic rounds and saturates") {
+    SUBCASE("Round trip and rounding to nearest") {
+        CHECK_EQ(static_cast<float>(Q16(1.5f)), 1.5f);
+        CHECK_EQ(Q16(-0.25f).raw(), -16384);
+        CHECK_EQ((Q16(0.5f) * Q16(-3.0f)).raw(), Q16(-1.5f).raw());
+        CHECK_EQ(static_cast<float>(Q16(10.0f) / Q16(4.0f)), 2.5f);
+        CHECK_EQ((Q16::fromRaw(1) * Q16(0.5f)).raw(), 1); // half an LSB rounds up
+    }
+
+    SUBCASE("Overflow pins at the rails instead of wrapping") {
+        CHECK_EQ((Q16(30000.0f) + Q16(30000.0f)).raw(), INT32_MAX);
+        CHECK_EQ((Q16(-30000.0f) - Q16(30000.0f)).raw(), -INT32_MAX);
+        CHECK_EQ((Q16(1000.0f) * Q16(-1000.0f)).raw(), -INT32_MAX);
+        CHECK_EQ(Q16(1e9f).raw(), INT32_MAX);
+        CHECK_EQ((-Q16::min()).raw(), INT32_MAX);
+    }
+
+    SUBCASE("Divide by zero saturates towards the dividend's sign") {
+        CHECK_EQ((Q16(3.0f) / Q16(0.0f)).raw(), INT32_MAX);
+        CHECK_EQ((Q16(-3.0f) / Q16(0.0f)).raw(), -INT32_MAX);
+    }
+}
+
+TEST_CASE("Q16 PID tracks the float PID on the same inputs") {
+    // Yaw-style P/I with the rate-loop D gain and D-term LPF, at the 1 kHz inner rate
+    PIDController ref(2.0f, 12.0f, 0.01f, 0.2f);
+    FixedPIDController fix(2.0f, 12.0f, 0.01f, 0.2f);
+    SensorNoise rng(7);
+    constexpr float kDt = 0.001f;
+
+    float maxDiff = 0.0f, maxIDiff = 0.0f;
+    bool sawClamp = false;
+    for (int i = 0; i < 5000; ++i) {
+        const float t = i * kDt;
+        const float setpoint = i < 2500 ? 200.0f : -150.0f;              // stick steps
+        const float measured = 120.0f * std::sin(6.0f * t) + 2.0f * rng.gaussian();
+        const float a = ref.update(setpoint - measured, measured, kDt);
+        const float b = static_cast<float>(fix.update(Q16(setpoint - measured), Q16(measured), kDt));
+        sawClamp |= std::fabs(a) == 400.0f;
+        maxDiff = std::fmax(maxDiff, std::fabs(a - b));
+        maxIDiff = std::fmax(maxIDiff, std::fabs(ref.getIterm() - static_cast<float>(fix.getIterm())));
+    }
+    CHECK(sawClamp);                 // both paths exercised the ±400 clamp
+    // Below the 1 µs motor command resolution; the residue is ki·dt/2 quantised to 2^-16
+    CHECK_LT(maxDiff, 0.5f);
+    CHECK_LT(maxIDiff, 0.5f);
+
+    SUBCASE("Clamp values are bit-identical to the float limit") {
+        FixedPIDController hot(1000.0f, 0.0f, 0.0f);
+        CHECK_EQ(static_cast<float>(hot.update(Q16(5.0f), Q16(0.0f), kDt)), 400.0f);
+        CHECK_EQ(static_cast<float>(hot.update(Q16(-5.0f), Q16(0.0f), kDt)), -400.0f);
+    }
+}
+
+TEST_CASE("Q16 I-term relax tracks the float one") {
+    PIDController ref(0.0f, 12.0f, 0.0f);
+    FixedPIDController fix(0.0f, 12.0f, 0.0f);
+    ref.setItermRelax(40.0f); ref.setItermRelaxCutoff(15.0f, 1000.0f);
+    fix.setItermRelax(40.0f); fix.setItermRelaxCutoff(15.0f, 1000.0f);
+    float maxIDiff = 0.0f;
+    for (int i = 0; i < 3000; ++i) {
+        const float setpoint = 150.0f * std::sin(0.004f * i) + (i % 1000 < 500 ? 100.0f : -100.0f); // stick flicks
+        const float measured = 0.8f * setpoint;
+        ref.update(setpoint - measured, measured, 0.001f);
+        fix.update(Q16(setpoint - measured), Q16(measured), 0.001f);
+        maxIDiff = std::fmax(maxIDiff, std::fabs(ref.getIterm() - static_cast<float>(fix.getIterm())));
+    }
+    CHECK_GT(std::fabs(ref.getIterm()), 1.0f); // I did accumulate between the flicks
+    CHECK_LT(maxIDiff, 0.5f);
+}
+
+TEST_CASE("Q16 Kalman tracks the float Kalman on the same inputs") {
+    KalmanFilter ref;
+    FixedKalmanFilter fix;
+    SensorNoise rng(11);
+    constexpr float kDt = 0.004f;
+
+    float maxDiff = 0.0f;
+    for (int i = 0; i < 2500; ++i) {
+        const float t = i * kDt;
+        const float angle = 25.0f * std::sin(1.5f * t);
+        const float rate = 37.5f * std::cos(1.5f * t) + 0.5f * rng.gaussian();
+        const float meas = angle + 3.0f * rng.gaussian();
+        ref.update(rate, meas, kDt);
+        fix.update(Q16(rate), Q16(meas), kDt);
+        maxDiff = std::fmax(maxDiff, std::fabs(ref.getState() - static_cast<float>(fix.getState())));
+    }
+    CHECK_LT(maxDiff, 0.05f);
+    CHECK_EQ(static_cast<float>(fix.getUncertainty()), doctest::Approx(ref.getUncertainty()).epsilon(0.05));
+}
@@ -108,3 +108,52 @@ TEST_CASE("FlightController core logic and failsafes") {
         CHECK_EQ(motors.getMotorOutput(1), 1000);
     }
 }
+
+TEST_CASE("FlightController multi-rate scheduling") {
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors motors;
+    SimulatedBatteryMonitor battery;
+
+    FlightController fc(imu, ppm, motors, battery);
+    LoopRateConfig rates;
+    rates.gyroHz = 1000;
+    rates.attitudeDivider = 4;
+    rates.rcDivider = 4;
+    rates.logDivider = 20;
+    fc.setLoopRates(rates);
+    fc.init();
+    CHECK_EQ(fc.loopRates().gyroHz, 1000);
+
+    imu.setOverride(0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    imu.setOverrideActive(true);
+    ppm.setOverride(2, 1000); ppm.setOverride(4, 1600);
+    ppm.setOverrideActive(true);
+    fc.update(rates.gyroDt()); // RC tick: arms
+    for (int i = 0; i < 3; ++i) fc.update(rates.gyroDt());
+
+    SUBCASE("Throttle is picked up on the next RC sub-tick") {
+        ppm.setOverride(2, 1500);
+        fc.update(rates.gyroDt()); // RC tick
+        CHECK_EQ(motors.getMotorOutput(0), static_cast<int>(1.024f * 1500.0f));
+    }
+
+    SUBCASE("Rate PID reacts every gyro tick between attitude updates") {
+        ppm.setOverride(2, 1500);
+        fc.update(rates.gyroDt());
+        const int level = motors.getMotorOutput(2);
+        imu.setOverride(-50.0f, 0.0f, 0.0f, 0.0f, 0.0f); // rolling left, off-RC tick
+        fc.update(rates.gyroDt());
+        CHECK_GT(motors.getMotorOutput(2), level); // left motor 3 pushes back immediately
+    }
+
+    SUBCASE("RateDivider fires on the first tick and every Nth after") {
+        RateDivider div(3);
+        CHECK(div.tick());
+        CHECK_FALSE(div.tick());
+        CHECK_FALSE(div.tick());
+        CHECK(div.tick());
+        div.restart();
+        CHECK(div.tick());
+    }
+}
@@ -0,0 +1,119 @@
+#include "doctest.h"
+#include "core/FlightController.h"
+#include "core/FlightParams.h"
+#include "simulation/SimulatedHardware.h"
+#include <cmath>
+#include <cstring>
+
+TEST_CASE("FlightParams schema: defaults, keys and ranges in one table") {
+    const FlightParams p;
+    CHECK_EQ(p.get(ParamId::RollRateKp), FlightControlConstants::kDefaultRateKp);
+    CHECK_EQ(p.get(ParamId::YawRateKi), FlightControlConstants::kDefaultYawKi);
+    CHECK_EQ(p.get(ParamId::PitchAngleKp), FlightControlConstants::kDefaultAngleKp);
+
+    ParamId id;
+    REQUIRE(FlightParams::find("y_ki", id));
+    CHECK(id == ParamId::YawRateKi);
+    CHECK_FALSE(FlightParams::find("y_kx", id));
+    for (size_t i = 0; i < kParamCount; ++i) {
+        const ParamSpec& s = FlightParams::spec(static_cast<ParamId>(i));
+        CHECK(FlightParams::find(s.key, id));
+        CHECK_EQ(static_cast<size_t>(id), i); // keys are unique
+        CHECK((s.def >= s.min && s.def <= s.max));
+    }
+
+    FlightParams q;
+    CHECK(q.set(ParamId::RollRateKd, 0.05f));
+    CHECK_FALSE(q.set(ParamId::RollRateKd, 9.0f));
+    CHECK_FALSE(q.set(ParamId::RollRateKp, -0.1f));
+    CHECK_FALSE(q.set(ParamId::RollRateKp, std::nanf("")));
+    CHECK_EQ(q.get(ParamId::RollRateKd), 0.05f);
+    CHECK_EQ(q.get(ParamId::RollRateKp), FlightControlConstants::kDefaultRateKp);
+}
+
+TEST_CASE("FlightParams blob: versioned, checksummed, one read and one write") {
+    FlightParams in;
+    in.set(ParamId::RollRateKp, 0.85f);
+    in.set(ParamId::YawRateKi, 9.5f);
+    uint8_t blob[FlightParams::kBlobBytes];
+    REQUIRE_EQ(encodeParams(in, blob, sizeof(blob)), FlightParams::kBlobBytes);
+    CHECK_EQ(encodeParams(in, blob, sizeof(blob) - 1), 0u);
+
+    FlightParams out;
+    REQUIRE(decodeParams(blob, sizeof(blob), out));
+    CHECK_EQ(std::memcmp(out.values, in.values, sizeof(in.values)), 0);
+
+    SUBCASE("Corrupt, truncated or newer blobs leave the params untouched") {
+        FlightParams kept;
+        blob[10] ^= 0x40;
+        CHECK_FALSE(decodeParams(blob, sizeof(blob), kept));
+        blob[10] ^= 0x40;
+        CHECK_FALSE(decodeParams(blob, sizeof(blob) - 1, kept));
+        blob[2] = FlightParams::kVersion + 1;
+        CHECK_FALSE(decodeParams(blob, sizeof(blob), kept));
+        CHECK_EQ(kept.get(ParamId::RollRateKp), FlightControlConstants::kDefaultRateKp);
+    }
+
+    SUBCASE("A blob with fewer parameters keeps defaults for the rest") {
+        FlightParams shortParams;
+        shortParams.set(ParamId::RollRateKp, 1.1f);
+        uint8_t full[FlightParams::kBlobBytes];
+        encodeParams(shortParams, full, sizeof(full));
+        // Rebuild as a 3-parameter blob: header, three values, CRC over both
+        uint8_t older[4 + 12 + 4];
+        std::memcpy(older, full, 16);
+        older[3] = 3;
+        uint32_t crc = 0xFFFFFFFFu; // CRC-32/IEEE
+        for (size_t i = 0; i < 16; ++i) {
+            crc ^= older[i];
+            for (int b = 0; b < 8; ++b) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        crc = ~crc;
+        for (int b = 0; b < 4; ++b) older[16 + b] = static_cast<uint8_t>(crc >> (8 * b));
+        FlightParams out2;
+        out2.set(ParamId::YawRateKp, 3.0f);
+        REQUIRE(decodeParams(older, sizeof(older), out2));
+        CHECK_EQ(out2.get(ParamId::RollRateKp), 1.1f);
+        CHECK_EQ(out2.get(ParamId::YawRateKp), FlightControlConstants::kDefaultYawKp);
+    }
+}
+
+TEST_CASE("FlightController loads the blob once and swaps staged gains in at a tick") {
+    FlightParams stored;
+    stored.set(ParamId::YawRateKp, 3.5f);
+    REQUIRE(saveParams(stored));
+
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors motors;
+    SimulatedBatteryMonitor battery;
+    FlightController fc(imu, ppm, motors, battery);
+    fc.init();
+    CHECK_EQ(fc.params().read().get(ParamId::YawRateKp), 3.5f);
+    REQUIRE(saveParams(FlightParams())); // the RAM store is shared by every test
+
+    // Zero every gain after init: the store holds non-zero gains, so a correction here
+    // would mean the controller went back to flash instead of params()
+    FlightParams off;
+    for (size_t i = 0; i < kParamCount; ++i) off.set(static_cast<ParamId>(i), 0.0f);
+    fc.params().write(off);
+
+    imu.setOverride(40.0f, -25.0f, 30.0f, 0.0f, 0.0f);
+    imu.setOverrideActive(true);
+    ppm.setOverride(2, 1000);
+    ppm.setOverride(4, 1600);
+    ppm.setOverrideActive(true);
+    fc.update(0.004f);             // arms at idle throttle
+    ppm.setOverride(2, 1400);
+    for (int i = 0; i < 5; ++i) fc.update(0.004f);
+    for (int m = 1; m < 4; ++m) CHECK_EQ(motors.getMotorOutput(m), motors.getMotorOutput(0));
+
+    // Still armed: the next tick flies the new set, no land / disarm / re-arm needed
+    fc.params().write(FlightParams());
+    fc.update(0.004f);
+    CHECK_GT(std::abs(motors.getMotorOutput(1) - motors.getMotorOutput(0)), 20); // a real correction, not rounding
+
+    FlightParams stillStored;
+    REQUIRE(loadParams(stillStored)); // the flight loop never wrote flash
+    CHECK_EQ(std::memcmp(stillStored.values, FlightParams().values, sizeof(stillStored.values)), 0);
+}
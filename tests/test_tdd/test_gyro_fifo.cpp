@@ -0,0 +1,83 @@
+#include "doctest.h"
+#include "core/GyroFifoDecimator.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+void pushFrame(std::vector<uint8_t>& fifo, int16_t x, int16_t y, int16_t z) {
+    for (int16_t v : {x, y, z}) {
+        fifo.push_back(static_cast<uint8_t>((static_cast<uint16_t>(v) >> 8) & 0xFF));
+        fifo.push_back(static_cast<uint8_t>(v & 0xFF));
+    }
+}
+}
+
+TEST_CASE("GyroFifoDecimator averages a FIFO burst") {
+    GyroFifoDecimator dec(65.5f);
+    std::vector<uint8_t> fifo;
+    float r = 0, p = 0, y = 0;
+
+    SUBCASE("Big-endian signed frames are scaled to deg/s") {
+        pushFrame(fifo, 655, -131, 0);
+        CHECK_EQ(dec.consume(fifo.data(), fifo.size()), 1);
+        dec.getRates(r, p, y);
+        CHECK_EQ(r, doctest::Approx(10.0f));
+        CHECK_EQ(p, doctest::Approx(-2.0f));
+        CHECK_EQ(y, doctest::Approx(0.0f));
+    }
+
+    SUBCASE("Batch is averaged and a trailing partial frame ignored") {
+        pushFrame(fifo, 100, -200, 32767);
+        pushFrame(fifo, 300, -400, 32767);
+        fifo.push_back(0x7F); // half-written frame
+        CHECK_EQ(dec.consume(fifo.data(), fifo.size()), 2);
+        CHECK_EQ(dec.lastFrames(), 2);
+        dec.getRates(r, p, y);
+        CHECK_EQ(r, doctest::Approx(200.0f / 65.5f));
+        CHECK_EQ(p, doctest::Approx(-300.0f / 65.5f));
+        CHECK_EQ(y, doctest::Approx(32767.0f / 65.5f)); // no int16 overflow in the sum
+    }
+
+    SUBCASE("A drain past 256 bytes is consumed whole and stays frame-aligned") {
+        // 10.5 ms of 8 kHz frames: the longest stall short of the overflow reset
+        for (int f = 0; f < 84; f++) pushFrame(fifo, static_cast<int16_t>(f), 100, -100);
+        fifo.push_back(0x01); // FIFO_COUNT lands mid-frame
+        CHECK_EQ(GyroFifoDecimator::wholeFrameBytes(static_cast<uint16_t>(fifo.size())), 504);
+        CHECK_EQ(dec.consume(fifo.data(), GyroFifoDecimator::wholeFrameBytes(static_cast<uint16_t>(fifo.size()))), 84);
+        dec.getRates(r, p, y);
+        CHECK_EQ(r, doctest::Approx(41.5f / 65.5f)); // mean of 0..83
+        CHECK_EQ(p, doctest::Approx(100.0f / 65.5f));
+        CHECK_EQ(y, doctest::Approx(-100.0f / 65.5f));
+    }
+
+    SUBCASE("Empty batch holds the previous rates") {
+        pushFrame(fifo, 655, 655, 655);
+        dec.consume(fifo.data(), fifo.size());
+        CHECK_EQ(dec.consume(fifo.data(), 0), 0);
+        dec.getRates(r, p, y);
+        CHECK_EQ(r, doctest::Approx(10.0f));
+    }
+
+    SUBCASE("Averaging 8 kHz samples into 1 kHz cuts white noise by ~sqrt(8)") {
+        // LCG uniform noise in [-512, 511]; the 8-sample mean should have 1/sqrt(8) the RMS
+        uint32_t state = 12345u;
+        double rawVar = 0.0, decVar = 0.0;
+        const int ticks = 2000;
+        for (int t = 0; t < ticks; t++) {
+            fifo.clear();
+            for (int s = 0; s < 8; s++) {
+                state = state * 1664525u + 1013904223u;
+                int16_t v = static_cast<int16_t>(static_cast<int32_t>(state >> 22) - 512);
+                rawVar += static_cast<double>(v) * v;
+                pushFrame(fifo, v, 0, 0);
+            }
+            dec.consume(fifo.data(), fifo.size());
+            dec.getRates(r, p, y);
+            decVar += static_cast<double>(r * 65.5f) * (r * 65.5f);
+        }
+        double ratio = std::sqrt((rawVar / (ticks * 8)) / (decVar / ticks));
+        CHECK_GT(ratio, 2.3);
+        CHECK_LT(ratio, 3.4);
+    }
+}
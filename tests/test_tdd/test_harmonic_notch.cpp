@@ -0,0 +1,135 @@
+#include "doctest.h"
+#include "core/HarmonicNotch.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+
+namespace {
+constexpr float kTwoPi = 6.28318531f;
+
+// Synthetic gyro vibration: every motor contributes its first three harmonics, each with
+// its own amplitude and a different mix onto the three axes (frame/mount asymmetry).
+struct SyntheticVibration {
+    float sampleHz = 4000.0f;
+    float rotorHz[4] = {};
+    float harmonicAmp[3] = {6.0f, 3.0f, 1.5f};
+    float axisGain[3][4] = {{1.0f, 0.8f, 1.1f, 0.9f}, {0.7f, 1.2f, 0.9f, 1.0f}, {0.3f, 0.4f, 0.2f, 0.5f}};
+    float phase[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+
+    void next(float out[3]) {
+        out[0] = out[1] = out[2] = 0.0f;
+        for (int m = 0; m < 4; ++m) {
+            phase[m] = std::fmod(phase[m] + kTwoPi * rotorHz[m] / sampleHz, kTwoPi);
+            float v = 0.0f;
+            for (int h = 0; h < 3; ++h) v += harmonicAmp[h] * std::sin((h + 1) * phase[m]);
+            for (int a = 0; a < 3; ++a) out[a] += axisGain[a][m] * v;
+        }
+    }
+};
+
+// Runs `seconds` of vibration through the bank; returns residual/input RMS (axis 0..2 summed).
+float attenuation(HarmonicNotch& bank, SyntheticVibration& vib, const int cmd[4], float seconds) {
+    const int n = static_cast<int>(seconds * vib.sampleHz);
+    double in = 0.0, out = 0.0;
+    for (int i = 0; i < n; ++i) {
+        float v[3];
+        vib.next(v);
+        float r = v[0], p = v[1], y = v[2];
+        bank.apply(r, p, y);
+        bank.setMotorCommands(cmd, 4);
+        if (i < n / 2) continue; // let the lag and the notches settle
+        in  += v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+        out += r * r + p * p + y * y;
+    }
+    return static_cast<float>(std::sqrt(out / in));
+}
+}
+
+TEST_CASE("HarmonicNotch maps motor commands to notch centres") {
+    HarmonicNotch bank;
+    HarmonicNotchConfig cfg;
+    cfg.enabled = true;
+    cfg.motorTauS = 0.0f;
+    bank.configure(cfg, 1000.0f);
+
+    CHECK_EQ(bank.fundamentalForCommand(1000), 0.0f);
+    CHECK_EQ(bank.fundamentalForCommand(1100), doctest::Approx(59.35f));
+    CHECK_EQ(bank.fundamentalForCommand(2000), doctest::Approx(400.0f));
+    CHECK_EQ(bank.fundamentalForCommand(2300), doctest::Approx(400.0f));
+
+    const int cmd[4] = {1600, 1600, 1000, 1600};
+    for (int i = 0; i < 4; ++i) bank.setMotorCommands(cmd, 4); // one motor retuned per call
+    CHECK_EQ(bank.centerHz(0, 0), doctest::Approx(262.9f));
+    CHECK_EQ(bank.centerHz(0, 1), 0.0f); // 526 Hz is past 0.45·fs: bypassed
+    CHECK_EQ(bank.centerHz(2, 0), 0.0f); // stopped motor: below minHz
+}
+
+TEST_CASE("HarmonicNotch tracks every hex/octo motor on its own notch") {
+    HarmonicNotch bank;
+    HarmonicNotchConfig cfg;
+    cfg.enabled = true;
+    cfg.motorTauS = 0.0f;
+    bank.configure(cfg, 1000.0f);
+    const int octo[8] = {1200, 1300, 1400, 1500, 1800, 1700, 1600, 1500};
+    for (int i = 0; i < 8; ++i) bank.setMotorCommands(octo, 8);
+    CHECK_EQ(bank.centerHz(0, 0), doctest::Approx(bank.fundamentalForCommand(1200)));
+    CHECK_EQ(bank.centerHz(4, 0), doctest::Approx(bank.fundamentalForCommand(1800))); // not the mean
+
+    bank.setMotorCommands(octo, 4); // back to a quad: motors 5..8 drop out of the bank
+    for (int m = 4; m < 8; ++m) CHECK_EQ(bank.centerHz(m, 0), 0.0f);
+}
+
+TEST_CASE("HarmonicNotch rejects synthetic motor vibration spectra") {
+    HarmonicNotch bank;
+    HarmonicNotchConfig cfg;
+    cfg.enabled = true;
+    bank.configure(cfg, 4000.0f);
+    const int cmd[4] = {1500, 1550, 1600, 1650};
+    SyntheticVibration vib;
+    for (int m = 0; m < 4; ++m) vib.rotorHz[m] = bank.fundamentalForCommand(cmd[m]);
+
+    SUBCASE("Map matches the rotors: 12 lines on 3 axes cut by > 30 dB") {
+        CHECK_LT(attenuation(bank, vib, cmd, 1.0f), 0.03f);
+    }
+
+    SUBCASE("Map 3% off the real rotor speed still gives > 6 dB") {
+        for (float& hz : vib.rotorHz) hz *= 1.03f;
+        CHECK_LT(attenuation(bank, vib, cmd, 1.0f), 0.5f);
+    }
+
+    SUBCASE("Control-band motion passes with the whole bank engaged") {
+        for (int i = 0; i < 4; ++i) bank.setMotorCommands(cmd, 4);
+        double in = 0.0, out = 0.0;
+        for (int i = 0; i < 8000; ++i) {
+            const float x = std::sin(kTwoPi * 8.0f * i / 4000.0f);
+            float r = x, p = x, y = x;
+            bank.apply(r, p, y);
+            if (i >= 4000) { in += x * x; out += r * r; }
+        }
+        CHECK_GT(std::sqrt(out / in), 0.97);
+    }
+}
+
+TEST_CASE("HarmonicNotch quiets motor commands in the closed-loop sim") {
+    auto commandJitter = [](bool notchOn) {
+        ClosedLoopSimConfig cfg;
+        cfg.rates = LoopRateConfig{1000, 4, 4, 20};
+        cfg.noise.vibrationDegSPerN = 3.0f;
+        ClosedLoopSim sim(cfg);
+        HarmonicNotchConfig notch;
+        notch.enabled = notchOn;
+        sim.controller().gyroFilters().setHarmonicNotch(notch);
+        sim.arm();
+        sim.setStick(2, 1650);
+        sim.run(1.5f);
+        double sum = 0.0, sumSq = 0.0;
+        const int n = 500;
+        for (int i = 0; i < n; ++i) {
+            sim.stepControl();
+            const double m = sim.motors().getMotorOutput(0);
+            sum += m; sumSq += m * m;
+        }
+        return std::sqrt(sumSq / n - (sum / n) * (sum / n));
+    };
+    const double off = commandJitter(false), on = commandJitter(true);
+    CHECK_LT(on, 0.5 * off);
+}
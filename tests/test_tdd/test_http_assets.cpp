@@ -0,0 +1,39 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "network/WebAssets.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cstring>
+
+TEST_CASE("Loopback: dashboard assets are gzipped from flash and revalidated by ETag") {
+    ClosedLoopSim sim;
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), sim.controller().vehicleState());
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    for (const HttpAsset& asset : kWebAssets) {
+        const std::string response = get(port, std::string(asset.path) + "?v=1");
+        const std::string body = bodyOf(response);
+        CHECK_EQ(statusOf(response), 200);
+        CHECK_NE(response.find("Content-Encoding: gzip\r\n"), std::string::npos);
+        CHECK_NE(response.find("ETag: " + std::string(asset.etag) + "\r\n"), std::string::npos);
+        CHECK_NE(response.find("Cache-Control: " + std::string(asset.cacheControl)), std::string::npos);
+        REQUIRE_EQ(body.size(), asset.len);
+        CHECK_EQ(static_cast<uint8_t>(body[0]), 0x1f); // gzip magic
+        CHECK_EQ(static_cast<uint8_t>(body[1]), 0x8b);
+
+        // A client holding the current ETag gets headers only; a stale one gets the file
+        const std::string cached = roundTrip(port, "GET " + std::string(asset.path) + " HTTP/1.1\r\n"
+                                                   "If-None-Match: \"0ld\", " + asset.etag + "\r\n\r\n");
+        CHECK_EQ(statusOf(cached), 304);
+        CHECK_EQ(bodyOf(cached), "");
+        CHECK_NE(cached.find("ETag: " + std::string(asset.etag)), std::string::npos);
+        const std::string stale = roundTrip(port, "GET " + std::string(asset.path) + " HTTP/1.1\r\n"
+                                                  "if-none-match: \"0ld\"\r\n\r\n");
+        CHECK_EQ(bodyOf(stale).size(), asset.len);
+    }
+    // The page revalidates each load; the hashed-URL scripts and styles never do
+    CHECK_EQ(std::string(kWebAssets[0].path), "/");
+    CHECK_EQ(std::string(kWebAssets[0].cacheControl), "no-cache");
+    for (size_t i = 1; i < kWebAssetCount; ++i) CHECK_NE(std::strstr(kWebAssets[i].cacheControl, "immutable"), nullptr);
+}
@@ -0,0 +1,43 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "simulation/ClosedLoopSim.h"
+
+TEST_CASE("Loopback: autotune runs in the flight loop and stages its result") {
+    ClosedLoopSim sim;
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.run(1.5f);
+    FlightController& fc = sim.controller();
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), fc.vehicleState());
+    WebDashboardHandlers::setParams(fc.params());
+    WebDashboardHandlers::setAutotune(fc.autotune());
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    CHECK_NE(bodyOf(get(port, "/api/autotune")).find("\"state\":\"idle\""), std::string::npos);
+    CHECK_NE(bodyOf(post(port, "/api/autotune", "cmd=apply")).find("\"ok\":false"), std::string::npos);
+    CHECK_EQ(statusOf(post(port, "/api/autotune", "cmd=start&axis=7")), 400);
+    CHECK_EQ(bodyOf(post(port, "/api/autotune", "cmd=start&axis=1")), "{\"ok\":true}");
+
+    // Flight ticks on this thread while the server thread answers: the request, result
+    // and staged gains each cross through their own atomic / seqlock
+    for (int i = 0; i < 3000 && fc.autotune().result().state != AutotuneState::Done; ++i) sim.stepControl();
+    const AutotuneResult r = fc.autotune().result();
+    REQUIRE(r.state == AutotuneState::Done);
+    CHECK_EQ(r.axis, 1);
+    CHECK_NE(bodyOf(get(port, "/api/autotune")).find("\"state\":\"done\",\"axis\":1"), std::string::npos);
+
+    CHECK_EQ(bodyOf(post(port, "/api/autotune", "cmd=apply")), "{\"status\":\"success\",\"saved\":false,\"pending\":true}");
+    CHECK_EQ(fc.params().read().get(ParamId::PitchRateKp), r.kp);
+    CHECK_EQ(fc.params().read().get(ParamId::PitchRateKi), r.ki);
+    CHECK_EQ(fc.params().read().get(ParamId::RollRateKp), FlightControlConstants::kDefaultRateKp);
+    sim.run(0.5f); // flies on the staged set
+    CHECK_GT(sim.plant().getAltitudeM(), 0.5f);
+    sim.disarm();
+    WebDashboardHandlers::commitPendingParams();
+    FlightParams stored;
+    REQUIRE(loadParams(stored));
+    CHECK_EQ(stored.get(ParamId::PitchRateKd), r.kd);
+    REQUIRE(saveParams(FlightParams())); // the RAM store is shared by every test
+}
@@ -0,0 +1,50 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "core/BlackboxCsv.h"
+#include "simulation/ClosedLoopSim.h"
+#include <algorithm>
+#include <memory>
+
+TEST_CASE("Loopback: blackbox downloads stream from per-connection cursors") {
+    auto log = std::make_unique<BlackboxLog>();
+    TelemetryRing ring;
+    for (uint32_t loop = 1; loop <= 3000; ++loop) {
+        BlackboxFrame f;
+        f[BlackboxField::Iteration] = static_cast<int32_t>(loop);
+        f[BlackboxField::Throttle] = static_cast<int32_t>(1000 + loop % 700);
+        log->record(f);
+    }
+    WebDashboardHandlers::setBlackbox(*log, ring, 1000);
+    ClosedLoopSim sim;
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), sim.controller().vehicleState());
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    // Two downloads in flight at once, plus a small request between them
+    const int csvFd = connectTo(port), rawFd = connectTo(port);
+    sendText(csvFd, "GET /api/log HTTP/1.1\r\n\r\n");
+    sendText(rawFd, "GET /api/blackbox HTTP/1.1\r\n\r\n");
+    CHECK_EQ(statusOf(get(port, "/api/receiver")), 200);
+    const std::string csv = readToEnd(csvFd), raw = bodyOf(readToEnd(rawFd));
+    close(csvFd);
+    close(rawFd);
+
+    CHECK_NE(csv.find("Content-Type: text/csv"), std::string::npos);
+    uint16_t hz = 0;
+    REQUIRE_EQ(readBlackboxHeader(reinterpret_cast<const uint8_t*>(raw.data()), raw.size(), hz), kBlackboxHeaderBytes);
+    CHECK_EQ(hz, 1000);
+    size_t frames = 0, pos = kBlackboxHeaderBytes;
+    while (pos + 2 <= raw.size()) {
+        const size_t len = static_cast<uint8_t>(raw[pos]) | static_cast<uint8_t>(raw[pos + 1]) << 8;
+        const uint8_t* seg = reinterpret_cast<const uint8_t*>(raw.data()) + pos + 2;
+        BlackboxDecoder decoder;
+        BlackboxFrame f;
+        for (size_t at = 0, used; (used = decoder.decode(seg + at, len - at, f)) != 0; at += used) ++frames;
+        pos += 2 + len;
+    }
+    CHECK_EQ(pos, raw.size());
+    const std::string body = bodyOf(csv);
+    CHECK_EQ(static_cast<size_t>(std::count(body.begin(), body.end(), '\n')), frames + 1); // + header
+    CHECK_NE(body.find("\n3000000,3000,"), std::string::npos); // newest row: t = 3 s
+}
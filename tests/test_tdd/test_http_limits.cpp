@@ -0,0 +1,71 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cstring>
+
+// What the server gives up on so that one client cannot hold slots forever
+namespace {
+// Endless download: only the server giving up ends it
+class EndlessBody : public IHttpBody {
+public:
+    int read(char* out, size_t cap, uint32_t) override {
+        std::memset(out, 'x', cap);
+        return static_cast<int>(cap);
+    }
+};
+void handleEndless(HttpExchange& server) { server.stream<EndlessBody>(200, "application/octet-stream"); }
+}
+
+TEST_CASE("Loopback: a client that stops reading its download loses the slot") {
+    HttpServer server; // polled by hand here, so the clock is exact
+    server.on(HttpMethod::Get, "/endless", handleEndless);
+    REQUIRE(server.begin(0));
+    const int stalled = connectTo(server.port(), 4096);
+    sendText(stalled, "GET /endless HTTP/1.1\r\n\r\n"); // and then never reads
+    for (int i = 0; i < 4000; ++i) server.poll(0); // fills every buffer on the way
+    CHECK_EQ(server.openConnections(), 1);
+    server.poll(HttpServer::kWriteStallTimeoutMs);
+    CHECK_EQ(server.openConnections(), 1);
+    server.poll(HttpServer::kWriteStallTimeoutMs + 1);
+    CHECK_EQ(server.openConnections(), 0);
+    readToEnd(stalled); // what was queued, then the close: the loop ends
+    close(stalled);
+}
+
+namespace {
+// The stream is open once its first line arrives
+int openStream(uint16_t port) {
+    const int fd = connectTo(port);
+    sendText(fd, "GET /api/stream?hz=50 HTTP/1.1\r\n\r\n");
+    std::string head;
+    char buf[256];
+    ssize_t n;
+    while (head.find("retry:") == std::string::npos && (n = recv(fd, buf, sizeof(buf), 0)) > 0) head.append(buf, n);
+    REQUIRE_EQ(statusOf(head), 200);
+    return fd;
+}
+}
+
+TEST_CASE("Loopback: SSE streams are capped below the connection limit") {
+    ClosedLoopSim sim;
+    VehicleStateLock state;
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), state);
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+    static_assert(WebDashboardHandlers::kMaxStreamClients < HttpServer::kMaxConnections, "no room left for the API");
+
+    int streams[WebDashboardHandlers::kMaxStreamClients];
+    for (int& fd : streams) fd = openStream(port);
+    CHECK_EQ(statusOf(get(port, "/api/stream")), 503);
+    CHECK_EQ(statusOf(get(port, "/api/imu")), 200); // the API still gets through
+    close(streams[0]);
+    VehicleState s;
+    for (int i = 0; i < 5; ++i) { // the next events find the peer gone
+        ++s.tick;
+        state.write(s);
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    }
+    streams[0] = openStream(port);
+    for (int fd : streams) close(fd);
+}
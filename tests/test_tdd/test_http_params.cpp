@@ -0,0 +1,65 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cstring>
+
+TEST_CASE("Loopback: PID parameters are read and written as one batch") {
+    ClosedLoopSim sim;
+    FlightParamsLock params;
+    params.write(FlightParams());
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), sim.controller().vehicleState());
+    WebDashboardHandlers::setParams(params);
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    const std::string all = bodyOf(get(port, "/api/pid"));
+    for (size_t i = 0; i < kParamCount; ++i) {
+        CHECK_NE(all.find("\"" + std::string(FlightParams::spec(static_cast<ParamId>(i)).key) + "\":"), std::string::npos);
+    }
+    CHECK_NE(all.find("\"y_ki\":12.000"), std::string::npos);
+
+    // One bad value rejects the whole batch
+    const std::string rejected = post(port, "/api/pid", "r_kp=1.2&r_kd=7&y_ki=8");
+    CHECK_EQ(statusOf(rejected), 400);
+    CHECK_NE(bodyOf(rejected).find("\"key\":\"r_kd\""), std::string::npos);
+    CHECK_EQ(params.read().get(ParamId::RollRateKp), FlightControlConstants::kDefaultRateKp);
+
+    CHECK_EQ(bodyOf(post(port, "/api/pid", "r_kp=1.2&r_kd=0.02&y_ki=8")),
+             "{\"status\":\"success\",\"saved\":true,\"pending\":false}");
+    const FlightParams live = params.read();
+    CHECK_EQ(live.get(ParamId::RollRateKp), 1.2f);
+    CHECK_EQ(live.get(ParamId::YawRateKi), 8.0f);
+    CHECK_EQ(live.get(ParamId::PitchRateKp), FlightControlConstants::kDefaultRateKp); // untouched
+    FlightParams stored;
+    REQUIRE(loadParams(stored));
+    CHECK_EQ(std::memcmp(stored.values, live.values, sizeof(live.values)), 0);
+
+    SUBCASE("While armed a batch goes live at once and reaches flash only after disarm") {
+        VehicleStateLock state;
+        VehicleState armed;
+        armed.rc[FlightControlConstants::ARM_CHANNEL] = 1600;
+        state.write(armed);
+        WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), state);
+
+        CHECK_EQ(bodyOf(post(port, "/api/pid", "y_kp=2.5")), "{\"status\":\"success\",\"saved\":false,\"pending\":true}");
+        CHECK_EQ(params.read().get(ParamId::YawRateKp), 2.5f);
+        WebDashboardHandlers::commitPendingParams(); // still armed: nothing written
+        REQUIRE(loadParams(stored));
+        CHECK_EQ(stored.get(ParamId::YawRateKp), FlightControlConstants::kDefaultYawKp);
+
+        armed.rc[FlightControlConstants::ARM_CHANNEL] = 1000;
+        state.write(armed);
+        WebDashboardHandlers::commitPendingParams();
+        REQUIRE(loadParams(stored));
+        CHECK_EQ(stored.get(ParamId::YawRateKp), 2.5f);
+
+        // persist=0: a try-out set that is never saved, even after landing
+        CHECK_EQ(bodyOf(post(port, "/api/pid", "y_kp=4&persist=0")), "{\"status\":\"success\",\"saved\":false,\"pending\":false}");
+        WebDashboardHandlers::commitPendingParams();
+        REQUIRE(loadParams(stored));
+        CHECK_EQ(stored.get(ParamId::YawRateKp), 2.5f);
+        CHECK_EQ(params.read().get(ParamId::YawRateKp), 4.0f);
+    }
+    REQUIRE(saveParams(FlightParams())); // the RAM store is shared by every test
+}
@@ -0,0 +1,62 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "network/WebAssets.h"
+#include "simulation/ClosedLoopSim.h"
+
+TEST_CASE("Loopback: dashboard routes answer through the real handlers") {
+    ClosedLoopSim sim;
+    sim.run(0.05f);
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), sim.controller().vehicleState());
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    const std::string page = get(port, "/");
+    CHECK_EQ(statusOf(page), 200);
+    CHECK_EQ(bodyOf(page), std::string(reinterpret_cast<const char*>(kWebAssets[0].data), kWebAssets[0].len));
+
+    const std::string rx = get(port, "/api/receiver");
+    CHECK_EQ(statusOf(rx), 200);
+    CHECK_EQ(bodyOf(rx), "{\"channels\":[1500,1500,1000,1500,1500,1500]}"); // from the VehicleState snapshot
+    CHECK_NE(bodyOf(get(port, "/api/imu")).find("\"g_y\":"), std::string::npos);
+
+    // Form body, URL-encoded; applied by the handler on the server thread
+    CHECK_EQ(bodyOf(post(port, "/api/receiver", "active=true&channelIdx=0&value=1600")), "{\"ok\":true}");
+    sim.receiver().readChannels();
+    CHECK_EQ(sim.receiver().getChannel(0), 1600);
+    CHECK_NE(bodyOf(post(port, "/api/calibrate", "cmd=not%20a%2Bcommand")).find("Invalid command"), std::string::npos);
+    CHECK_NE(bodyOf(post(port, "/api/calibrate", "cmd=beacon")).find("need DShot"), std::string::npos); // analog sim ESCs
+
+    CHECK_EQ(statusOf(get(port, "/nope")), 404);
+    CHECK_EQ(statusOf(post(port, "/api/imu", "")), 405);
+    CHECK_EQ(statusOf(roundTrip(port, "HELLO\r\n\r\n")), 400);
+    CHECK_EQ(statusOf(get(port, "/api/log?" + std::string(2000, 'a'))), 413);
+}
+
+TEST_CASE("Loopback: a stalled client neither blocks others nor holds its slot forever") {
+    ClosedLoopSim sim;
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), sim.controller().vehicleState());
+    LoopbackServer server;
+    REQUIRE(server.ok());
+    const uint16_t port = server.port();
+
+    const int stalled = connectTo(port);
+    sendText(stalled, "GET /api/receiver HTT"); // and then nothing
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i) CHECK_EQ(statusOf(get(port, "/api/imu")), 200);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    CHECK_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 500);
+
+    // Fill the remaining slots; one more client is turned away instead of queued
+    int idle[HttpServer::kMaxConnections - 1];
+    for (int& fd : idle) fd = connectTo(port);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK_EQ(statusOf(get(port, "/api/imu")), 503);
+
+    server.skewMs.store(HttpServer::kRequestTimeoutMs + 100);
+    char c;
+    CHECK_EQ(recv(stalled, &c, 1, 0), 0); // closed by the server, not by our 2 s timeout
+    for (int fd : idle) close(fd);
+    close(stalled);
+    CHECK_EQ(statusOf(get(port, "/api/imu")), 200);
+}
@@ -0,0 +1,71 @@
+#include "doctest.h"
+#include "loopback_server.h"
+#include "core/TelemetryPacket.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cstring>
+
+namespace {
+std::string base64Decode(const std::string& in) {
+    static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (char c : in) {
+        if (c == '=') break;
+        acc = (acc << 6) | static_cast<uint32_t>(std::strchr(table, c) - table);
+        bits += 6;
+        if (bits >= 8) { bits -= 8; out.push_back(static_cast<char>((acc >> bits) & 0xFF)); }
+    }
+    return out;
+}
+}
+
+TEST_CASE("Loopback: SSE stream pushes packed state at the requested rate") {
+    ClosedLoopSim sim;
+    VehicleStateLock state;
+    WebDashboardHandlers::init(sim.receiver(), sim.motors(), sim.battery(), state);
+    LoopbackServer server;
+    REQUIRE(server.ok());
+
+    std::atomic<bool> flying{true};
+    std::thread flight([&] {
+        VehicleState s;
+        while (flying.load()) {
+            ++s.tick;
+            s.voltage = static_cast<float>(s.tick % 3000) / 100.0f;
+            state.write(s);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    const int fd = connectTo(server.port());
+    sendText(fd, "GET /api/stream?hz=50 HTTP/1.1\r\nAccept: text/event-stream\r\n\r\n");
+    std::string text;
+    char buf[1024];
+    const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(400);
+    while (std::chrono::steady_clock::now() < until) {
+        const ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        text.append(buf, static_cast<size_t>(n));
+    }
+    close(fd);
+    flying.store(false);
+    flight.join();
+
+    CHECK_NE(text.find("Content-Type: text/event-stream"), std::string::npos);
+    int events = 0;
+    uint32_t lastTick = 0;
+    bool ordered = true;
+    for (size_t at = text.find("data:"); at != std::string::npos; at = text.find("data:", at + 5)) {
+        const size_t end = text.find("\n\n", at);
+        if (end == std::string::npos) break;
+        const std::string packet = base64Decode(text.substr(at + 5, end - at - 5));
+        VehicleState s;
+        REQUIRE(unpackTelemetry(reinterpret_cast<const uint8_t*>(packet.data()), packet.size(), s));
+        ordered = ordered && (events == 0 || s.tick > lastTick);
+        lastTick = s.tick;
+        ++events;
+    }
+    CHECK(ordered);
+    CHECK_GE(events, 10);
+    CHECK_LE(events, 22);
+}
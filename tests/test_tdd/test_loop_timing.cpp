@@ -0,0 +1,69 @@
+#include "doctest.h"
+#include "core/FlightController.h"
+#include "simulation/SimulatedHardware.h"
+
+namespace {
+uint32_t fakeNowUs = 0;
+uint32_t fakeClock() { return fakeNowUs += 10; } // every stage appears to take 10 µs
+} // namespace
+
+TEST_CASE("LoopTimingStats histogram and percentiles") {
+    LoopTimingStats stats;
+
+    SUBCASE("Log-linear buckets are contiguous and cover their values") {
+        CHECK_EQ(LoopTimingStats::bucketFor(0), 0);
+        CHECK_EQ(LoopTimingStats::bucketFor(3), 3);
+        for (uint32_t us = 0; us < 8192; ++us) {
+            int b = LoopTimingStats::bucketFor(us);
+            CHECK_LE(us, LoopTimingStats::bucketUpperUs(b));
+            if (b > 0) CHECK_GT(us, LoopTimingStats::bucketUpperUs(b - 1));
+        }
+        CHECK_EQ(LoopTimingStats::bucketFor(100000), LoopTimingStats::kBucketCount - 1);
+    }
+
+    SUBCASE("Min, max and percentiles track recorded samples") {
+        for (int i = 0; i < 98; ++i) stats.record(LoopStage::Pid, 20);
+        stats.record(LoopStage::Pid, 400);
+        stats.record(LoopStage::Pid, 3000);
+        StageTimingSnapshot s = stats.snapshot(LoopStage::Pid);
+        CHECK_EQ(s.count, 100u);
+        CHECK_EQ(s.minUs, 20u);
+        CHECK_EQ(s.maxUs, 3000u);
+        CHECK_EQ(s.p50Us, LoopTimingStats::bucketUpperUs(LoopTimingStats::bucketFor(20)));
+        CHECK_GE(s.p99Us, 400u);
+        CHECK_LE(s.p99Us, 3000u);
+    }
+
+    SUBCASE("Reset request is applied by the writer on its next record") {
+        stats.record(LoopStage::Total, 500);
+        stats.requestReset();
+        stats.record(LoopStage::Total, 50);
+        StageTimingSnapshot s = stats.snapshot(LoopStage::Total);
+        CHECK_EQ(s.count, 1u);
+        CHECK_EQ(s.maxUs, 50u);
+        CHECK_EQ(stats.snapshot(LoopStage::Mixer).count, 0u);
+    }
+}
+
+TEST_CASE("FlightController profiles each update() stage") {
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors motors;
+    SimulatedBatteryMonitor battery;
+    FlightController fc(imu, ppm, motors, battery);
+    fc.init();
+    fc.setTimingClock(&fakeClock);
+
+    ppm.setOverride(2, 1000); ppm.setOverride(4, 1600);
+    ppm.setOverrideActive(true);
+    fc.update(0.004f);          // arms
+    ppm.setOverride(2, 1500);
+    fc.update(0.004f);
+
+    CHECK_EQ(fc.timingStats().snapshot(LoopStage::ImuRead).count, 2u);
+    CHECK_EQ(fc.timingStats().snapshot(LoopStage::Estimator).count, 2u);
+    CHECK_EQ(fc.timingStats().snapshot(LoopStage::MotorWrite).count, 2u);
+    CHECK_EQ(fc.timingStats().snapshot(LoopStage::Pid).maxUs, 10u);
+    CHECK_GT(fc.timingStats().snapshot(LoopStage::Total).minUs, 50u);
+    CHECK_EQ(fc.timingStats().snapshot(LoopStage::TickLateness).count, 0u); // paced by the caller
+}
@@ -0,0 +1,117 @@
+#include "doctest.h"
+#include "core/MahonyEstimator.h"
+#include "core/KalmanFilter.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+
+namespace {
+constexpr float kDt = 0.004f; // 250 Hz attitude loop
+constexpr float kDegToRad = 0.0174532925f;
+
+// Earth field (north + down, world z up) seen in body axes at a pure yaw angle.
+void magAtYaw(float yawDeg, float m[3]) {
+    const float c = std::cos(yawDeg * kDegToRad), s = std::sin(yawDeg * kDegToRad);
+    m[0] = 0.22f * c; m[1] = -0.22f * s; m[2] = -0.42f;
+}
+}
+
+TEST_CASE("MahonyEstimator levels, aligns and integrates") {
+    MahonyEstimator est;
+    float roll, pitch;
+
+    SUBCASE("Level and still stays level") {
+        for (int i = 0; i < 1000; ++i) est.update(0, 0, 0, 0, 0, 1.0f, kDt);
+        est.getRollPitchDeg(roll, pitch);
+        CHECK_EQ(roll, doctest::Approx(0.0f).epsilon(0.001));
+        CHECK_EQ(pitch, doctest::Approx(0.0f).epsilon(0.001));
+    }
+
+    SUBCASE("alignToAccel recovers the Euler tilt of the gravity vector") {
+        float ax, ay, az;
+        accelFromAccAngles(20.0f, -10.0f, ax, ay, az);
+        est.alignToAccel(ax, ay, az);
+        est.getRollPitchDeg(roll, pitch);
+        // ZYX roll is atan2(ay, az); the accel-angle convention only matches it at zero pitch
+        CHECK_EQ(roll, doctest::Approx(std::atan2(ay, az) / kDegToRad).epsilon(0.001));
+        CHECK_EQ(pitch, doctest::Approx(-10.0f).epsilon(0.001));
+        CHECK_EQ(est.getYawDeg(), doctest::Approx(0.0f).epsilon(0.001));
+    }
+
+    SUBCASE("Accel pulls a wrong estimate in with ~1 s time constant") {
+        float ax, ay, az;
+        accelFromAccAngles(25.0f, 0.0f, ax, ay, az);
+        for (int i = 0; i < 1250; ++i) est.update(0, 0, 0, ax, ay, az, kDt); // 5 s
+        est.getRollPitchDeg(roll, pitch);
+        CHECK_EQ(roll, doctest::Approx(25.0f).epsilon(0.04));
+        CHECK_LT(std::fabs(pitch), 0.5f);
+    }
+
+    SUBCASE("Gyro alone integrates exactly (accel ignored off 1 g)") {
+        for (int i = 0; i < 125; ++i) est.update(90.0f, 0, 0, 0, 0, 0, kDt); // 0.5 s
+        est.getRollPitchDeg(roll, pitch);
+        CHECK_EQ(roll, doctest::Approx(45.0f).epsilon(0.001));
+    }
+}
+
+TEST_CASE("MahonyEstimator holds a coordinated turn where per-axis Kalman drifts") {
+    // 30° bank, 90°/s turn: body rates q = Ω·sinφ, r = Ω·cosφ; accel reads 1/cosφ g on z
+    const float bank = 30.0f, omega = 90.0f;
+    const float q = omega * std::sin(bank * kDegToRad), r = omega * std::cos(bank * kDegToRad);
+    const float az = 1.0f / std::cos(bank * kDegToRad);
+
+    MahonyEstimator est;
+    float ax0, ay0, az0;
+    accelFromAccAngles(bank, 0.0f, ax0, ay0, az0);
+    est.alignToAccel(ax0, ay0, az0);
+    KalmanFilter rollKf(bank), pitchKf(0.0f);
+
+    for (int i = 0; i < 1000; ++i) { // 4 s, 360° of heading
+        est.update(0.0f, q, r, 0.0f, 0.0f, az, kDt);
+        rollKf.update(0.0f, 0.0f, kDt);  // accel angles read level throughout the turn
+        pitchKf.update(q, 0.0f, kDt);
+    }
+    float roll, pitch;
+    est.getRollPitchDeg(roll, pitch);
+    CHECK_EQ(roll, doctest::Approx(bank).epsilon(0.02));
+    CHECK_LT(std::fabs(pitch), 0.5f);
+    CHECK_GT(std::fabs(rollKf.getState() - bank), 20.0f);
+    CHECK_GT(std::fabs(pitchKf.getState()), 20.0f);
+}
+
+TEST_CASE("MahonyEstimator takes yaw from the compass without tilting") {
+    MahonyConfig cfg;
+    cfg.ki = 0.0f; // no bias integral, so the 60° step settles without overshoot
+    MahonyEstimator est(cfg);
+    float m[3], roll, pitch;
+    magAtYaw(60.0f, m);
+    for (int i = 0; i < 2500; ++i) est.update(0, 0, 0, 0, 0, 1.0f, kDt, m); // 10 s
+    CHECK_EQ(est.getYawDeg(), doctest::Approx(60.0f).epsilon(0.01));
+    est.getRollPitchDeg(roll, pitch);
+    CHECK_LT(std::fabs(roll), 0.1f);
+    CHECK_LT(std::fabs(pitch), 0.1f);
+
+    SUBCASE("A field with a bogus vertical tilt cannot drag the horizon") {
+        const float disturbed[3] = {0.22f, 0.15f, -0.30f};
+        for (int i = 0; i < 2500; ++i) est.update(0, 0, 0, 0, 0, 1.0f, kDt, disturbed);
+        est.getRollPitchDeg(roll, pitch);
+        CHECK_LT(std::fabs(roll), 0.5f);
+        CHECK_LT(std::fabs(pitch), 0.5f);
+    }
+}
+
+TEST_CASE("FlightController estimates yaw from the simulated compass") {
+    ClosedLoopSimConfig cfg;
+    cfg.compass = true;
+    ClosedLoopSim sim(cfg);
+    sim.plant().setAttitudeDeg(0.0f, 0.0f, 45.0f);
+    sim.arm();                 // aligns roll/pitch from accel, yaw starts at 0
+    sim.setStick(2, 1450);     // rotors spinning (vibration on the sensors), still on the ground
+    sim.run(8.0f);
+
+    float r, p, y, pr, pp, py;
+    sim.controller().getAttitudeDeg(r, p, y);
+    sim.plant().getEulerDeg(pr, pp, py);
+    CHECK_LT(std::fabs(y - py), 3.0f);
+    CHECK_LT(std::fabs(r - pr), 1.0f);
+    CHECK_LT(std::fabs(p - pp), 1.0f);
+}
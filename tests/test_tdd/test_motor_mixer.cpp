@@ -0,0 +1,119 @@
+#include "doctest.h"
+#include "core/MotorMixer.h"
+#include "simulation/ClosedLoopSim.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+using K = FlightControlConstants;
+
+// The four hard-coded quad expressions and shift-clamp the mixer replaced
+void legacyQuadMix(float t, float r, float p, float y, int m[4]) {
+    m[0] = static_cast<int>(K::MIXING_SCALE * (t - r - p - y));
+    m[1] = static_cast<int>(K::MIXING_SCALE * (t - r + p + y));
+    m[2] = static_cast<int>(K::MIXING_SCALE * (t + r + p - y));
+    m[3] = static_cast<int>(K::MIXING_SCALE * (t + r - p + y));
+    int hi = m[0], lo = m[0];
+    for (int i = 1; i < 4; ++i) { if (m[i] > hi) hi = m[i]; if (m[i] < lo) lo = m[i]; }
+    if (hi > K::MOTOR_MAX_US)       { int d = hi - K::MOTOR_MAX_US;       for (int i = 0; i < 4; ++i) m[i] -= d; }
+    if (lo < K::MOTOR_MIN_ARMED_US) { int d = K::MOTOR_MIN_ARMED_US - lo; for (int i = 0; i < 4; ++i) m[i] += d; }
+    for (int i = 0; i < 4; ++i) m[i] = std::min(K::MOTOR_MAX_US, std::max(K::MOTOR_MIN_ARMED_US, m[i]));
+}
+
+// Roll/pitch/yaw the outputs command, as seen through the frame's own table
+void moments(const MixerTable& t, const int m[], float out[3]) {
+    out[0] = out[1] = out[2] = 0.0f;
+    for (uint8_t i = 0; i < t.motors; ++i) {
+        out[0] += t.rows[i].roll * m[i]; out[1] += t.rows[i].pitch * m[i]; out[2] += t.rows[i].yaw * m[i];
+    }
+}
+}
+
+TEST_CASE("QuadX table reproduces the original hard-coded mix") {
+    MotorMixer mixer;
+    REQUIRE_EQ(mixer.motorCount(), 4);
+    const float cases[][4] = {{1500, 0, 0, 0}, {1400, 37.5f, -12.25f, 8}, {1800, 300, 150, -90},
+                              {1100, -200, 60, 40}, {1650, 0.4f, -0.6f, 0.2f}, {1950, -5, 500, 500}};
+    for (const auto& c : cases) {
+        int expected[4], m[MotorMixer::kMaxMotors];
+        legacyQuadMix(c[0], c[1], c[2], c[3], expected);
+        mixer.mix(c[0], c[1], c[2], c[3], m);
+        for (int i = 0; i < 4; ++i) CHECK_EQ(m[i], expected[i]);
+        for (int i = 4; i < MotorMixer::kMaxMotors; ++i) CHECK_EQ(m[i], K::MOTOR_OFF_US);
+    }
+}
+
+TEST_CASE("Every frame turns one axis command into that axis only") {
+    for (FrameType frame : {FrameType::QuadX, FrameType::QuadPlus, FrameType::HexX, FrameType::OctoX}) {
+        MotorMixer mixer(frame);
+        const MixerTable& t = mixerTable(frame);
+        CAPTURE(static_cast<int>(frame));
+        for (int axis = 0; axis < 3; ++axis) {
+            const float cmd[3] = {axis == 0 ? 100.0f : 0.0f, axis == 1 ? 100.0f : 0.0f, axis == 2 ? 100.0f : 0.0f};
+            int m[MotorMixer::kMaxMotors];
+            mixer.mix(1500.0f, cmd[0], cmd[1], cmd[2], m);
+            float mom[3];
+            moments(t, m, mom);
+            for (int other = 0; other < 3; ++other) {
+                if (other == axis) CHECK_GT(mom[other], 100.0f);
+                else CHECK_LT(std::fabs(mom[other]), 0.02f * mom[axis] + t.motors); // int truncation only
+            }
+            int sum = 0;
+            for (uint8_t i = 0; i < t.motors; ++i) sum += m[i];
+            CHECK_EQ(sum / static_cast<float>(t.motors), doctest::Approx(1.024f * 1500.0f).epsilon(0.002));
+        }
+    }
+}
+
+TEST_CASE("Desaturation shifts all N outputs and keeps the correction") {
+    MotorMixer hex(FrameType::HexX);
+    int free[MotorMixer::kMaxMotors], high[MotorMixer::kMaxMotors], low[MotorMixer::kMaxMotors];
+    hex.mix(1400.0f, 120.0f, -60.0f, 30.0f, free);
+    hex.mix(1900.0f, 120.0f, -60.0f, 30.0f, high); // top motors would exceed 2000
+    hex.mix(1050.0f, 120.0f, -60.0f, 30.0f, low);  // bottom motors would drop below idle
+    int hiMax = 0, loMin = 3000;
+    for (int i = 0; i < 6; ++i) { hiMax = std::max(hiMax, high[i]); loMin = std::min(loMin, low[i]); }
+    CHECK_EQ(hiMax, K::MOTOR_MAX_US);
+    CHECK_EQ(loMin, K::MOTOR_MIN_ARMED_US);
+    for (int i = 1; i < 6; ++i) { // same differential, shifted (±1 µs of truncation)
+        CHECK_LE(std::abs((high[i] - high[0]) - (free[i] - free[0])), 1);
+        CHECK_LE(std::abs((low[i] - low[0]) - (free[i] - free[0])), 1);
+    }
+    CHECK_EQ(high[6], K::MOTOR_OFF_US);
+    CHECK_EQ(high[7], K::MOTOR_OFF_US);
+}
+
+TEST_CASE("FlightController flies a hex frame in the closed-loop sim") {
+    SimulatedIMU imu;
+    SimulatedPPMReceiver ppm;
+    SimulatedMotors quadEscs;
+    SimulatedBatteryMonitor battery;
+    FlightController fc(imu, ppm, quadEscs, battery);
+    CHECK_FALSE(fc.setFrame(FrameType::HexX)); // four ESC outputs can't drive six motors
+    CHECK(fc.mixer().frame() == FrameType::QuadX);
+
+    ClosedLoopSimConfig config;
+    config.quad.frame = FrameType::HexX;
+    config.quad.massKg = 1.35f; // same thrust per motor at hover as the quad default
+    ClosedLoopSim sim(config);
+    REQUIRE(sim.controller().mixer().frame() == FrameType::HexX);
+    sim.arm();
+    CHECK_FALSE(sim.controller().setFrame(FrameType::QuadX)); // armed
+    sim.setStick(2, 1650);
+    sim.run(2.0f);
+    float r, p, y;
+    sim.plant().getEulerDeg(r, p, y);
+    CHECK_GT(sim.plant().getAltitudeM(), 0.5f);
+    CHECK_LT(std::fabs(r), 3.0f);
+    CHECK_LT(std::fabs(p), 3.0f);
+    CHECK_EQ(sim.controller().vehicleState().read().motorCount, 6);
+
+    sim.plant().setBodyRatesDeg(200.0f, -150.0f, 0.0f);
+    sim.run(0.5f);
+    sim.plant().getBodyRatesDeg(r, p, y);
+    CHECK_LT(std::fabs(r), 20.0f);
+    CHECK_LT(std::fabs(p), 20.0f);
+    sim.disarm();
+    for (int i = 0; i < 6; ++i) CHECK_EQ(sim.motors().getMotorOutput(i), K::MOTOR_OFF_US);
+}
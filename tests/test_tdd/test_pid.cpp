@@ -79,3 +79,38 @@ TEST_CASE("PIDController basic calculations and constraints") {
         CHECK_EQ(out2, doctest::Approx(-3.125f));
     }
 }
+
+TEST_CASE("PIDController I-term guards") {
+    SUBCASE("Back-calculation bleeds a saturating I-term toward zero, never past it") {
+        PIDController pid(0.0f, 10.0f, 0.0f);
+        pid.setAntiWindup(50.0f);
+        pid.update(100.0f, 0.0f, 0.004f);
+        pid.update(100.0f, 0.0f, 0.004f);         // I = 2 + 4 = 6
+        pid.applySaturation(6.0f, 6.0f, 0.004f);  // carried in full: untouched
+        CHECK_EQ(pid.getIterm(), doctest::Approx(6.0f));
+        pid.applySaturation(6.0f, 1.0f, 0.004f);  // 50 · 0.004 · (1 − 6) = −1
+        CHECK_EQ(pid.getIterm(), doctest::Approx(5.0f));
+        pid.applySaturation(6.0f, -400.0f, 0.004f); // would overshoot to −76: stops at zero
+        CHECK_EQ(pid.getIterm(), 0.0f);
+
+        PIDController against(0.0f, 10.0f, 0.0f); // I opposing the clipped direction is left alone
+        against.setAntiWindup(50.0f);
+        against.update(-100.0f, 0.0f, 0.004f);
+        against.applySaturation(300.0f, 200.0f, 0.004f);
+        CHECK_EQ(against.getIterm(), doctest::Approx(-2.0f));
+    }
+
+    SUBCASE("I-term relax freezes I while the setpoint moves fast") {
+        PIDController relaxed(0.0f, 10.0f, 0.0f), plain(0.0f, 10.0f, 0.0f);
+        relaxed.setItermRelax(40.0f);
+        relaxed.setItermRelaxCutoff(15.0f, 250.0f);
+        relaxed.update(200.0f, 0.0f, 0.004f); // setpoint steps 0 → 200 deg/s
+        plain.update(200.0f, 0.0f, 0.004f);
+        CHECK_EQ(relaxed.getIterm(), 0.0f);
+        CHECK_EQ(plain.getIterm(), doctest::Approx(4.0f));
+        for (int i = 0; i < 100; ++i) relaxed.update(10.0f, 190.0f, 0.004f); // setpoint settled at 200
+        const float before = relaxed.getIterm();
+        relaxed.update(10.0f, 190.0f, 0.004f);
+        CHECK_EQ(relaxed.getIterm() - before, doctest::Approx(0.4f)); // full rate again
+    }
+}
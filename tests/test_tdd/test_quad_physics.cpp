@@ -0,0 +1,105 @@
+#include "doctest.h"
+#include "simulation/ClosedLoopSim.h"
+
+TEST_CASE("QuadPhysics open-loop plant behaviour") {
+    QuadPhysics plant;
+
+    SUBCASE("Stays on the ground with motors at idle") {
+        const int idle[4] = {1000, 1000, 1000, 1000};
+        for (int i = 0; i < 4000; ++i) plant.step(0.00025f, idle);
+        CHECK(plant.isGrounded());
+        CHECK_EQ(plant.getAltitudeM(), 0.0f);
+        float ax, ay, az;
+        plant.getSpecificForceG(ax, ay, az);
+        CHECK_EQ(az, doctest::Approx(1.0f)); // accelerometer reads +1 g at rest
+    }
+
+    SUBCASE("Thrust curve brackets hover weight around mid-stick") {
+        const float weight = plant.params().massKg * 9.80665f;
+        CHECK_LT(4.0f * plant.thrustForCommand(1500), weight);
+        CHECK_GT(4.0f * plant.thrustForCommand(1600), weight);
+        CHECK_EQ(plant.thrustForCommand(1000), 0.0f);
+    }
+
+    SUBCASE("Collective thrust above weight climbs, differential thrust rolls and pitches") {
+        const int climb[4] = {1700, 1700, 1700, 1700};
+        for (int i = 0; i < 4000; ++i) plant.step(0.00025f, climb);
+        CHECK_GT(plant.getAltitudeM(), 0.5f);
+
+        const int rollRight[4] = {1650, 1650, 1750, 1750}; // left motors (3/4) harder
+        for (int i = 0; i < 200; ++i) plant.step(0.00025f, rollRight);
+        float r, p, y;
+        plant.getBodyRatesDeg(r, p, y);
+        CHECK_GT(r, 10.0f);
+        CHECK_EQ(p, doctest::Approx(0.0f).epsilon(0.01));
+
+        const int noseUp[4] = {1650, 1750, 1750, 1650};    // front motors (2/3) harder
+        plant.setBodyRatesDeg(0.0f, 0.0f, 0.0f);
+        for (int i = 0; i < 200; ++i) plant.step(0.00025f, noseUp);
+        plant.getBodyRatesDeg(r, p, y);
+        CHECK_GT(p, 10.0f);
+    }
+}
+
+TEST_CASE("ClosedLoopSim drives FlightController against the plant") {
+    ClosedLoopSim sim;
+    sim.arm();
+    sim.setStick(2, 1650);
+
+    SUBCASE("Takes off and holds level attitude") {
+        sim.run(3.0f);
+        float r, p, y;
+        sim.plant().getEulerDeg(r, p, y);
+        CHECK_GT(sim.plant().getAltitudeM(), 0.5f);
+        CHECK_LT(std::fabs(r), 3.0f);
+        CHECK_LT(std::fabs(p), 3.0f);
+    }
+
+    SUBCASE("Rejects an impulsive roll disturbance") {
+        sim.run(1.0f);
+        sim.plant().setBodyRatesDeg(200.0f, 0.0f, 0.0f);
+        sim.run(0.5f);
+        float r, p, y;
+        sim.plant().getBodyRatesDeg(r, p, y);
+        CHECK_LT(std::fabs(r), 20.0f); // rate loop has killed the spin
+        sim.plant().getEulerDeg(r, p, y);
+        CHECK_LT(std::fabs(r), 15.0f); // and the bank it left is bounded
+    }
+
+    SUBCASE("Roll stick commands a right bank") {
+        sim.run(1.0f);
+        sim.setStick(0, 1600); // +10 deg requested
+        sim.run(1.0f);
+        float r, p, y;
+        sim.plant().getEulerDeg(r, p, y);
+        CHECK_GT(r, 5.0f);
+        CHECK_LT(r, 20.0f);
+    }
+
+    SUBCASE("Disarm cuts the motors") {
+        sim.run(0.5f);
+        sim.disarm();
+        CHECK_EQ(sim.motors().getMotorOutput(0), 1000);
+    }
+}
+
+TEST_CASE("ClosedLoopSim flies the multi-rate loop at 1 kHz") {
+    ClosedLoopSimConfig config;
+    config.rates.gyroHz = 1000;
+    config.rates.attitudeDivider = 4;
+    config.rates.rcDivider = 4;
+    config.rates.logDivider = 20;
+    ClosedLoopSim sim(config);
+    sim.arm();
+    sim.setStick(2, 1650);
+    sim.run(1.0f);
+    sim.plant().setBodyRatesDeg(200.0f, 0.0f, 0.0f);
+    sim.run(0.5f);
+
+    float r, p, y;
+    sim.plant().getBodyRatesDeg(r, p, y);
+    CHECK_LT(std::fabs(r), 20.0f);
+    sim.plant().getEulerDeg(r, p, y);
+    CHECK_LT(std::fabs(r), 15.0f);
+    CHECK_GT(sim.plant().getAltitudeM(), 0.5f);
+}
@@ -58,7 +58,8 @@ TEST_CASE("SimulatedHardware overrides and telemetry inject") {
     SUBCASE("Simulated Motor command tracking and output override") {
         SimulatedMotors motors;
         
-        motors.writeMotors(1200, 1300, 1400, 1500);
+        const int cmd[4] = {1200, 1300, 1400, 1500};
+        motors.writeMotors(cmd, 4);
         CHECK_EQ(motors.getMotorOutput(0), 1200);
         CHECK_EQ(motors.getMotorOutput(3), 1500);
         
@@ -0,0 +1,128 @@
+#include "doctest.h"
+#include "core/FlightTelemetry.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace {
+struct Sample {
+    uint32_t seq;
+    uint32_t check; // derived from seq: a torn slot copy fails the comparison
+};
+
+uint32_t checkOf(uint32_t seq) { return seq * 2654435761u ^ 0xA5A5A5A5u; }
+}
+
+TEST_CASE("SpscRing delivers every accepted item in order across two threads") {
+    auto ring = std::make_unique<SpscRing<Sample, 64>>();
+    constexpr uint32_t kItems = 1000000;
+    std::atomic<bool> done{false};
+    uint32_t received = 0, outOfOrder = 0, torn = 0, lastSeq = 0;
+
+    std::thread consumer([&] {
+        Sample s;
+        for (;;) {
+            if (!ring->pop(s)) {
+                if (done.load(std::memory_order_acquire) && ring->size() == 0) break;
+                std::this_thread::yield();
+                continue;
+            }
+            if (s.check != checkOf(s.seq)) ++torn;
+            if (received && s.seq <= lastSeq) ++outOfOrder;
+            lastSeq = s.seq;
+            ++received;
+        }
+    });
+    std::thread producer([&] {
+        for (uint32_t seq = 1; seq <= kItems; ++seq) {
+            while (!ring->push(Sample{seq, checkOf(seq)})) std::this_thread::yield();
+        }
+        done.store(true, std::memory_order_release);
+    });
+    producer.join();
+    consumer.join();
+
+    CHECK_EQ(torn, 0u);
+    CHECK_EQ(outOfOrder, 0u);
+    CHECK_EQ(received, kItems);
+    CHECK_EQ(ring->pushed(), kItems);
+}
+
+TEST_CASE("SpscRing rejects when full and keeps a peeked item queued") {
+    SpscRing<Sample, 4> ring;
+    for (uint32_t seq = 1; seq <= 6; ++seq) ring.push(Sample{seq, checkOf(seq)});
+    CHECK_EQ(ring.size(), 4u);
+    CHECK_EQ(ring.dropped(), 2u);
+
+    Sample s{};
+    REQUIRE(ring.peek(s));
+    CHECK_EQ(s.seq, 1u);
+    REQUIRE(ring.peek(s)); // not consumed until pop()
+    CHECK_EQ(s.seq, 1u);
+    ring.pop();
+    CHECK(ring.push(Sample{7, checkOf(7)}));
+    for (uint32_t want : {2u, 3u, 4u, 7u}) {
+        REQUIRE(ring.pop(s));
+        CHECK_EQ(s.seq, want);
+    }
+    CHECK_FALSE(ring.pop(s));
+}
+
+TEST_CASE("Telemetry drain keeps the blackbox contiguous while a download copies segments") {
+    auto ring = std::make_unique<TelemetryRing>();
+    auto log = std::make_unique<BlackboxLog>();
+    constexpr uint32_t kFrames = 40000;
+    std::atomic<bool> flightDone{false}, drainDone{false};
+    std::atomic<int> torn{0};
+
+    // Flight core: one frame per tick, never blocks
+    std::thread flight([&] {
+        for (uint32_t loop = 1; loop <= kFrames; ++loop) {
+            BlackboxFrame f;
+            f[BlackboxField::Iteration] = static_cast<int32_t>(loop);
+            f[BlackboxField::Throttle] = static_cast<int32_t>(1000 + loop % 1000);
+            while (ring->size() > TelemetryRing::kCapacity / 2) std::this_thread::yield(); // drain keeps up on target
+            ring->push(f);
+        }
+        flightDone.store(true);
+    });
+    // Telemetry task: sole ring consumer and sole log writer
+    std::thread drain([&] {
+        while (!flightDone.load() || ring->size()) {
+            if (!drainTelemetry(*ring, *log)) std::this_thread::yield();
+        }
+        drainDone.store(true);
+    });
+    // Web task: copies the live segment over and over
+    std::thread web([&] {
+        uint8_t seg[BlackboxLog::kSegmentBytes];
+        while (!drainDone.load()) {
+            const uint16_t len = log->copySegment(log->currentSegment(), seg);
+            BlackboxDecoder decoder;
+            BlackboxFrame f;
+            size_t pos = 0, used;
+            int32_t prev = -1;
+            while ((used = decoder.decode(seg + pos, len - pos, f)) != 0) {
+                if (prev >= 0 && f[BlackboxField::Iteration] != prev + 1) torn.fetch_add(1);
+                prev = f[BlackboxField::Iteration];
+                pos += used;
+            }
+            if (pos != len) torn.fetch_add(1);
+        }
+    });
+    flight.join();
+    drain.join();
+    web.join();
+
+    CHECK_EQ(torn.load(), 0);
+    CHECK_EQ(ring->dropped(), 0u);
+    CHECK_EQ(log->framesRecorded(), kFrames);
+
+    uint8_t seg[BlackboxLog::kSegmentBytes];
+    const uint16_t len = log->copySegment(log->currentSegment(), seg);
+    BlackboxDecoder decoder;
+    BlackboxFrame f, last;
+    size_t pos = 0, used;
+    while ((used = decoder.decode(seg + pos, len - pos, f)) != 0) { pos += used; last = f; }
+    CHECK_EQ(last[BlackboxField::Iteration], static_cast<int32_t>(kFrames));
+}
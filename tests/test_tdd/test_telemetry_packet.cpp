@@ -0,0 +1,92 @@
+#include "doctest.h"
+#include "core/TelemetryPacket.h"
+#include <cstring>
+#include <string>
+
+namespace {
+VehicleState sampleState() {
+    VehicleState s;
+    s.tick = 0x01020304u;
+    s.attitude = quaternionFromEulerDeg(12.345f, -7.5f, 179.99f);
+    accelFromAccAngles(11.9f, -7.26f, s.accel[0], s.accel[1], s.accel[2]);
+    s.gyro[0] = 250.04f; s.gyro[1] = -33.3f; s.gyro[2] = 0.05f;
+    const int16_t rc[VehicleState::kChannels] = {1600, 1500, 1450, 1500, 2000, 1000};
+    const int16_t motors[VehicleState::kMotors] = {1320, 1410, 1500, 1390};
+    std::memcpy(s.rc, rc, sizeof(rc));
+    std::memcpy(s.motors, motors, sizeof(motors));
+    s.voltage = 11.437f;
+    s.armed = true;
+    return s;
+}
+
+std::string base64Decode(const char* in, size_t len) {
+    std::string out;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (size_t i = 0; i < len && in[i] != '='; ++i) {
+        const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        acc = (acc << 6) | static_cast<uint32_t>(std::strchr(table, in[i]) - table);
+        bits += 6;
+        if (bits >= 8) { bits -= 8; out.push_back(static_cast<char>((acc >> bits) & 0xFF)); }
+    }
+    return out;
+}
+}
+
+TEST_CASE("Telemetry packets round-trip a VehicleState at wire resolution") {
+    const VehicleState in = sampleState();
+    uint8_t packet[kTelemetryPacketBytes];
+    packTelemetry(in, packet);
+    CHECK_EQ(packet[0], kTelemetryPacketVersion);
+    CHECK_EQ(packet[1], 0x04); // little-endian tick
+
+    VehicleState out;
+    REQUIRE(unpackTelemetry(packet, sizeof(packet), out));
+    CHECK_EQ(out.tick, in.tick);
+    float roll, pitch, yaw, accRoll, accPitch; // Euler on the wire, converted from the snapshot
+    out.attitudeDeg(roll, pitch, yaw);
+    out.accAnglesDeg(accRoll, accPitch);
+    CHECK_EQ(roll, doctest::Approx(12.35f).epsilon(1e-4));
+    CHECK_EQ(pitch, doctest::Approx(-7.5f).epsilon(1e-4));
+    CHECK_EQ(yaw, doctest::Approx(179.99f).epsilon(1e-4));
+    CHECK_EQ(accRoll, doctest::Approx(11.9f).epsilon(1e-4));
+    CHECK_EQ(accPitch, doctest::Approx(-7.26f).epsilon(1e-4));
+    CHECK_EQ(out.gyro[0], doctest::Approx(250.0f));
+    CHECK_EQ(out.gyro[2], doctest::Approx(0.1f));
+    for (int i = 0; i < VehicleState::kChannels; ++i) CHECK_EQ(out.rc[i], in.rc[i]);
+    for (int i = 0; i < VehicleState::kMotors; ++i) CHECK_EQ(out.motors[i], in.motors[i]);
+    CHECK_EQ(out.voltage, doctest::Approx(11.437f));
+    CHECK(out.armed);
+    CHECK_FALSE(out.signalLost);
+
+    SUBCASE("Saturates instead of wrapping and rejects foreign packets") {
+        VehicleState wild = in;
+        wild.gyro[1] = -5000.0f;  // beyond ±3276.7 °/s
+        wild.voltage = -1.0f;
+        packTelemetry(wild, packet);
+        REQUIRE(unpackTelemetry(packet, sizeof(packet), out));
+        CHECK_EQ(out.gyro[1], doctest::Approx(-3276.8f));
+        CHECK_EQ(out.voltage, 0.0f);
+        packet[0] = 9;
+        CHECK_FALSE(unpackTelemetry(packet, sizeof(packet), out));
+        CHECK_FALSE(unpackTelemetry(packet, kTelemetryPacketBytes - 1, out));
+    }
+}
+
+TEST_CASE("SSE telemetry event carries the packed frame in base64") {
+    const VehicleState in = sampleState();
+    char event[kTelemetryEventBytes + 1];
+    const size_t n = formatTelemetryEvent(in, event, sizeof(event));
+    REQUIRE_EQ(n, kTelemetryEventBytes);
+    CHECK_EQ(std::strncmp(event, "data:", 5), 0);
+    CHECK_EQ(std::string(event + n - 2), "\n\n");
+    CHECK_LE(n, 80u); // per sample, vs a ~60 B JSON body plus an HTTP request/response per poll
+
+    const std::string bytes = base64Decode(event + 5, n - 7);
+    REQUIRE_EQ(bytes.size(), kTelemetryPacketBytes);
+    uint8_t packet[kTelemetryPacketBytes];
+    packTelemetry(in, packet);
+    CHECK_EQ(std::memcmp(bytes.data(), packet, sizeof(packet)), 0);
+
+    CHECK_EQ(formatTelemetryEvent(in, event, kTelemetryEventBytes), 0u); // no room for '\0'
+}
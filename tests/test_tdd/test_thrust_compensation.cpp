@@ -0,0 +1,86 @@
+#include "doctest.h"
+#include "core/ThrustCompensation.h"
+#include "simulation/ClosedLoopSim.h"
+#include <cmath>
+
+namespace {
+// Relay autotune's Ku on roll: inversely proportional to the loop's plant gain
+float measureRollKu(float packVolts, bool compensate) {
+    ClosedLoopSim sim;
+    sim.battery().setOverride(packVolts);
+    sim.battery().setOverrideActive(true);
+    ThrustCompensationConfig config;
+    config.sagCompensation = compensate;
+    REQUIRE(sim.controller().setThrustCompensation(config));
+    sim.arm();
+    sim.setStick(2, 1700);
+    sim.run(1.5f);
+    FlightController& fc = sim.controller();
+    fc.autotune().request(0);
+    for (int i = 0; i < 3000 && fc.autotune().result().state != AutotuneState::Done
+                    && fc.autotune().result().state != AutotuneState::Failed; ++i) {
+        sim.stepControl();
+    }
+    const AutotuneResult r = fc.autotune().result();
+    REQUIRE(r.state == AutotuneState::Done);
+    CHECK_GT(sim.plant().getAltitudeM(), 0.2f);
+    return r.ultimateGain;
+}
+}
+
+TEST_CASE("Thrust curve inverse and voltage scale follow the plant") {
+    ThrustCompensationConfig config;
+    config.linearize = true;
+    ThrustCompensation comp;
+    REQUIRE(comp.configure(config, 1000.0f));
+    for (float u = 0.0f; u <= 1.0f; u += 0.05f) CHECK_EQ(comp.curveCommand(comp.curveThrust(u)), doctest::Approx(u).epsilon(0.01));
+
+    // Linearized commands make the plant's thrust proportional to the mixer output
+    QuadPhysics plant;
+    const float maxN = plant.params().maxThrustN;
+    comp.updateVoltage(11.1f);
+    for (int us = 1200; us <= 1900; us += 100) {
+        CHECK_EQ(plant.thrustForCommand(comp.apply(us)) / maxN, doctest::Approx((us - 1000) / 1000.0f).epsilon(0.02));
+        CHECK_LE(std::abs(comp.apply(comp.inputFor(us)) - us), 2);
+    }
+
+    SUBCASE("Sag scaling restores nominal thrust on a low pack") {
+        ThrustCompensationConfig sag; // commands stay commands, only the voltage is corrected
+        sag.sagCompensation = true;
+        REQUIRE(comp.configure(sag, 1000.0f));
+        plant.setPackVoltage(9.6f);
+        for (int i = 0; i < 3000; ++i) comp.updateVoltage(9.6f); // PT1 settles
+        CHECK_EQ(comp.thrustScale(), doctest::Approx((11.1f * 11.1f) / (9.6f * 9.6f)).epsilon(0.01));
+        QuadPhysics nominal;
+        for (int us = 1200; us <= 1700; us += 100) {
+            CHECK_EQ(plant.thrustForCommand(comp.apply(us)), doctest::Approx(nominal.thrustForCommand(us)).epsilon(0.03));
+        }
+        comp.updateVoltage(4.0f); // USB power, no pack
+        CHECK_EQ(comp.thrustScale(), 1.0f);
+    }
+
+    SUBCASE("A pack above the reference keeps full thrust") {
+        ThrustCompensationConfig sag;
+        sag.sagCompensation = true;
+        REQUIRE(comp.configure(sag, 1000.0f));
+        for (int i = 0; i < 3000; ++i) comp.updateVoltage(12.6f); // fresh 3S
+        CHECK_EQ(comp.thrustScale(), 1.0f);
+        CHECK_EQ(comp.apply(2000), 2000);
+        CHECK_LE(std::abs(comp.apply(1500) - 1500), 2); // inverse LUT rounding only
+    }
+
+    SUBCASE("A curve that is not rising is refused") {
+        ThrustCompensationConfig bad = config;
+        bad.thrust[5] = bad.thrust[4];
+        CHECK_FALSE(comp.configure(bad, 1000.0f));
+        CHECK_FALSE(comp.active());
+    }
+}
+
+TEST_CASE("Sag compensation holds the rate-loop gain as the pack drops") {
+    const float full = measureRollKu(11.1f, false);
+    const float sagged = measureRollKu(9.6f, false);
+    const float compensated = measureRollKu(9.6f, true);
+    CHECK_GT(sagged / full, 1.1f); // thrust per µs down by (9.6/11.1)² ≈ 0.75; motor lag blunts Ku's share
+    CHECK_EQ(compensated / full, doctest::Approx(1.0f).epsilon(0.04));
+}
@@ -0,0 +1,51 @@
+// Native blackbox → CSV converter for logs saved from GET /api/blackbox.
+//
+//   g++ -std=c++17 -I include -o blackbox_decode tools/blackbox_decode.cpp
+//       src/core/BlackboxCodec.cpp src/core/BlackboxCsv.cpp        (one command line)
+//   ./blackbox_decode blackbox.bbl > flight.csv
+//
+// Decoding statistics go to stderr so stdout stays pure CSV.
+#include "core/BlackboxCodec.h"
+#include "core/BlackboxCsv.h"
+#include <cstdio>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc != 2) { std::fprintf(stderr, "usage: %s <blackbox.bbl>\n", argv[0]); return 2; }
+    std::FILE* in = std::fopen(argv[1], "rb");
+    if (!in) { std::perror(argv[1]); return 1; }
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), in)) > 0) data.insert(data.end(), chunk, chunk + got);
+    std::fclose(in);
+
+    uint16_t loopHz = 0;
+    size_t pos = readBlackboxHeader(data.data(), data.size(), loopHz);
+    if (!pos) { std::fprintf(stderr, "%s: not a blackbox v%u log\n", argv[1], kBlackboxVersion); return 1; }
+
+    char line[kBlackboxCsvRowBytes];
+    blackboxCsvHeader(line, sizeof(line));
+    std::fputs(line, stdout);
+
+    BlackboxDecoder decoder;
+    BlackboxFrame frame;
+    unsigned long frames = 0, segments = 0, corrupt = 0;
+    while (pos + 2 <= data.size()) {
+        const size_t len = data[pos] | (data[pos + 1] << 8);
+        pos += 2;
+        if (pos + len > data.size()) { ++corrupt; break; }
+        decoder.restart();
+        size_t off = 0, used;
+        while (off < len && (used = decoder.decode(&data[pos + off], len - off, frame)) != 0) {
+            off += used;
+            if (blackboxCsvRow(frame, loopHz, line, sizeof(line))) std::fputs(line, stdout);
+            ++frames;
+        }
+        if (off != len) ++corrupt; // rest of this segment is unreadable; resync on the next
+        pos += len;
+        ++segments;
+    }
+    std::fprintf(stderr, "%lu frames, %lu segments, %lu corrupt, %u Hz loop\n", frames, segments, corrupt, loopHz);
+    return corrupt ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+"""Minify and gzip the dashboard in web/ into include/network/WebAssets.h.
+
+Runs before every PlatformIO build (extra_scripts = pre:tools/build_web_assets.py) and
+standalone:
+
+    python3 tools/build_web_assets.py
+
+index.html references app.css / app.js with ?v=<content hash>, so those two can be cached
+forever and index.html revalidates with a 304. The header is rewritten only when its
+content changes, so untouched assets never trigger a rebuild.
+"""
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO / SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUT = os.path.join(PROJECT_DIR, "include", "network", "WebAssets.h")
+IMMUTABLE = "public, max-age=31536000, immutable"
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{}:;,>])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+def minify_js(text):
+    # Conservative: keep line breaks (no reliance on ASI rules), drop indentation,
+    # blank lines and whole-line // comments. Nothing inside a line is touched.
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line and not line.startswith("//"))
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    out = ""
+    for line in (l.strip() for l in text.splitlines()):
+        if not line:
+            continue
+        if out and not (out.endswith(">") and line.startswith("<")):
+            out += " "
+        out += line
+    return out
+
+
+def gz(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)  # mtime=0: reproducible bytes
+
+
+def etag(data):
+    return hashlib.sha1(data).hexdigest()[:12]
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def build():
+    assets = []  # (path, content type, cache control, raw size, minified size, gzip bytes)
+    versions = {}
+    for name, ctype, minify in (("app.css", "text/css", minify_css),
+                                ("app.js", "application/javascript", minify_js)):
+        raw = read(name)
+        small = minify(raw).encode()
+        packed = gz(small)
+        versions[name] = etag(packed)
+        assets.append(("/" + name, ctype, IMMUTABLE, len(raw.encode()), len(small), packed))
+
+    raw = read("index.html")
+    html = raw
+    for name, version in versions.items():
+        html = html.replace('"/%s"' % name, '"/%s?v=%s"' % (name, version))
+    small = minify_html(html).encode()
+    assets.insert(0, ("/", "text/html", "no-cache", len(raw.encode()), len(small), gz(small)))
+
+    out = ["// Generated by tools/build_web_assets.py from web/ - edit those files, not this one.",
+           "#ifndef WEBASSETS_H", "#define WEBASSETS_H", "", '#include "network/HttpTypes.h"', ""]
+    for i, (path, _, _, raw_len, small_len, packed) in enumerate(assets):
+        out.append("// %s: %d B source, %d B minified, %d B gzip" % (path, raw_len, small_len, len(packed)))
+        out.append("alignas(4) static const uint8_t kWebAsset%d[] = {" % i)
+        for at in range(0, len(packed), 16):
+            out.append("    " + ",".join("0x%02x" % b for b in packed[at:at + 16]) + ",")
+        out.append("};")
+        out.append("")
+    out.append("static const HttpAsset kWebAssets[] = {")
+    for i, (path, ctype, cache, _, _, packed) in enumerate(assets):
+        out.append('    {"%s", "%s", "%s", kWebAsset%d, sizeof(kWebAsset%d), "\\"%s\\""},'
+                   % (path, ctype, cache, i, i, etag(packed)))
+    out.append("};")
+    out.append("constexpr size_t kWebAssetCount = sizeof(kWebAssets) / sizeof(kWebAssets[0]);")
+    out.append("")
+    out.append("#endif // WEBASSETS_H")
+    text = "\n".join(out) + "\n"
+
+    try:
+        with open(OUT, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(OUT, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("build_web_assets: wrote %s (%s)" % (os.path.relpath(OUT, PROJECT_DIR),
+          ", ".join("%s %d B" % (a[0], len(a[5])) for a in assets)))
+
+
+build()
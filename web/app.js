@@ -0,0 +1,94 @@
+function get(url, cb){fetch(url).then(r=>r.json()).then(cb);}
+function post(url, d, cb){
+  let b=Object.keys(d).map(k=>encodeURIComponent(k)+'='+encodeURIComponent(d[k])).join('&');
+  fetch(url,{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:b}).then(r=>r.json()).then(cb);
+}
+function loadPID(){ get('/api/pid', d=>{ for(let k in d){let el=document.getElementById(k); if(el&&el.type=='checkbox')el.checked=d[k]>0.5; else if(el)el.value=d[k];} }); }
+function savePID(){
+  let d={}; document.querySelectorAll('#pidForm input').forEach(i=>d[i.id]=i.type=='checkbox' ? (i.checked?1:0) : parseFloat(i.value));
+  if(!document.getElementById('pidPersist').checked) d.persist=0;
+  post('/api/pid', d, r=>{
+    // Gains are live from the next loop tick either way; saving waits for disarm in flight
+    setText('pidStatus', r.status!='success' ? r.status+' '+(r.key||'') : r.saved ? 'live + saved' : r.pending ? 'live, saves on disarm' : 'live (not saved)');
+  });
+}
+// Relay autotune: the flight task runs the test; poll its progress until it settles
+let atTimer=null;
+function showAutotune(r){
+  setText('atStatus', r.state+' ['+['roll','pitch','yaw'][r.axis]+'] cycles '+r.cycles+
+    (r.state=='done' ? ' | Ku '+r.ku+' Tu '+r.tu_ms+' ms -> kp '+r.kp+' ki '+r.ki+' kd '+r.kd : ''));
+  if(r.state!='running' && atTimer){ clearInterval(atTimer); atTimer=null; }
+}
+function autotune(cmd){
+  let d={cmd:cmd, axis:document.getElementById('atAxis').value};
+  if(cmd=='apply' && !document.getElementById('pidPersist').checked) d.persist=0;
+  post('/api/autotune', d, r=>{
+    if(r.ok===false){ setText('atStatus', r.msg); return; }
+    if(cmd=='apply'){ setText('atStatus', 'applied: '+(r.saved ? 'live + saved' : r.pending ? 'live, saves on disarm' : 'live')); loadPID(); return; }
+    if(!atTimer) atTimer=setInterval(()=>get('/api/autotune', showAutotune), 500);
+  });
+}
+// SSE stream of 53-byte packed VehicleState frames, base64 per event (layout: core/TelemetryPacket.h)
+let es=null, frames=0;
+function setText(id, t){ document.getElementById(id).innerText=t; }
+function onFrame(e){
+  let b=Uint8Array.from(atob(e.data), c=>c.charCodeAt(0));
+  if(b.length<53 || b[0]!=2) return;
+  let v=new DataView(b.buffer), i16=o=>v.getInt16(o,true), u16=o=>v.getUint16(o,true);
+  for(let i=0; i<5; i++){
+    let c=u16(21+2*i); setText('val'+i, c);
+    document.getElementById('bar'+i).style.width=((c-1000)/10)+'%';
+  }
+  setText('imu_ar', (i16(11)/100).toFixed(1)); setText('imu_ap', (i16(13)/100).toFixed(1));
+  setText('imu_gr', (i16(15)/10).toFixed(1)); setText('imu_gp', (i16(17)/10).toFixed(1)); setText('imu_gy', (i16(19)/10).toFixed(1));
+  // The estimator only runs armed: disarmed frames repeat the last armed attitude
+  setText('live_att', [5,7,9].map(o=>(i16(o)/100).toFixed(1)).join(' / ') + ((b[51]&1) ? '' : ' (last armed)'));
+  setText('live_mot', Array.from({length: b[52]}, (_, i)=>u16(33+2*i)).join(' '));
+  setText('live_v', (u16(49)/1000).toFixed(2));
+  setText('live_state', (b[51]&2) ? 'SIGNAL LOST' : (b[51]&1) ? 'ARMED' : 'disarmed');
+  frames++;
+}
+function startStream(){
+  if(es) es.close();
+  es=new EventSource('/api/stream?hz='+document.getElementById('streamHz').value);
+  es.onmessage=onFrame;
+}
+function toggleRxTest(){
+  let act = document.getElementById('rxTest').checked;
+  post('/api/receiver', {active: act, channelIdx: -1, value: 1500}, r=>{});
+}
+function setJoystick(idx, val){
+  if(!document.getElementById('rxTest').checked) return;
+  post('/api/receiver', {active: true, channelIdx: idx, value: parseInt(val)}, r=>{});
+}
+function toggleMTest(){
+  let act = document.getElementById('mTest').checked;
+  post('/api/motor', {active: act, motorIdx: -1, value: 1000}, r=>{ if(!r.ok){document.getElementById('mTest').checked=false; alert(r.msg);} });
+}
+function setMotor(idx, val){
+  if(!document.getElementById('mTest').checked) return;
+  post('/api/motor', {active: true, motorIdx: idx, value: parseInt(val)}, r=>{});
+}
+function toggleCalib(){
+  document.getElementById('calibBtns').style.display = document.getElementById('calibSafety').checked ? 'flex' : 'none';
+}
+function calibrateESC(cmd){
+  if(!document.getElementById('calibSafety').checked) return;
+  post('/api/calibrate', {cmd: cmd}, r=>{ if(!r.ok) alert(r.msg); });
+}
+// DShot ESC commands: sent by the flight task in place of stop frames, disarmed only
+function escCommand(cmd){ post('/api/calibrate', {cmd: cmd}, r=>{ if(!r.ok) alert(r.msg); }); }
+function loadTiming(reset){
+  get('/api/timing'+(reset?'?reset=1':''), d=>{
+    let h='<tr><th>stage</th><th>n</th><th>min</th><th>p50</th><th>p90</th><th>p99</th><th>max</th></tr>';
+    d.stages.forEach(s=>{ h+=`<tr><td>${s.name}</td><td>${s.n}</td><td>${s.min}</td><td>${s.p50}</td><td>${s.p90}</td><td>${s.p99}</td><td>${s.max}</td></tr>`; });
+    h+=`<tr><td>blackbox</td><td colspan="6">${d.blackbox.frames} frames, ${d.blackbox.dropped} dropped</td></tr>`;
+    document.getElementById('timingTable').innerHTML=h;
+  });
+}
+function loadLog(){ fetch('/api/log?hz=50').then(r=>r.text()).then(t=>{ document.getElementById('logBox').value=t; }); }
+function copyLog(){
+  let b=document.getElementById('logBox'); b.select(); document.execCommand('copy');
+  alert('Copied raw CSV to clipboard!');
+}
+window.onload=()=>{ loadPID(); startStream(); setInterval(()=>{ setText('live_fps', frames); frames=0; }, 1000); };